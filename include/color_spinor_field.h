@@ -1031,9 +1031,10 @@ namespace quda
                         cvector_ref<const ColorSpinorField> &v = {});
 
   /**
-     @brief pre-declaration of RNG class (defined in non-device-safe random_quda.h)
+     @brief pre-declaration of RNG classes (defined in non-device-safe random_quda.h)
   */
   class RNG;
+  class CounterRNG;
 
   /**
      @brief Generate a random noise spinor.  This variant allows the user to manage the RNG state.
@@ -1043,14 +1044,27 @@ namespace quda
   */
   void spinorNoise(ColorSpinorField &src, RNG &randstates, QudaNoiseType type);
 
+  /**
+     @brief Generate a random noise spinor using a counter-based
+     generator.  The noise is independent of the partitioning and is
+     generated directly on the host for host fields.  The call
+     counter of the generator is advanced by one.
+     @param[out] src The colorspinorfield
+     @param[in,out] rng The counter-based generator
+     @param[in] type The type of noise to create (QUDA_NOISE_GAUSSIAN or QUDA_NOISE_UNIFORM)
+  */
+  void spinorNoise(ColorSpinorField &src, CounterRNG &rng, QudaNoiseType type);
+
   /**
      @brief Generate a random noise spinor.  This variant just
      requires a seed and will create and destroy the random number state.
      @param[out] src The colorspinorfield
      @param[in] seed Seed
      @param[in] type The type of noise to create (QUDA_NOISE_GAUSSIAN or QUDA_NOISE_UNIFORM)
+     @param[in] counter Whether to use the counter-based generator,
+     with a call counter of zero, rather than MRG32k3a
   */
-  void spinorNoise(ColorSpinorField &src, unsigned long long seed, QudaNoiseType type);
+  void spinorNoise(ColorSpinorField &src, unsigned long long seed, QudaNoiseType type, bool counter = false);
 
   /**
      @brief Generate a set of diluted color spinors from a single source.
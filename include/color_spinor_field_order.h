@@ -849,7 +849,7 @@ namespace quda
     class FieldOrderCB : public GhostOrder<Float, nSpin_, nColor_, nVec, order, storeFloat, ghostFloat, disable_ghost>
     {
       static_assert((block_float && nVec == 1) || !block_float, "Not supported");
-      using GhostOrder = GhostOrder<Float, nSpin_, nColor_, nVec, order, storeFloat, ghostFloat, disable_ghost>;
+      using GhostOrder = colorspinor::GhostOrder<Float, nSpin_, nColor_, nVec, order, storeFloat, ghostFloat, disable_ghost>;
       using norm_t = float;
 
     public:
@@ -1075,7 +1075,7 @@ namespace quda
       using Accessor = GhostNOrder<Float, Ns, Nc, N, spin_project, huge_alloc>;
       using GhostVector = typename VectorType<Float, N_ghost>::type;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       using norm_type = float;
       int nParity;
       array<int, 4> faceVolumeCB = {};
@@ -1198,9 +1198,9 @@ namespace quda
       static constexpr int N = N_;
       static constexpr int M = length / N;
       using Accessor = FloatNOrder<Float, Ns, Nc, N, spin_project, huge_alloc, disable_ghost>;
-      using GhostNOrder = GhostNOrder<Float, Ns, Nc, N, spin_project, huge_alloc, disable_ghost>;
+      using GhostNOrder = colorspinor::GhostNOrder<Float, Ns, Nc, N, spin_project, huge_alloc, disable_ghost>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       using Vector = typename VectorType<Float, N>::type;
       using AllocInt = typename AllocType<huge_alloc>::type;
       using norm_type = float;
@@ -1322,7 +1322,7 @@ namespace quda
       using Accessor = GhostNOrder<Float, Ns, Nc, N, spin_project, huge_alloc>;
       using GhostVector = int4; // 128-bit packed type
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       using norm_type = float;
       int nParity;
       array<int, 4> faceVolumeCB = {};
@@ -1434,9 +1434,9 @@ namespace quda
       static constexpr int Nc = 3;
       static constexpr int length = 2 * Ns * Nc;
       using Accessor = FloatNOrder<Float, Ns, Nc, N_, spin_project, huge_alloc, disable_ghost>;
-      using GhostNOrder = GhostNOrder<Float, Ns, Nc, N_, spin_project, huge_alloc, disable_ghost>;
+      using GhostNOrder = colorspinor::GhostNOrder<Float, Ns, Nc, N_, spin_project, huge_alloc, disable_ghost>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       using Vector = int4;      // 128-bit packed type
       using AllocInt = typename AllocType<huge_alloc>::type;
       using norm_type = float;
@@ -1528,7 +1528,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct SpaceColorSpinorOrder {
       using Accessor = SpaceColorSpinorOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       static const int length = 2 * Ns * Nc;
       Float *field;
       size_t offset;
@@ -1612,7 +1612,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct SpaceSpinorColorOrder {
       using Accessor = SpaceSpinorColorOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       static const int length = 2 * Ns * Nc;
       Float *field;
       size_t offset;
@@ -1687,7 +1687,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct PaddedSpaceSpinorColorOrder {
       using Accessor = PaddedSpaceSpinorColorOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       static const int length = 2 * Ns * Nc;
       Float *field;
       size_t offset;
@@ -1790,7 +1790,7 @@ namespace quda
     template <typename Float, int Ns, int Nc> struct QDPJITDiracOrder {
       using Accessor = QDPJITDiracOrder<Float, Ns, Nc>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       Float *field;
       int volumeCB;
       int nParity;
@@ -23,6 +23,7 @@ namespace quda
 {
 
   typedef struct MsgHandle_s MsgHandle;
+  typedef struct NeighborHandle_s NeighborHandle;
   typedef struct Topology_s Topology;
 
   char *comm_hostname(void);
@@ -36,6 +37,49 @@ namespace quda
   int comm_rank_from_coords(const Topology *topo, const int *coords);
   int comm_rank_displaced(const Topology *topo, const int displacement[]);
   void comm_set_default_topology(Topology *topo);
+
+  /**
+     @brief Parameters and result of a topology-aware
+     rank-to-coordinate mapping.  Passed as the map data together
+     with comm_topology_rank_from_coords, this requests that the
+     mapping be chosen, based on which ranks share a node, to minimize
+     the inter-node halo traffic for the given lattice.
+  */
+  struct TopologyMap {
+    int lattice[QUDA_MAX_DIM] = {};   /** Global lattice dimensions */
+    size_t site_bytes = 0;            /** Halo bytes per face site (of a single parity) per dslash */
+    int ndim = 0;                     /** Number of process grid dimensions */
+    int dims[QUDA_MAX_DIM] = {};      /** Process grid dimensions */
+    int node_dims[QUDA_MAX_DIM] = {}; /** Chosen node sub-grid (zero if the default mapping is retained) */
+    std::vector<int> ranks;           /** Rank at each lexicographic process grid coordinate */
+    size_t inter_node_bytes = 0;      /** Inter-node halo bytes per dslash with the chosen mapping */
+    size_t inter_node_bytes_lex = 0;  /** Inter-node halo bytes per dslash with the default mapping */
+  };
+
+  /**
+     @brief Rank-to-coordinate mapping that looks up the table
+     computed by comm_optimize_topology
+     @param coords Process grid coordinates
+     @param fdata Pointer to the TopologyMap
+     @return The rank at the given coordinates
+  */
+  int comm_topology_rank_from_coords(const int *coords, void *fdata);
+
+  /**
+     @brief Choose the rank-to-coordinate mapping that minimizes the
+     inter-node halo traffic.  Ranks are grouped into nodes by their
+     hostname, and every node sub-grid that tiles the process grid is
+     considered, with the ranks on each node assigned to a block of
+     the process grid.  The default lexicographical mapping is
+     retained unless a sub-grid strictly reduces the inter-node
+     traffic, or if the nodes hold differing numbers of ranks.
+     @param[in] ndim Number of process grid dimensions
+     @param[in] dims Process grid dimensions
+     @param[in,out] map The mapping parameters and result
+     @param[in] hostname Gathered hostnames of all ranks
+     @param[in] n_rank Number of ranks
+  */
+  void comm_optimize_topology(int ndim, const int *dims, TopologyMap &map, const char *hostname, int n_rank);
   Topology *comm_default_topology(void);
 
   // routines related to direct peer-2-peer access
@@ -416,6 +460,41 @@ namespace quda
   void comm_wait(MsgHandle *mh);
   int comm_query(MsgHandle *mh);
 
+  /**
+     @brief A message to or from a neighbor in a neighborhood
+     collective, located at a given offset in the send or receive
+     buffer.  Each rank may only appear once in a neighborhood.
+  */
+  struct CommNeighbor {
+    int rank;      /** The neighbor rank */
+    size_t offset; /** The offset in bytes of the message in the buffer */
+    size_t bytes;  /** The size in bytes of the message */
+  };
+
+  /**
+     @brief Declare a persistent neighborhood all-to-all exchange,
+     where the message to each destination is taken from the send
+     buffer and the message from each source is placed in the receive
+     buffer.  This creates a distributed-graph communicator from the
+     given neighborhood, and is a collective operation.
+     @param send_buffer Buffer from which the messages are sent
+     @param dst The destination neighbors
+     @param recv_buffer Buffer into which the messages are received
+     @param src The source neighbors
+     @return The neighborhood handle
+  */
+  NeighborHandle *comm_declare_neighbor_alltoallv(void *send_buffer, const std::vector<CommNeighbor> &dst,
+                                                  void *recv_buffer, const std::vector<CommNeighbor> &src);
+
+  /**
+     @brief Carry out a neighborhood all-to-all exchange, returning
+     once all messages have been sent and received
+     @param nh The neighborhood handle
+  */
+  void comm_neighbor_alltoallv(NeighborHandle *nh);
+
+  void comm_free(NeighborHandle *&nh);
+
   template <typename T> void comm_allreduce_sum(T &v);
   template <typename T> void comm_allreduce_max(T &v);
   template <typename T> void comm_allreduce_min(T &v);
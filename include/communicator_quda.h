@@ -14,6 +14,7 @@
 #include <field_cache.h>
 #include <comm_key.h>
 #include <float_vector.h>
+#include <reproducible_sum.h>
 
 #if defined(MPI_COMMS) || defined(QMP_COMMS)
 #include <mpi.h>
@@ -535,12 +536,30 @@ namespace quda
 
   void comm_init_common(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data)
   {
+    char *hostname_recv_buf = (char *)safe_malloc(QUDA_MAX_HOSTNAME_STRING * comm_size());
+    comm_gather_hostname(hostname_recv_buf);
+
+    // a topology-aware mapping requires the hostnames of all ranks
+    bool topology_map = (rank_from_coords == comm_topology_rank_from_coords);
+    if (topology_map)
+      comm_optimize_topology(ndim, dims, *static_cast<TopologyMap *>(map_data), hostname_recv_buf, comm_size());
+
     Topology *topo = comm_create_topology(ndim, dims, rank_from_coords, map_data, comm_rank());
     comm_set_default_topology(topo);
 
+    if (topology_map) {
+      auto &map = *static_cast<TopologyMap *>(map_data);
+      if (map.node_dims[0] > 0) {
+        logQuda(QUDA_SUMMARIZE, "Topology-aware rank mapping with node grid %dx%dx%dx%d\n", map.node_dims[0],
+                map.node_dims[1], map.node_dims[2], map.node_dims[3]);
+      } else {
+        logQuda(QUDA_SUMMARIZE, "Topology-aware rank mapping retains the default mapping\n");
+      }
+      logQuda(QUDA_SUMMARIZE, "Inter-node halo bytes per dslash = %lu (default mapping = %lu)\n",
+              map.inter_node_bytes, map.inter_node_bytes_lex);
+    }
+
     // determine which GPU this rank will use
-    char *hostname_recv_buf = (char *)safe_malloc(QUDA_MAX_HOSTNAME_STRING * comm_size());
-    comm_gather_hostname(hostname_recv_buf);
 
     if (gpuid < 0) {
       int device_count = device::get_device_count();
@@ -675,6 +694,14 @@ namespace quda
   bool is_qmp_handle_default;
 #endif
 
+#if defined(MOCK_COMMS)
+  /** Global ranks of the mock processes in this communicator, indexed by rank */
+  std::vector<int> mock_group;
+
+  /** Context id distinguishing messages of this communicator from those of others */
+  int mock_context = 0;
+#endif
+
   int rank = -1;
   int size = -1;
 
@@ -747,11 +774,12 @@ namespace quda
 
   int comm_query(MsgHandle *mh);
 
-  template <typename T> T deterministic_reduce(T *array, int n)
-  {
-    std::sort(array, array + n); // sort reduction into ascending order for deterministic reduction
-    return std::accumulate(array, array + n, 0.0);
-  }
+  NeighborHandle *comm_declare_neighbor_alltoallv(void *send_buffer, const std::vector<CommNeighbor> &dst,
+                                                  void *recv_buffer, const std::vector<CommNeighbor> &src);
+
+  void comm_neighbor_alltoallv(NeighborHandle *nh);
+
+  void comm_free(NeighborHandle *&nh);
 
   void comm_allreduce_sum_array(double *data, size_t size);
 
@@ -6,7 +6,8 @@ namespace quda
 {
   /**
    * Interface function that launch contraction compute kernels,
-   * used in interface_quda.cpp
+   * used in interface_quda.cpp.  Only device fields are supported;
+   * contractFTMultiQuda supports host fields.
    * @param[in] x               input source field
    * @param[in] y               input source field
    * @param[out] result         container of complex contraction results for
@@ -32,6 +33,31 @@ namespace quda
 
   void contractQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result, QudaContractType cType);
 
+  /**
+     @brief Batched momentum-projected contraction of the field sets x
+     and y.  The color-contracted open spin matrices of every pair
+     (i,j) are projected onto all momenta at once: the per-site spin
+     matrices of a tile of pairs are written out for all local slices
+     and contracted against a Fourier phase table with a single GEMM.
+     Runs on the location of the fields, where it allocates
+     max_contract_k complex numbers per local site for the spin
+     matrices of a tile.
+     @param[out] result Globally summed open spin matrices, ordered as
+     [mom][slice][i][j][s1][s2], where slice is the global index in
+     the reduction dimension
+     @param[in] x Input field set (the conjugated one)
+     @param[in] y Input field set
+     @param[in] cType Contraction type (DR_FT_T, DR_FT_Z or STAGGERED_FT_T)
+     @param[in] source_position 4-d array of source position
+     @param[in] n_mom Number of momentum modes
+     @param[in] mom_modes Array of n_mom 4-d momenta
+     @param[in] fft_type Array of n_mom 4-d Fourier phase factor types
+   */
+  void contractFTMultiQuda(std::vector<Complex> &result, cvector_ref<const ColorSpinorField> &x,
+                           cvector_ref<const ColorSpinorField> &y, QudaContractType cType,
+                           const int *const source_position, int n_mom, const int *const mom_modes,
+                           const QudaFFTSymmType *const fft_type);
+
   /**
      @brief Contract the quark field x against the 3-d Laplace eigenvector
      set y.  At present, this expects a spin-4 fermion field, and the
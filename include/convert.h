@@ -8,6 +8,7 @@
  * arbitrary field and register ordering.
  */
 
+#include <cstring>
 #include <type_traits>
 #include <target_device.h>
 #include <register_traits.h>
@@ -103,7 +104,9 @@ namespace quda
     __device__ inline int operator()(float f)
     {
       f += 12582912.0f;
-      return reinterpret_cast<int &>(f);
+      int i;
+      memcpy(&i, &f, sizeof(int));
+      return i;
     }
   };
 
@@ -121,7 +124,9 @@ namespace quda
     __device__ inline int operator()(double d)
     {
       d += 6755399441055744.0;
-      return reinterpret_cast<int &>(d);
+      int i;
+      memcpy(&i, &d, sizeof(int)); // the low word holds the rounded integer
+      return i;
     }
   };
 
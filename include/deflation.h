@@ -27,11 +27,19 @@ namespace quda {
      /** The Dirac operator to use for spinor deflation operation */
     DiracMatrix &matDeflation;
 
-    /** Host  projection matrix (e.g. eigCG VH A V) */
-    Complex *matProj; 
+    /** Host  projection matrix (e.g. eigCG VH A V), stored as a packed
+        Hermitian matrix: the upper triangle column by column, so element
+        (i,j), i <= j, lives at j*(j+1)/2 + i (LAPACK 'U' packed format) */
+    Complex *matProj;
 
-    /** projection matrix leading dimension */
-    int ld;
+    /** Upper-triangular Cholesky factor R of the projection matrix,
+        matProj = R^H R, in the same packed format.  It is extended with
+        each appended vector so the projected system never needs to be
+        refactorized */
+    Complex *matChol;
+
+    /** whether matChol is a valid factorization of the current projection matrix */
+    bool use_chol;
 
     /** projection matrix full (maximum) dimension (n_ev*deflation_grid) */
     int tot_dim;
@@ -48,15 +56,30 @@ namespace quda {
     /** Filename for where to load/store the deflation space */
     char filename[100];
 
+    /**
+       @brief Number of elements needed to store a packed Hermitian matrix
+       @param[in] n Matrix dimension
+       @return n*(n+1)/2
+     */
+    static size_t packed_size(int n) { return static_cast<size_t>(n) * (n + 1) / 2; }
+
+    /**
+       @brief Index of the element (i,j), i <= j, in packed storage
+       @param[in] i Row index
+       @param[in] j Column index
+       @return Offset of the element in the packed array
+     */
+    static size_t packed_idx(int i, int j) { return static_cast<size_t>(j) * (j + 1) / 2 + i; }
+
     DeflationParam(QudaEigParam &param, ColorSpinorField *RV,  DiracMatrix &matDeflation, int cur_dim = 0) : eig_global(param), RV(RV), matDeflation(matDeflation), 
-             cur_dim(cur_dim), use_inv_ritz(false), location(param.location) {
+             use_chol(true), cur_dim(cur_dim), use_inv_ritz(false), location(param.location) {
 
         if(param.nk == 0 || param.np == 0 || (param.np % param.nk != 0)) errorQuda("\nIncorrect deflation space parameters...\n");
         // redesign: param.nk => param.n_ev, param.np => param.deflation_grid*param.n_ev;
         tot_dim      = param.np;
-        ld           = ((tot_dim+15) / 16) * tot_dim;
         //allocate deflation resources:
-        matProj = static_cast<Complex *>(pool_pinned_malloc(ld * tot_dim * sizeof(Complex)));
+        matProj = static_cast<Complex *>(pool_pinned_malloc(packed_size(tot_dim) * sizeof(Complex)));
+        matChol = new Complex[packed_size(tot_dim)];
         invRitzVals  = new double[tot_dim];
 
         //Check that RV is a composite field:
@@ -65,6 +88,7 @@ namespace quda {
 
      ~DeflationParam(){
        pool_pinned_free(matProj);
+       if (matChol) delete[] matChol;
        if (invRitzVals) delete[] invRitzVals;
      }
   };
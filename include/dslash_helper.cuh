@@ -668,7 +668,7 @@ namespace quda
     static constexpr const char *filename() { return Arg::D::filename(); }
     constexpr dslash_functor(const Arg &arg) : arg(arg.arg) { }
 
-    __forceinline__ __device__ void operator()(int, int s, int parity)
+    __forceinline__ __device__ void operator()(int x, int s, int parity)
     {
       typename Arg::D dslash(arg);
       // for full fields set parity from z thread index else use arg setting
@@ -693,7 +693,10 @@ namespace quda
       } else {
         const int dslash_block_offset
           = ((kernel_type == INTERIOR_KERNEL || kernel_type == UBER_KERNEL) ? arg.pack_blocks : 0);
-        int x_cb = (target::block_idx().x - dslash_block_offset) * target::block_dim().x + target::thread_idx().x;
+        // derive the site index from the linear thread index rather
+        // than the block index so that host execution, where each
+        // call is a single thread of a single block, is also correct
+        int x_cb = x - dslash_block_offset * target::block_dim().x;
         if (x_cb >= arg.threads) return;
 
 #ifdef QUDA_FAST_COMPILE_DSLASH
@@ -150,6 +150,36 @@ namespace quda
     */
     virtual double estimateChebyOpMax(ColorSpinorField &out, ColorSpinorField &in);
 
+    /**
+       @brief Compute stochastic Chebyshev moments mu_k = <v|T_k(A')|v>
+       of the operator mapped onto [-1,1], A' = (A - c) / e, averaged
+       over random vectors (kernel polynomial method).  The doubling
+       relations T_2k = 2 T_k^2 - T_0 and T_2k+1 = 2 T_k+1 T_k - T_1
+       give two moments per operator application.
+       @param[in] t0 Temporary spinor
+       @param[in] t1 Temporary spinor
+       @param[in] t2 Temporary spinor
+       @param[in] lower Lower bound of the spectrum
+       @param[in] upper Upper bound of the spectrum
+       @param[in] n_moments Number of moments to compute
+       @param[in] n_vec Number of stochastic vectors
+       @return The averaged moments
+    */
+    std::vector<double> computeKPMMoments(ColorSpinorField &t0, ColorSpinorField &t1, ColorSpinorField &t2,
+                                          double lower, double upper, int n_moments, int n_vec);
+
+    /**
+       @brief Select the Chebyshev filter window a_min and the polynomial
+       degree from a kernel polynomial method estimate of the spectral
+       density.  a_min is placed where the estimated eigenvalue count
+       reaches (n_ev + n_kr) / 2, and the degree is the smallest one for
+       which the n_conv-th eigenvalue is predicted to converge to tol
+       within a single Krylov space.  The choices are written back into
+       eig_param.
+       @param[in] kSpace The Krylov space vectors (used as temporaries)
+    */
+    void estimateChebyOpWindow(std::vector<ColorSpinorField> &kSpace);
+
     /**
        @brief Orthogonalise input vectors r against
        vector space v using hybrid modified Gram-Schmidt block-BLAS
@@ -564,6 +594,7 @@ namespace quda
   */
   class IRAM : public EigenSolver
   {
+  protected:
     std::vector<std::vector<Complex>> upperHess = {};
     std::vector<std::vector<Complex>> Qmat = {};
     std::vector<std::vector<Complex>> Rmat = {};
@@ -636,6 +667,79 @@ namespace quda
                  const QudaEigSpectrumType spec_type);
   };
 
+  /**
+     @brief Krylov-Schur restarted Arnoldi Method.  Rather than
+     applying the unwanted Ritz values as implicit QR shifts, the
+     Rayleigh quotient is kept in Schur form across restarts: the
+     wanted Ritz values are moved to the leading block with
+     adjacent Givens swaps (trexc-style) and the Arnoldi
+     factorization is truncated there.
+  */
+  class KrylovSchur : public IRAM
+  {
+  public:
+    /**
+       @brief Constructor for Krylov-Schur Eigensolver class
+       @param eig_param The eigensolver parameters
+       @param mat The operator to solve
+    */
+    KrylovSchur(const DiracMatrix &mat, QudaEigParam *eig_param);
+
+    /**
+       @brief Compute eigenpairs
+       @param[in] kSpace Krylov vector space
+       @param[in] evals Computed eigenvalues
+    */
+    void operator()(std::vector<ColorSpinorField> &kSpace, std::vector<Complex> &evals);
+
+    /**
+       @brief Compute the complex Schur form of the Rayleigh quotient
+       held in upperHess.  On exit upperHess holds the upper
+       triangular factor T and Qmat the unitary Schur vectors U.
+    */
+    void schurDecomposition();
+
+    /**
+       @brief Swap the adjacent diagonal elements k and k+1 of the
+       Schur form with a single Givens rotation, updating T and U
+       @param[in] k The index of the leading element to swap
+    */
+    void schurSwap(int k);
+
+    /**
+       @brief Reorder the Schur form so that the wanted Ritz values
+       lead the diagonal of T
+       @param[in] spec_type The spectrum type (Largest/Smallest)(Modulus/Imaginary/Real) that
+       determines the sorting condition
+    */
+    void schurReorder(const QudaEigSpectrumType spec_type);
+
+    /**
+       @brief Compute the i-th eigenvector of the upper triangular
+       Schur factor by back substitution
+       @param[out] y The eigenvector (of length n_kr, zero below i)
+       @param[in] i The index of the eigenvalue
+    */
+    void triangularEigenvector(std::vector<Complex> &y, int i);
+
+    /**
+       @brief Extract the Ritz values from the Schur form, and the
+       residua of the leading Ritz pairs
+       @param[out] evals The Ritz values
+       @param[in] beta Norm of residual (used to compute errors on eigenvalues)
+       @param[in] n The number of leading Ritz pairs whose residua are computed
+    */
+    void ritzFromSchur(std::vector<Complex> &evals, const double beta, int n);
+
+    /**
+       @brief Replace the Schur vectors in Qmat with the Ritz vectors
+       of the Rayleigh quotient, ready for a final basis rotation,
+       and update all the residua
+       @param[in] beta Norm of residual (used to compute errors on eigenvalues)
+    */
+    void ritzVectorsFromSchur(const double beta);
+  };
+
   /**
      arpack_solve()
 
@@ -141,6 +141,7 @@ typedef enum QudaEigType_s {
   QUDA_EIG_TR_LANCZOS_3D,  // Thick restarted lanczos solver for 3-d systems
   QUDA_EIG_IR_ARNOLDI,     // Implicitly Restarted Arnoldi solver
   QUDA_EIG_BLK_IR_ARNOLDI, // Block Implicitly Restarted Arnoldi solver
+  QUDA_EIG_KRYLOV_SCHUR,   // Krylov-Schur restarted Arnoldi solver
   QUDA_EIG_INVALID = QUDA_INVALID_ENUM
 } QudaEigType;
 
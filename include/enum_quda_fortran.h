@@ -125,6 +125,7 @@
 #define QUDA_EIG_TR_LANCZOS_3D 2  // Thick Restarted Lanczos Solver for 3-d systems
 #define QUDA_EIG_IR_ARNOLDI 3     // Implicitly restarted Arnoldi solver
 #define QUDA_EIG_BLK_IR_ARNOLDI 4 // Block Implicitly restarted Arnoldi solver (not yet implemented)
+#define QUDA_EIG_KRYLOV_SCHUR 5   // Krylov-Schur restarted Arnoldi solver
 #define QUDA_EIG_INVALID QUDA_INVALID_ENUM
 
 #define QudaEigSpectrumType integer(4)
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+/**
+   @file gauge_cache.h
+
+   @section DESCRIPTION
+   Least-recently-used cache of gauge fields derived from another
+   gauge field, e.g., smeared, flowed, fat and long, or two-link
+   fields.  Each entry is keyed by the kind of derivation, a checksum
+   of the input field and a hash of the parameters of the derivation,
+   so that repeating the same derivation on the same field is reduced
+   to a copy.  Entries are held in device memory up to a device
+   memory budget, beyond which the least-recently-used entries are
+   spilled to host memory up to a host memory budget, beyond which
+   they are evicted.
+
+   The cache is disabled by default, and is enabled by setting the
+   device budget in MiB with QUDA_GAUGE_CACHE_SIZE, and optionally the
+   host budget in MiB with QUDA_GAUGE_CACHE_HOST_SIZE.
+ */
+
+namespace quda
+{
+
+  class GaugeField;
+
+  namespace gauge_cache
+  {
+
+    /**
+       @brief Identifies a derived gauge field
+    */
+    struct Key {
+      std::string kind;  /** The derivation, e.g., "smear" */
+      uint64_t checksum; /** Checksum of the input gauge field */
+      uint64_t hash;     /** Hash of the parameters of the derivation */
+
+      bool operator==(const Key &other) const
+      {
+        return kind == other.kind && checksum == other.checksum && hash == other.hash;
+      }
+    };
+
+    /**
+       @brief FNV-1a hash used to combine the parameters of a derivation
+    */
+    class Hash
+    {
+      uint64_t value_ = 0xcbf29ce484222325ull;
+
+    public:
+      /**
+         @brief Add an array of trivially copyable values to the hash
+         @param[in] v Pointer to the values
+         @param[in] n Number of values
+      */
+      template <typename T> Hash &add(const T *v, size_t n)
+      {
+        static_assert(std::is_trivially_copyable_v<T>, "Hash requires trivially copyable types");
+        auto bytes = reinterpret_cast<const unsigned char *>(v);
+        for (size_t i = 0; i < n * sizeof(T); i++) {
+          value_ ^= bytes[i];
+          value_ *= 0x100000001b3ull;
+        }
+        return *this;
+      }
+
+      /**
+         @brief Add a trivially copyable value to the hash
+      */
+      template <typename T> Hash &operator()(const T &v) { return add(&v, 1); }
+
+      uint64_t value() const { return value_; }
+    };
+
+    /**
+       @brief Cache statistics
+    */
+    struct Stats {
+      size_t hits = 0;      /** Number of lookups satisfied by the cache */
+      size_t misses = 0;    /** Number of lookups not satisfied by the cache */
+      size_t spills = 0;    /** Number of entries moved from device to host memory */
+      size_t evictions = 0; /** Number of entries dropped */
+    };
+
+    /**
+       @return Whether the cache is enabled
+    */
+    bool enabled();
+
+    /**
+       @brief Set the memory budgets of the cache, overriding the
+       environment.  A zero device budget disables the cache.
+       @param[in] device_bytes Device memory budget in bytes
+       @param[in] host_bytes Host memory budget in bytes
+    */
+    void set_budget(size_t device_bytes, size_t host_bytes);
+
+    /**
+       @brief Compute the global checksum of a gauge field at any
+       location and in any order, used to identify the input of a
+       derivation.  Device fields are copied to the host to compute
+       the checksum.
+       @param[in] u The gauge field
+       @return The checksum
+    */
+    uint64_t checksum(const GaugeField &u);
+
+    /**
+       @brief Look up a derived gauge field.  On a hit the cached
+       fields are copied into the output fields, which must have the
+       same parameters as those inserted, and the entry becomes the
+       most recently used.
+       @param[in] key The key of the derivation
+       @param[out] out The fields to copy the cached fields into
+       @param[out] aux Optional scalar data stored with the entry
+       @return Whether the lookup was a hit
+    */
+    bool lookup(const Key &key, const std::vector<GaugeField *> &out, std::vector<double> *aux = nullptr);
+
+    /**
+       @brief Insert a copy of derived gauge fields into the cache as
+       the most recently used entry, spilling or evicting other entries
+       as needed to remain within the memory budgets.  If the entry
+       already exists it is replaced.
+       @param[in] key The key of the derivation
+       @param[in] in The fields to cache
+       @param[in] aux Optional scalar data to store with the entry
+    */
+    void insert(const Key &key, const std::vector<const GaugeField *> &in, const std::vector<double> &aux = {});
+
+    /**
+       @return The cache statistics
+    */
+    Stats get_stats();
+
+    /**
+       @brief Free all cache entries
+    */
+    void destroy();
+
+  } // namespace gauge_cache
+
+} // namespace quda
@@ -5,6 +5,7 @@
 #include <lattice_field.h>
 
 #include <comm_key.h>
+#include <halo_exchange.h>
 
 namespace quda {
 
@@ -235,6 +236,17 @@ namespace quda {
     */
     void exchange(void **recv, void **send, QudaDirection dir) const;
 
+    /**
+       @brief Register the exchange of the buffers across all
+       dimensions in a given direction with a halo exchange, such
+       that it can be aggregated with other exchanges
+       @param[in,out] halo The halo exchange we are registering with
+       @param[out] recv Receive buffer
+       @param[in] send Send buffer
+       @param[in] dir Direction in which we are sending (forwards OR backwards only)
+    */
+    void exchange(halo::Exchange &halo, void **recv, void **send, QudaDirection dir) const;
+
     /**
        Compute the required extended ghost zone sizes and offsets
        @param[in] R Radius of the ghost zone
@@ -418,6 +430,20 @@ namespace quda {
     */
     void exchangeExtendedGhost(const lat_dim_t &R, TimeProfile &profile, bool no_comms_fill = false);
 
+    /**
+       @brief This routine will populate the border / halo region of a
+       set of gauge fields that have been created using
+       copyExtendedGauge.  For host fields, the halos of all fields
+       are exchanged together, with all faces destined for the same
+       neighbor aggregated into a single message.
+       @param u The gauge fields whose halos we are exchanging
+       @param R The thickness of the extended region in each dimension
+       @param no_comms_fill Do local exchange to fill out the extended
+       region in non-partitioned dimensions
+    */
+    static void exchangeExtendedGhost(const std::vector<GaugeField *> &u, const lat_dim_t &R,
+                                      bool no_comms_fill = false);
+
     void checkField(const LatticeField &) const;
 
     /**
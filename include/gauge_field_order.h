@@ -967,7 +967,7 @@ namespace quda {
       template <int N, typename Float, QudaGhostExchange ghostExchange_, QudaStaggeredPhase = QUDA_STAGGERED_PHASE_NO>
       struct Reconstruct {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
         real scale;
         real scale_inv;
         Reconstruct(const GaugeField &u) :
@@ -1073,7 +1073,7 @@ namespace quda {
       */
       template <typename Float, QudaGhostExchange ghostExchange_> struct Reconstruct<12, Float, ghostExchange_> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
         const real anisotropy;
         const real tBoundary;
         const int firstTimeSliceBound;
@@ -1145,7 +1145,7 @@ namespace quda {
       */
       template <typename Float, QudaGhostExchange ghostExchange_> struct Reconstruct<11, Float, ghostExchange_> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
 
         Reconstruct(const GaugeField &) { ; }
 
@@ -1193,7 +1193,7 @@ namespace quda {
       template <typename Float, QudaGhostExchange ghostExchange_, QudaStaggeredPhase stag_phase>
       struct Reconstruct<13, Float, ghostExchange_, stag_phase> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
         const Reconstruct<12, Float, ghostExchange_> reconstruct_12;
         const real scale;
         const real scale_inv;
@@ -1269,7 +1269,7 @@ namespace quda {
       */
       template <typename Float, QudaGhostExchange ghostExchange_> struct Reconstruct<8, Float, ghostExchange_> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
         const complex anisotropy; // imaginary value stores inverse
         const complex tBoundary;  // imaginary value stores inverse
         const int firstTimeSliceBound;
@@ -1417,7 +1417,7 @@ namespace quda {
       template <typename Float, QudaGhostExchange ghostExchange_, QudaStaggeredPhase stag_phase>
       struct Reconstruct<9, Float, ghostExchange_, stag_phase> {
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
         const Reconstruct<8, Float, ghostExchange_> reconstruct_8;
         const real scale;
         const real scale_inv;
@@ -1523,7 +1523,7 @@ namespace quda {
         using store_t = Float;
         static constexpr int length = length_;
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
         typedef typename VectorType<Float, N>::type Vector;
         typedef typename AllocType<huge_alloc>::type AllocInt;
         Reconstruct<reconLenParam, Float, ghostExchange_, stag_phase> reconstruct;
@@ -1780,7 +1780,7 @@ namespace quda {
         using Accessor = LegacyOrder<Float, length>;
         using store_t = Float;
         using real = typename mapper<Float>::type;
-        using complex = complex<real>;
+        using complex = quda::complex<real>;
         Float *ghost[QUDA_MAX_DIM] = {};
         int faceVolumeCB[QUDA_MAX_DIM] = {};
         const unsigned int volumeCB;
@@ -1855,7 +1855,7 @@ namespace quda {
     template <typename Float, int length> struct QDPOrder : public LegacyOrder<Float,length> {
       using Accessor = QDPOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       Float *gauge[QUDA_MAX_DIM];
       const unsigned int volumeCB;
       QDPOrder(const GaugeField &u, Float *gauge_ = 0, Float **ghost_ = 0) :
@@ -1901,7 +1901,7 @@ namespace quda {
     template <typename Float, int length> struct QDPJITOrder : public LegacyOrder<Float,length> {
       using Accessor = QDPJITOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       Float *gauge[QUDA_MAX_DIM];
       const unsigned int volumeCB;
       QDPJITOrder(const GaugeField &u, Float *gauge_ = 0, Float **ghost_ = 0) :
@@ -1951,7 +1951,7 @@ namespace quda {
   template <typename Float, int length> struct MILCOrder : public LegacyOrder<Float,length> {
     using Accessor = MILCOrder<Float, length>;
     using real = typename mapper<Float>::type;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     Float *gauge;
     const unsigned int volumeCB;
     const int geometry;
@@ -2012,7 +2012,7 @@ namespace quda {
   template <typename Float, int length> struct MILCSiteOrder : public LegacyOrder<Float,length> {
     using Accessor = MILCSiteOrder<Float, length>;
     using real = typename mapper<Float>::type;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     Float *gauge;
     const unsigned int volumeCB;
     const int geometry;
@@ -2071,7 +2071,7 @@ namespace quda {
   template <typename Float, int length> struct CPSOrder : LegacyOrder<Float,length> {
     using Accessor = CPSOrder<Float, length>;
     using real = typename mapper<Float>::type;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     Float *gauge;
     const unsigned int volumeCB;
     const real anisotropy;
@@ -2140,7 +2140,7 @@ namespace quda {
     template <typename Float, int length> struct BQCDOrder : LegacyOrder<Float,length> {
       using Accessor = BQCDOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       Float *gauge;
       const unsigned int volumeCB;
       unsigned int exVolumeCB; // extended checkerboard volume
@@ -2202,7 +2202,7 @@ namespace quda {
     template <typename Float, int length> struct TIFROrder : LegacyOrder<Float,length> {
       using Accessor = TIFROrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       Float *gauge;
       const unsigned int volumeCB;
       static constexpr int Nc = 3;
@@ -2266,7 +2266,7 @@ namespace quda {
     template <typename Float, int length> struct TIFRPaddedOrder : LegacyOrder<Float,length> {
       using Accessor = TIFRPaddedOrder<Float, length>;
       using real = typename mapper<Float>::type;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       Float *gauge;
       const unsigned int volumeCB;
       int exVolumeCB;
@@ -560,4 +560,59 @@ namespace quda {
     }
   }
 
+  /**
+   * Function to perform gauge fixing with overrelaxation with a single
+   * thread per lattice site, used for host execution.  The SU(2) hits
+   * are applied to the upward links, link[mu] = U_mu(x), and the
+   * downward links, link1[mu] = U_mu(x - mu), in registers, so no
+   * shared memory or thread synchronization is required.
+   */
+  template <typename Float, int gauge_dir, int nColor>
+  __host__ __device__ inline void GaugeFixHit_Site(Matrix<complex<Float>, nColor> link[4],
+                                                   Matrix<complex<Float>, nColor> link1[4], const Float relax_boost)
+  {
+    //Loop over all SU(2) subroups of SU(N)
+    for (int block = 0; block < (nColor * (nColor - 1) / 2); block++) {
+      int p, q;
+      //Get the two indices for the SU(N) matrix
+      IndexBlock<nColor>(block, p, q);
+      Float a0 = 0.0, a1 = 0.0, a2 = 0.0, a3 = 0.0;
+#pragma unroll
+      for (int mu = 0; mu < gauge_dir; mu++) {
+        a0 += link1[mu](p, p).x + link1[mu](q, q).x + link[mu](p, p).x + link[mu](q, q).x;
+        a1 += (link1[mu](p, q).y + link1[mu](q, p).y) - (link[mu](p, q).y + link[mu](q, p).y);
+        a2 += (link1[mu](p, q).x - link1[mu](q, p).x) - (link[mu](p, q).x - link[mu](q, p).x);
+        a3 += (link1[mu](p, p).y - link1[mu](q, q).y) - (link[mu](p, p).y - link[mu](q, q).y);
+      }
+      //Over-relaxation boost
+      Float asq = a1 * a1 + a2 * a2 + a3 * a3;
+      Float a0sq = a0 * a0;
+      Float x = (relax_boost * a0sq + asq) / (a0sq + asq);
+      Float r = quda::rsqrt((a0sq + x * x * asq));
+      a0 *= r;
+      a1 *= x * r;
+      a2 *= x * r;
+      a3 *= x * r;
+
+#pragma unroll
+      for (int mu = 0; mu < 4; mu++) {
+        complex<Float> m0;
+        //Do SU(2) hit on the upward link
+        //link <- u * link
+        for (int j = 0; j < nColor; j++) {
+          m0 = link[mu](p, j);
+          link[mu](p, j) = complex<Float>(a0, a3) * m0 + complex<Float>(a2, a1) * link[mu](q, j);
+          link[mu](q, j) = complex<Float>(-a2, a1) * m0 + complex<Float>(a0, -a3) * link[mu](q, j);
+        }
+        //Do SU(2) hit on the downward link
+        //link <- link * u_adj
+        for (int j = 0; j < nColor; j++) {
+          m0 = link1[mu](j, p);
+          link1[mu](j, p) = complex<Float>(a0, -a3) * m0 + complex<Float>(a2, -a1) * link1[mu](j, q);
+          link1[mu](j, q) = complex<Float>(-a2, -a1) * m0 + complex<Float>(a0, a3) * link1[mu](j, q);
+        }
+      }
+    } //FLOP per lattice site = (Nc * ( Nc - 1) / 2) * (22 + 28 gauge_dir + 224 Nc)
+  }
+
 }
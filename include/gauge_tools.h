@@ -49,6 +49,18 @@ namespace quda
   */
   void gaugeGauss(GaugeField &U, RNG &rngstate, double epsilon);
 
+  /**
+     @brief Generate Gaussian distributed su(N) or SU(N) fields using
+     a counter-based generator.  The field is independent of the
+     partitioning and is generated directly on the host for host
+     fields.  The call counter of the generator is advanced by one.
+
+     @param[out] U The output gauge field
+     @param[in,out] rng The counter-based generator
+     @param[in] sigma Width of Gaussian distrubution
+  */
+  void gaugeGauss(GaugeField &U, CounterRNG &rng, double epsilon);
+
   /**
      @brief Generate Gaussian distributed su(N) or SU(N) fields.  If U
      is a momentum field, then we generate random Gaussian distributed
@@ -62,8 +74,10 @@ namespace quda
      @param[out] U The GaugeField
      @param[in] seed The seed used for the RNG
      @param[in] sigma Wdith of the Gaussian distribution
+     @param[in] counter Whether to use the counter-based generator,
+     with a call counter of zero, rather than MRG32k3a
   */
-  void gaugeGauss(GaugeField &U, unsigned long long seed, double epsilon);
+  void gaugeGauss(GaugeField &U, unsigned long long seed, double epsilon, bool counter = false);
 
   /**
      @brief Generate a random noise gauge field.  This variant allows
@@ -78,16 +92,28 @@ namespace quda
   void gaugeNoise(GaugeField &U, RNG &rngstate, QudaNoiseType type);
 
   /**
-     @brief Generate a random noise gauge field.  This variant allows
-     the user to manage the RNG state.  Works with arbitrary colors
-     (e.g., coarse grids).  Always exectures on the device so if
-     handed a host field, the interface will handle copying to and
-     from the device.
+     @brief Generate a random noise gauge field using a counter-based
+     generator.  Works with arbitrary colors (e.g., coarse grids).
+     The field is independent of the partitioning, and host fields
+     are generated directly on the host.  The call counter of the
+     generator is advanced by one.
+     @param U The gauge field
+     @param rng The counter-based generator
+     @param type The type of noise to create (QUDA_NOISE_GAUSSIAN or QUDA_NOISE_UNIFORM)
+  */
+  void gaugeNoise(GaugeField &U, CounterRNG &rng, QudaNoiseType type);
+
+  /**
+     @brief Generate a random noise gauge field.  This variant just
+     requires a seed and will create and destroy the random number
+     state.  Works with arbitrary colors (e.g., coarse grids).
      @param U The gauge field
      @param seed The seed used for the RNG
      @param type The type of noise to create (QUDA_NOISE_GAUSSIAN or QUDA_NOISE_UNIFORM)
+     @param counter Whether to use the counter-based generator, with
+     a call counter of zero, rather than MRG32k3a
   */
-  void gaugeNoise(GaugeField &U, unsigned long long seed, QudaNoiseType type);
+  void gaugeNoise(GaugeField &U, unsigned long long seed, QudaNoiseType type, bool counter = false);
 
   /**
      @brief Apply APE smearing to the gauge field
@@ -131,6 +157,89 @@ namespace quda
   */
   void HYPStep(GaugeField &dataDs, GaugeField &dataOr, double alpha1, double alpha2, double alpha3, int dir_ignore);
 
+  /**
+     @brief Apply a single APE smearing step without any halo
+     exchange.  The output is computed on the interior of the
+     extended field together with the inner depth[d] layers of its
+     halo, so the input must be valid to depth[d] + 1 layers.
+     @param[out] out Output smeared field
+     @param[in] in Input gauge field
+     @param[in] alpha smearing parameter
+     @param[in] dir_ignore ignored direction
+     @param[in] depth Number of halo layers to update in each dimension
+  */
+  void APEStep(GaugeField &out, const GaugeField &in, double alpha, int dir_ignore, const lat_dim_t &depth);
+
+  /**
+     @brief Apply a single STOUT smearing step without any halo
+     exchange.  The output is computed on the interior of the
+     extended field together with the inner depth[d] layers of its
+     halo, so the input must be valid to depth[d] + 1 layers.
+     @param[out] out Output smeared field
+     @param[in] in Input gauge field
+     @param[in] rho smearing parameter
+     @param[in] dir_ignore ignored direction
+     @param[in] depth Number of halo layers to update in each dimension
+  */
+  void STOUTStep(GaugeField &out, const GaugeField &in, double rho, int dir_ignore, const lat_dim_t &depth);
+
+  /**
+     @brief Apply a single Over Improved STOUT smearing step without
+     any halo exchange.  The output is computed on the interior of the
+     extended field together with the inner depth[d] layers of its
+     halo, so the input must be valid to depth[d] + 2 layers.
+     @param[out] out Output smeared field
+     @param[in] in Input gauge field
+     @param[in] rho smearing parameter
+     @param[in] epsilon smearing parameter
+     @param[in] dir_ignore ignored direction
+     @param[in] depth Number of halo layers to update in each dimension
+  */
+  void OvrImpSTOUTStep(GaugeField &out, const GaugeField &in, double rho, double epsilon, int dir_ignore,
+                       const lat_dim_t &depth);
+
+  /**
+     @brief Apply a single HYP smearing step without any halo
+     exchange.  The output is computed on the interior of the
+     extended field together with the inner depth[d] layers of its
+     halo, with each of the intermediate levels computed on one more
+     layer than the next, so the input must be valid to depth[d] + 3
+     layers (depth[d] + 2 for 3-d smearing).
+     @param[out] out Output smeared field
+     @param[in] tmp Intermediate decorated link fields
+     @param[in] in Input gauge field
+     @param[in] alpha1 smearing parameter
+     @param[in] alpha2 smearing parameter
+     @param[in] alpha3 smearing parameter
+     @param[in] dir_ignore ignored direction
+     @param[in] depth Number of halo layers to update in each dimension
+  */
+  void HYPStep(GaugeField &out, GaugeField *tmp[4], const GaugeField &in, double alpha1, double alpha2, double alpha3,
+               int dir_ignore, const lat_dim_t &depth);
+
+  /**
+     @brief Return the number of halo layers consumed by a single
+     smearing step
+     @param[in] smear_type APE, STOUT, Over Improved STOUT or HYP, else error
+     @param[in] dir_ignore ignored direction
+  */
+  int gaugeSmearRadius(QudaGaugeSmearType smear_type, int dir_ignore);
+
+  /**
+     @brief Apply a number of APE, STOUT, Over Improved STOUT or HYP
+     smearing steps to the gauge field.  Rather than exchanging the
+     halo every step, each exchange is followed by as many steps as
+     the extended region of the field allows, with each step
+     computed on a shrinking part of the halo.  The field and the
+     temporary alternate as input and output.
+     @param[in,out] u Extended gauge field, whose interior is smeared
+     @param[in] tmp Temporary field with the same parameters as u
+     @param[in] param Smearing parameters
+     @param[in] n_steps Number of steps to apply
+     @param[in] dir_ignore ignored direction
+  */
+  void gaugeSmear(GaugeField &u, GaugeField &tmp, const QudaGaugeSmearParam &param, int n_steps, int dir_ignore);
+
   /**
      @brief Apply Wilson Flow steps W1, W2, Vt to the gauge field.
      This routine assumes that the input and output fields are
@@ -145,6 +254,24 @@ namespace quda
   */
   void WFlowStep(GaugeField &out, GaugeField &temp, GaugeField &in, double epsilon, QudaGaugeSmearType smear_type);
 
+  /**
+     @brief Apply Wilson Flow steps W1, W2, Vt to the gauge field,
+     together with the embedded second-order integrator that shares
+     the Z0 and Z1 stages, and return the local error estimate of the
+     step, the maximum absolute difference between the third- and
+     second-order solutions.  As with the non-adaptive step, the
+     input field is overwritten with the intermediate W2 stage.
+     @param[out] out Output smeared field
+     @param[in] temp Temp space
+     @param[out] embedded Temp space, on exit holds the difference between the two solutions
+     @param[in] in Input gauge field
+     @param[in] epsilon Step size
+     @param[in] smear_type Wilson (1x1) or Symanzik improved (2x1) staples, else error
+     @return The local error estimate
+  */
+  double WFlowStep(GaugeField &out, GaugeField &temp, GaugeField &embedded, GaugeField &in, double epsilon,
+                   QudaGaugeSmearType smear_type);
+
   /**
      @brief Apply intermediary Wilson Flow steps W1, W2 or Vt to the gauge field.
      This routine assumes that the input and output fields are
@@ -173,9 +300,15 @@ namespace quda
    * maximum number of steps defined by Nsteps
    * @param[in] reunit_interval, reunitarize gauge field when iteration count is a multiple of this
    * @param[in] stopWtheta, 0 for MILC criterion and 1 to use the theta value
+   * @param[in] quality_interval, compute the gauge fixing quality and
+   * check for convergence when iteration count is a multiple of this,
+   * in which case the Delta criterion is the change since the last check
+   * @param[in] tile, extent of the 4-d tiles in which the interior
+   * points of each parity are updated when executing on the host
    */
   void gaugeFixingOVR(GaugeField &data, const int gauge_dir, const int Nsteps, const int verbose_interval,
-                      const double relax_boost, const double tolerance, const int reunit_interval, const int stopWtheta);
+                      const double relax_boost, const double tolerance, const int reunit_interval, const int stopWtheta,
+                      const int quality_interval = 1, const int tile = 4);
 
   /**
    * @brief Gauge fixing with Steepest descent method with FFTs with support for single GPU only.
@@ -220,6 +353,25 @@ namespace quda
   */
   void computeQChargeDensity(double energy[3], double &qcharge, void *qdensity, const GaugeField &Fmunu);
 
+  /**
+     @brief Compute the plaquette, the field energy and the
+     topological charge, and optionally the topological charge
+     density, in a single pass over the gauge field.  The clover-leaf
+     field strength is computed at each site in registers, so no Fmunu
+     field is created, and the plaquette is obtained from the leaves
+     as a by-product.  The results match those of plaquette(),
+     computeFmunu() followed by computeQCharge() or
+     computeQChargeDensity().
+     @param[in] u The gauge field upon which to compute the observables
+     @param[out] plaq The total, spatial and temporal plaquette
+     @param[out] energy The total, spatial, and temporal field energy
+     @param[out] qcharge The total topological charge
+     @param[out] qdensity The topological charge at each lattice site,
+     in the precision of u, located with u (optional)
+  */
+  void gaugeObservablesFused(const GaugeField &u, double plaq[3], double energy[3], double &qcharge,
+                             void *qdensity = nullptr);
+
   /**
    * @brief Compute the trace of the Polyakov loop in a given dimension
    * @param[out] ploop The real and imaginary parts of the Polyakov loop
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+   @file halo_exchange.h
+
+   @section DESCRIPTION
+   Planner for host-side halo exchanges.  Callers register any number
+   of halo segments, possibly from many different fields, and then
+   execute the exchange.  All segments destined for the same neighbor
+   rank are aggregated into a single message, so that the number of
+   messages per exchange is bounded by the number of distinct
+   neighbors rather than by the number of fields times the number of
+   faces.  The aggregation buffers and persistent message handles are
+   cached by the layout of the exchange, and are reused whenever the
+   same layout is exchanged again.
+
+   The aggregated messages are exchanged either with point-to-point
+   messages, or with a single neighborhood collective over a
+   distributed-graph communicator.  The default backend is
+   point-to-point, with the neighborhood collective enabled by setting
+   QUDA_ENABLE_NEIGHBOR_COLLECTIVES=1.
+ */
+
+namespace quda
+{
+
+  namespace halo
+  {
+
+    /**
+       @brief The backend used to carry out the aggregated exchange
+    */
+    enum class Backend {
+      P2P,     /** Persistent point-to-point messages */
+      NEIGHBOR /** Neighborhood all-to-all collective */
+    };
+
+    /**
+       @brief A single halo segment.  The bytes at send are sent to the
+       neighbor in direction dir of dimension dim, and the matching
+       segment sent by the neighbor in the opposite direction is
+       received into recv.  In non-partitioned dimensions this
+       degenerates to a local copy from send to recv.
+    */
+    struct Segment {
+      int dim;      /** The dimension we are exchanging in */
+      int dir;      /** The direction we are sending in (0 - backwards, 1 - forwards) */
+      void *send;   /** The buffer we are sending from */
+      void *recv;   /** The buffer we are receiving into */
+      size_t bytes; /** The size of the segment in bytes */
+    };
+
+    /**
+       @brief Aggregated statistics of all halo exchanges carried out
+       through the planner
+    */
+    struct Stats {
+      size_t exchanges = 0; /** Number of exchanges executed */
+      size_t plans = 0;     /** Number of distinct exchange plans created */
+      size_t segments = 0;  /** Number of inter-process segments exchanged */
+      size_t messages = 0;  /** Number of (aggregated) messages sent */
+      size_t bytes = 0;     /** Number of bytes sent */
+    };
+
+    class Exchange
+    {
+      std::vector<Segment> segments;
+
+    public:
+      /**
+         @brief Register a halo segment with this exchange
+         @param[in] dim The dimension we are exchanging in
+         @param[in] dir The direction we are sending in (0 - backwards, 1 - forwards)
+         @param[in] send The buffer we are sending from
+         @param[in] recv The buffer we are receiving into
+         @param[in] bytes The size of the segment in bytes
+      */
+      void add(int dim, int dir, void *send, void *recv, size_t bytes);
+
+      /**
+         @brief Register a bidirectional halo exchange in a given
+         dimension: the backwards face is sent backwards and received
+         into the forwards ghost, and the forwards face is sent
+         forwards and received into the backwards ghost.
+         @param[in] dim The dimension we are exchanging in
+         @param[in] send_back The backwards face we are sending
+         @param[in] send_fwd The forwards face we are sending
+         @param[in] recv_back The backwards ghost we are receiving into
+         @param[in] recv_fwd The forwards ghost we are receiving into
+         @param[in] bytes The size of each face in bytes
+      */
+      void add_bidirectional(int dim, void *send_back, void *send_fwd, void *recv_back, void *recv_fwd, size_t bytes);
+
+      /**
+         @brief Carry out the exchange of all registered segments and
+         reset the exchange, such that it can be reused.  This is a
+         collective operation: all processes must register the same
+         sequence of segments.
+      */
+      void execute();
+
+      /**
+         @return The number of registered segments
+      */
+      size_t size() const { return segments.size(); }
+    };
+
+    /**
+       @return The backend used for subsequent exchanges
+    */
+    Backend get_backend();
+
+    /**
+       @brief Set the backend used for subsequent exchanges,
+       overriding the QUDA_ENABLE_NEIGHBOR_COLLECTIVES environment
+       variable.  This must be set consistently on all processes.
+       @param[in] backend The backend to use
+    */
+    void set_backend(Backend backend);
+
+    /**
+       @return The statistics of all halo exchanges executed so far
+    */
+    const Stats &get_stats();
+
+    /**
+       @brief Print the halo exchange statistics
+    */
+    void print_stats();
+
+    /**
+       @brief Free all cached exchange plans, together with their
+       buffers and message handles.  This must be called before the
+       communicator is finalized.
+    */
+    void destroy();
+
+  } // namespace halo
+
+} // namespace quda
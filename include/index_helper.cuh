@@ -1114,7 +1114,7 @@ namespace quda {
      @param[in] X Lattice dimensions
      @return The flattened 4-d index
    */
-  template <int reduction_dim, class T> __device__ int idx_from_t_xyz(int t, int xyz, T X[4])
+  template <int reduction_dim, class T> __device__ __host__ int idx_from_t_xyz(int t, int xyz, T X[4])
   {
     int x[4];
 #pragma unroll
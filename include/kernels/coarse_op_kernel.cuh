@@ -257,7 +257,7 @@ namespace quda {
     constexpr int uvSpin = Arg::fineSpin;
 
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::uvTileType;
     auto &tile = arg.uvTile;
     using Ctype = decltype(make_tile_C<complex, false>(tile));
@@ -333,7 +333,7 @@ namespace quda {
     constexpr int uvSpin = Arg::fineSpinorUV::nSpin;
 
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::uvTileType;
     auto &tile = arg.uvTile;
     using Ctype = decltype(make_tile_C<complex, false>(tile));
@@ -405,7 +405,7 @@ namespace quda {
     constexpr int uvSpin = Arg::fineSpinorUV::nSpin;
 
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::uvTileType;
     auto &tile = arg.uvTile;
     using Ctype = decltype(make_tile_C<complex, false>(tile));
@@ -525,7 +525,7 @@ namespace quda {
     constexpr int uvSpin = Arg::fineSpinorUV::nSpin;
 
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::uvTileType;
     auto &tile = arg.uvTile;
     using Ctype = decltype(make_tile_C<complex, false>(tile));
@@ -1066,7 +1066,7 @@ namespace quda {
   __device__ __host__ inline void multiplyVUV(Out &vuv, const Arg &arg, int parity, int x_cb, int i0, int j0)
   {
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::vuvTileType;
     auto &tile = arg.vuvTile;
 
@@ -1182,7 +1182,7 @@ namespace quda {
   multiplyVUV(Out &vuv, const Arg &arg, int parity, int x_cb, int i0, int j0)
   {
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::vuvTileType;
     auto &tile = arg.vuvTile;
 
@@ -1242,7 +1242,7 @@ namespace quda {
   multiplyVUV(Out &vuv, const Arg &arg, int parity, int x_cb, int i0, int j0)
   {
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::vuvTileType;
     auto &tile = arg.vuvTile;
 
@@ -1343,7 +1343,7 @@ namespace quda {
   multiplyVUV(Out &vuv, const Arg &arg, int parity, int x_cb, int i0, int j0)
   {
     using real = typename Arg::Float;
-    using complex = complex<real>;
+    using complex = quda::complex<real>;
     using TileType = typename Arg::vuvTileType;
     auto &tile = arg.vuvTile;
 
@@ -14,7 +14,7 @@ namespace quda
   using spinor_array = array<array<double, 2>, max_contract_results>;
   using staggered_spinor_array = array<double, 2>;
 
-  template <int reduction_dim, class T> __device__ void sink_from_t_xyz(int sink[4], int t, int xyz, T X[4])
+  template <int reduction_dim, class T> __device__ __host__ void sink_from_t_xyz(int sink[4], int t, int xyz, T X[4])
   {
 #pragma unroll
     for (int d = 0; d < 4; d++) {
@@ -27,7 +27,7 @@ namespace quda
     return;
   }
 
-  template <class T> __device__ int idx_from_sink(T X[4], int *sink)
+  template <class T> __device__ __host__ int idx_from_sink(T X[4], int *sink)
   {
     return ((sink[3] * X[2] + sink[2]) * X[1] + sink[1]) * X[0] + sink[0];
   }
@@ -457,4 +457,86 @@ namespace quda
       arg.s.save(A, x_cb, parity);
     }
   };
+
+  constexpr unsigned long max_contract_nx = 8;
+  constexpr unsigned long max_contract_ny = 8;
+  constexpr unsigned long max_contract_k = 64; // maximum number of spin-matrix elements per site in a tile
+
+  template <typename Float, int nColor_, int nSpin_, int reduction_dim_> struct ContractionSpinMatrixArg : kernel_param<> {
+    static constexpr int reduction_dim = reduction_dim_;
+    using real = typename mapper<Float>::type;
+    static constexpr int nColor = nColor_;
+    static constexpr int nSpin = nSpin_;
+    static constexpr bool spin_project = nSpin_ == 1 ? false : true;
+    static constexpr bool spinor_direct_load = false; // false means texture load
+
+    using F = typename colorspinor_mapper<Float, nSpin, nColor, spin_project, spinor_direct_load>::type;
+
+    F x[max_contract_nx];
+    F y[max_contract_ny];
+    int nx;
+    int ny;
+    int n_slice;       // number of local slices in the reduction dimension
+    int_fastdiv V3;    // number of sites in each slice
+    int_fastdiv X[4];  // grid dimensions
+    complex<Float> *M; // output spin matrices, ordered as [xyz][slice][i][j][s1][s2]
+
+    ContractionSpinMatrixArg(cvector_ref<const ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &y,
+                             complex<Float> *M) :
+      kernel_param(dim3(x.Volume(), x.size(), 1)),
+      nx(x.size()),
+      ny(y.size()),
+      n_slice(x.X(reduction_dim)),
+      V3(x.Volume() / x.X(reduction_dim)),
+      M(M)
+    {
+      if (x.size() > max_contract_nx)
+        errorQuda("Requested vector size %lu greater than max %lu", x.size(), max_contract_nx);
+      if (y.size() > max_contract_ny)
+        errorQuda("Requested vector size %lu greater than max %lu", y.size(), max_contract_ny);
+      for (int i = 0; i < 4; i++) X[i] = x.X(i);
+      for (auto i = 0u; i < x.size(); i++) this->x[i] = x[i];
+      for (auto j = 0u; j < y.size(); j++) this->y[j] = y[j];
+    }
+  };
+
+  /**
+     Computes the color-contracted open spin matrices
+     M_{s1 s2} = \sum_c conj(x_i(s1,c)) y_j(s2,c) for all pairs (i,j)
+     of a tile.  The output of a given spatial site holds every local
+     slice, so that the momentum projection of the tile is a single
+     GEMM with a phase table over the spatial sites.
+   */
+  template <typename Arg> struct ColorContractSpinMatrix {
+    const Arg &arg;
+    constexpr ColorContractSpinMatrix(const Arg &arg) : arg(arg) { }
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int t_xyz, int i)
+    {
+      constexpr int nSpin = Arg::nSpin;
+      using real = typename Arg::real;
+      using Vector = ColorSpinor<real, Arg::nColor, nSpin>;
+
+      int t = t_xyz / arg.V3;
+      int xyz = t_xyz - t * arg.V3;
+
+      int parity = 0;
+      int idx = idx_from_t_xyz<Arg::reduction_dim>(t, xyz, arg.X);
+      int idx_cb = getParityCBFromFull(parity, arg.X, idx);
+      Vector x = arg.x[i](idx_cb, parity);
+
+      auto M = arg.M + ((static_cast<size_t>(xyz) * arg.n_slice + t) * arg.nx + i) * arg.ny * nSpin * nSpin;
+      for (int j = 0; j < arg.ny; j++) {
+        Vector y = arg.y[j](idx_cb, parity);
+#pragma unroll
+        for (int s1 = 0; s1 < nSpin; s1++) {
+#pragma unroll
+          for (int s2 = 0; s2 < nSpin; s2++) {
+            M[(j * nSpin + s1) * nSpin + s2] = innerProduct(x, y, s1, s2);
+          }
+        }
+      }
+    }
+  };
 } // namespace quda
@@ -248,61 +248,70 @@ namespace quda
     constexpr pack_wilson(const Arg &arg) : arg(arg) { }
     static constexpr const char *filename() { return KERNEL_FILE; }
 
-    __device__ inline void operator()(int, int src_s, int parity)
+    /**
+       @brief Pack the face site with linear face index tid
+       @param[in] tid Linear face index over all packed dimensions and directions
+       @param[in] src_idx Source index
+       @param[in] s Fifth-dimension index
+       @param[in] parity Site parity
+     */
+    __device__ __host__ inline void pack_site(int tid, int src_idx, int s, int parity)
     {
-      int local_tid = target::thread_idx().x;
-      int tid = arg.sites_per_block * target::block_idx().x + local_tid;
+      // determine which dimension we are packing
+      int ghost_idx;
+      const int dim = dimFromFaceIndex(ghost_idx, tid, arg);
 
+      if (Arg::pc_type == QUDA_5D_PC) { // 5-d checkerboarded, include s (not ghostFaceCB since both faces)
+        switch (dim) {
+        case 0:
+          pack<Arg::dagger, Arg::twist, 0, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[0], 0,
+                                                                          parity, src_idx);
+          break;
+        case 1:
+          pack<Arg::dagger, Arg::twist, 1, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[1], 0,
+                                                                          parity, src_idx);
+          break;
+        case 2:
+          pack<Arg::dagger, Arg::twist, 2, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[2], 0,
+                                                                          parity, src_idx);
+          break;
+        case 3:
+          pack<Arg::dagger, Arg::twist, 3, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[3], 0,
+                                                                          parity, src_idx);
+          break;
+        }
+      } else { // 4-d checkerboarding, keeping s separate (if it exists)
+        switch (dim) {
+        case 0: pack<Arg::dagger, Arg::twist, 0, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx); break;
+        case 1: pack<Arg::dagger, Arg::twist, 1, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx); break;
+        case 2: pack<Arg::dagger, Arg::twist, 2, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx); break;
+        case 3: pack<Arg::dagger, Arg::twist, 3, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx); break;
+        }
+      }
+    }
+
+    __device__ inline void operator()(int x, int src_s, int parity)
+    {
       int src_idx = src_s / arg.Ls;
       int s = src_s % arg.Ls;
 
       // this is the parity used for load/store, but we use arg.parity for index mapping
       if (arg.nParity == 1) parity = arg.parity;
 
-      while (local_tid < arg.sites_per_block && tid < arg.work_items) {
-        // determine which dimension we are packing
-        int ghost_idx;
-        const int dim = dimFromFaceIndex(ghost_idx, tid, arg);
-
-        if (Arg::pc_type == QUDA_5D_PC) { // 5-d checkerboarded, include s (not ghostFaceCB since both faces)
-          switch (dim) {
-          case 0:
-            pack<Arg::dagger, Arg::twist, 0, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[0], 0,
-                                                                            parity, src_idx);
-            break;
-          case 1:
-            pack<Arg::dagger, Arg::twist, 1, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[1], 0,
-                                                                            parity, src_idx);
-            break;
-          case 2:
-            pack<Arg::dagger, Arg::twist, 2, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[2], 0,
-                                                                            parity, src_idx);
-            break;
-          case 3:
-            pack<Arg::dagger, Arg::twist, 3, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx + s * arg.dc.ghostFace[3], 0,
-                                                                            parity, src_idx);
-            break;
-          }
-        } else { // 4-d checkerboarding, keeping s separate (if it exists)
-          switch (dim) {
-          case 0:
-            pack<Arg::dagger, Arg::twist, 0, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx);
-            break;
-          case 1:
-            pack<Arg::dagger, Arg::twist, 1, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx);
-            break;
-          case 2:
-            pack<Arg::dagger, Arg::twist, 2, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx);
-            break;
-          case 3:
-            pack<Arg::dagger, Arg::twist, 3, Arg::pc_type, Arg::n_src_tile>(arg, ghost_idx, s, parity, src_idx);
-            break;
-          }
-        }
-
-        local_tid += target::block_dim().x;
-        tid += target::block_dim().x;
-      } // while tid
+      if (target::is_device()) {
+        // each block packs a contiguous chunk of sites_per_block face sites
+        int local_tid = target::thread_idx().x;
+        int tid = arg.sites_per_block * target::block_idx().x + local_tid;
+
+        while (local_tid < arg.sites_per_block && tid < arg.work_items) {
+          pack_site(tid, src_idx, s, parity);
+          local_tid += target::block_dim().x;
+          tid += target::block_dim().x;
+        } // while tid
+      } else {
+        // on the host each call is a single thread, so stride over the face sites
+        for (int tid = x; tid < arg.work_items; tid += arg.threads.x) pack_site(tid, src_idx, s, parity);
+      }
     }
   };
 
@@ -423,37 +432,54 @@ namespace quda
     constexpr pack_staggered(const Arg &arg) : arg(arg) { }
     static constexpr const char *filename() { return KERNEL_FILE; }
 
-    __device__ inline void operator()(int, int src_idx, int parity)
+    /**
+       @brief Pack the face site with linear face index tid
+       @param[in] tid Linear face index over all packed dimensions and directions
+       @param[in] src_idx Source index
+       @param[in] parity Site parity
+     */
+    __device__ __host__ inline void pack_site(int tid, int src_idx, int parity)
     {
-      int local_tid = target::thread_idx().x;
-      int tid = arg.sites_per_block * target::block_idx().x + local_tid;
-      // this is the parity used for load/store, but we use arg.parity for index mapping
-      if (arg.nParity == 1) parity = arg.parity;
+      // determine which dimension we are packing
+      int ghost_idx;
+      const int dim = dimFromFaceIndex(ghost_idx, tid, arg);
 
-      while (local_tid < arg.sites_per_block && tid < arg.work_items) {
-        // determine which dimension we are packing
-        int ghost_idx;
-        const int dim = dimFromFaceIndex(ghost_idx, tid, arg);
-
-        if (arg.nFace == 1) {
-          switch (dim) {
-          case 0: packStaggered<0, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          case 1: packStaggered<1, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          case 2: packStaggered<2, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          case 3: packStaggered<3, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          }
-        } else if (arg.nFace == 3) {
-          switch (dim) {
-          case 0: packStaggered<0, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          case 1: packStaggered<1, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          case 2: packStaggered<2, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          case 3: packStaggered<3, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
-          }
+      if (arg.nFace == 1) {
+        switch (dim) {
+        case 0: packStaggered<0, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
+        case 1: packStaggered<1, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
+        case 2: packStaggered<2, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
+        case 3: packStaggered<3, 1, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
         }
+      } else if (arg.nFace == 3) {
+        switch (dim) {
+        case 0: packStaggered<0, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
+        case 1: packStaggered<1, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
+        case 2: packStaggered<2, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
+        case 3: packStaggered<3, 3, Arg::n_src_tile>(arg, ghost_idx, parity, src_idx); break;
+        }
+      }
+    }
+
+    __device__ inline void operator()(int x, int src_idx, int parity)
+    {
+      // this is the parity used for load/store, but we use arg.parity for index mapping
+      if (arg.nParity == 1) parity = arg.parity;
 
-        local_tid += target::block_dim().x;
-        tid += target::block_dim().x;
-      } // while tid
+      if (target::is_device()) {
+        // each block packs a contiguous chunk of sites_per_block face sites
+        int local_tid = target::thread_idx().x;
+        int tid = arg.sites_per_block * target::block_idx().x + local_tid;
+
+        while (local_tid < arg.sites_per_block && tid < arg.work_items) {
+          pack_site(tid, src_idx, parity);
+          local_tid += target::block_dim().x;
+          tid += target::block_dim().x;
+        } // while tid
+      } else {
+        // on the host each call is a single thread, so stride over the face sites
+        for (int tid = x; tid < arg.work_items; tid += arg.threads.x) pack_site(tid, src_idx, parity);
+      }
     }
   };
 
@@ -20,14 +20,15 @@ namespace quda
     Gauge out;
     const Gauge in;
 
-    int X[4]; // grid dimensions
+    int X[4]; // dimensions of the region being updated
     int border[4];
+    int parity_shift = 0; // parity offset between the region being updated and the extended field
     const Float alpha;
     const int dir_ignore;
     const Float tolerance;
 
-    GaugeAPEArg(GaugeField &out, const GaugeField &in, double alpha, int dir_ignore) :
-      kernel_param(dim3(in.LocalVolumeCB(), 2, apeDim)),
+    GaugeAPEArg(GaugeField &out, const GaugeField &in, double alpha, int dir_ignore, const lat_dim_t &depth) :
+      kernel_param(dim3(1, 2, apeDim)),
       out(out),
       in(in),
       alpha(alpha),
@@ -35,9 +36,12 @@ namespace quda
       tolerance(in.toleranceSU3())
     {
       for (int dir = 0; dir < 4; ++dir) {
-        border[dir] = in.R()[dir];
+        border[dir] = in.R()[dir] - depth[dir];
         X[dir] = in.X()[dir] - border[dir] * 2;
+        this->threads.x *= X[dir];
+        parity_shift ^= depth[dir] & 1;
       }
+      this->threads.x /= 2;
     }
   };
 
@@ -58,6 +62,7 @@ namespace quda
       for (int dr = 0; dr < 4; ++dr) X[dr] = arg.X[dr];
       int x[4];
       getCoords(x, x_cb, X, parity);
+      parity ^= arg.parity_shift;
       for (int dr = 0; dr < 4; ++dr) {
         x[dr] += arg.border[dr];
         X[dr] += 2 * arg.border[dr];
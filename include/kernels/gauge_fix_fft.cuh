@@ -29,10 +29,14 @@ namespace quda {
     int_fastdiv X[4];     // grid dimensions
     complex<Float> *tmp0;
     complex<Float> *tmp1;
-    GaugeFixFFTRotateArg(const GaugeField &data, complex<Float> *tmp0, complex<Float> *tmp1) :
+    int volume;
+    int n_batch; // number of consecutive lattice-sized arrays to rotate
+    GaugeFixFFTRotateArg(const GaugeField &data, complex<Float> *tmp0, complex<Float> *tmp1, int n_batch) :
       kernel_param(dim3(data.Volume(), 1, 1)),
       tmp0(tmp0),
-      tmp1(tmp1)
+      tmp1(tmp1),
+      volume(data.Volume()),
+      n_batch(n_batch)
     {
       for (int d = 0; d < 4; d++) X[d] = data.X()[d];
     }
@@ -54,7 +58,7 @@ namespace quda {
 
         int id = x0 + (x1 + (x2 + x3 * arg.X[2]) * arg.X[1]) * arg.X[0];
         int id_out = x2 + (x3 + (x0 + x1 * arg.X[0]) * arg.X[3]) * arg.X[2];
-        arg.tmp1[id_out] = arg.tmp0[id];
+        for (int k = 0; k < arg.n_batch; k++) arg.tmp1[id_out + k * arg.volume] = arg.tmp0[id + k * arg.volume];
       }
 
       if (arg.dir == 1) {
@@ -65,7 +69,7 @@ namespace quda {
 
         int id = x2 + (x3 + (x0 + x1 * arg.X[0]) * arg.X[3]) * arg.X[2];
         int id_out = x0 + (x1 + (x2 + x3 * arg.X[2]) * arg.X[1]) * arg.X[0];
-        arg.tmp1[id_out] = arg.tmp0[id];
+        for (int k = 0; k < arg.n_batch; k++) arg.tmp1[id_out + k * arg.volume] = arg.tmp0[id + k * arg.volume];
       }
     }
   };
@@ -82,28 +86,47 @@ namespace quda {
     complex<Float> *gx;
     Float alpha;
     int volume;
+    int n_batch; // number of components of Delta transformed at once
+    bool host;
 
-    GaugeFixArg(GaugeField &data, double alpha) :
+    /**
+       @param[in] data The gauge field being fixed
+       @param[in] alpha The steepest descent parameter
+       @param[in] n_batch The number of components of Delta
+       transformed together, either 1 or all 6
+    */
+    GaugeFixArg(GaugeField &data, double alpha, int n_batch) :
       kernel_param(dim3(data.VolumeCB(), 2, 1)),
       data(data),
       alpha(static_cast<Float>(alpha)),
-      volume(data.Volume())
+      volume(data.Volume()),
+      n_batch(n_batch),
+      host(data.Location() == QUDA_CPU_FIELD_LOCATION)
     {
       for (int dir = 0; dir < 4; ++dir ) X[dir] = data.X()[dir];
-      invpsq = (Float*)device_malloc(sizeof(Float) * volume);
-      delta = (complex<Float>*)device_malloc(sizeof(complex<Float>) * volume * 6);
 #ifdef GAUGEFIXING_DONT_USE_GX
-      gx = (complex<Float>*)device_malloc(sizeof(complex<Float>) * volume);
+      size_t gx_elems = n_batch;
 #else
-      gx = (complex<Float>*)device_malloc(sizeof(complex<Float>) * volume * elems);
+      size_t gx_elems = std::max(n_batch, elems);
 #endif
+      invpsq = static_cast<Float *>(allocate(sizeof(Float) * volume));
+      delta = static_cast<complex<Float> *>(allocate(sizeof(complex<Float>) * volume * 6));
+      gx = static_cast<complex<Float> *>(allocate(sizeof(complex<Float>) * volume * gx_elems));
     }
 
+    void *allocate(size_t bytes) const { return host ? safe_malloc(bytes) : device_malloc(bytes); }
+
     void free()
     {
-      device_free(invpsq);
-      device_free(delta);
-      device_free(gx);
+      if (host) {
+        host_free(invpsq);
+        host_free(delta);
+        host_free(gx);
+      } else {
+        device_free(invpsq);
+        device_free(delta);
+        device_free(gx);
+      }
     }
   };
 
@@ -142,7 +165,7 @@ namespace quda {
     __device__ __host__ inline void operator()(int x_cb, int parity)
     {
       int id = parity * arg.threads.x + x_cb;
-      arg.gx[id] = arg.gx[id] * arg.invpsq[id];
+      for (int k = 0; k < arg.n_batch; k++) arg.gx[id + k * arg.volume] = arg.gx[id + k * arg.volume] * arg.invpsq[id];
     }
   };
 
@@ -278,7 +301,7 @@ namespace quda {
     __device__ __host__ void operator()(int x_cb, int parity)
     {
       using Float = typename Arg::Float;
-      using complex = complex<Float>;
+      using complex = quda::complex<Float>;
       using matrix = Matrix<complex, 3>;
 
       int x[4];
@@ -343,7 +366,7 @@ namespace quda {
 
     __device__ __host__ inline void operator()(int x_cb, int parity)
     {
-      using complex = complex<typename Arg::Float>;
+      using complex = quda::complex<typename Arg::Float>;
       using matrix = Matrix<complex, 3>;
 
       int x[4];
@@ -386,7 +409,7 @@ namespace quda {
 
     __device__ __host__ inline void operator()(int x_cb, int parity)
     {
-      using complex = complex<typename Arg::Float>;
+      using complex = quda::complex<typename Arg::Float>;
       using matrix = Matrix<complex, 3>;
 
       int x[4];
@@ -223,6 +223,111 @@ namespace quda {
     }
   };
 
+  /**
+   * @brief container to pass parameters for the gauge fixing kernel
+   * with one thread per lattice site, used for host execution.  The
+   * interior points are traversed in 4-d tiles, with the points of a
+   * given parity in each tile assigned to consecutive threads.
+   */
+  template <typename store_t, QudaReconstructType recon, int gauge_dir_, bool halo_>
+  struct GaugeFixSiteArg : kernel_param<> {
+    using real = typename mapper<store_t>::type;
+    static constexpr int gauge_dir = gauge_dir_;
+    static constexpr bool halo = halo_;
+    typename gauge_mapper<store_t, recon>::type u;
+    const real relax_boost;
+    int parity;
+    int X[4]; // grid dimensions
+    int border[4];
+    int tile[4];   // tile dimensions
+    int n_tile[4]; // number of tiles in each dimension
+    int tile_volume_cb;
+    int *borderpoints[2];
+
+    GaugeFixSiteArg(const GaugeField &u, const double relax_boost, int parity, int *borderpoints[2], unsigned threads,
+                    const lat_dim_t &tile) :
+      kernel_param(dim3(threads, 1, 1)),
+      u(u),
+      relax_boost(static_cast<real>(relax_boost)),
+      parity(parity),
+      tile_volume_cb(1),
+      borderpoints {borderpoints[0], borderpoints[1]}
+    {
+      for (int dir = 0; dir < 4; dir++) {
+        border[dir] = halo ? u.R()[dir] : comm_dim_partitioned(dir) ? u.R()[dir] + 1 : 0;
+        X[dir] = u.X()[dir] - border[dir] * 2;
+        this->tile[dir] = halo ? X[dir] : tile[dir];
+        n_tile[dir] = X[dir] / this->tile[dir];
+        tile_volume_cb *= this->tile[dir];
+      }
+      tile_volume_cb /= 2;
+    }
+  };
+
+  /**
+   * @brief Perform gauge fixing with overrelaxation with one thread
+   * per lattice site, so the y thread dimension is trivial
+   */
+  template <typename Arg> struct computeFixSite {
+    const Arg &arg;
+    constexpr computeFixSite(const Arg &arg) : arg(arg) {}
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    __device__ __host__ inline void operator()(int idx, int)
+    {
+      using real = typename Arg::real;
+      using Link = Matrix<complex<real>, 3>;
+      int parity = arg.parity;
+
+      int X[4], x[4];
+#pragma unroll
+      for (int dr = 0; dr < 4; dr++) X[dr] = arg.X[dr];
+
+      if (!Arg::halo) {
+        // find the origin of the tile, then the point of this parity within it
+        int tile = idx / arg.tile_volume_cb;
+        int p = 0;
+#pragma unroll
+        for (int dr = 0; dr < 4; dr++) {
+          x[dr] = (tile % arg.n_tile[dr]) * arg.tile[dr];
+          tile /= arg.n_tile[dr];
+          p += x[dr] + arg.border[dr];
+        }
+        int y[4];
+        getCoords(y, idx % arg.tile_volume_cb, arg.tile, (p + parity) & 1);
+#pragma unroll
+        for (int dr = 0; dr < 4; dr++) x[dr] += y[dr];
+      } else {
+        idx = arg.borderpoints[parity][idx]; // load the lattice site assigment
+        x[3] = idx / (X[0] * X[1] * X[2]);
+        x[2] = (idx / (X[0] * X[1])) % X[2];
+        x[1] = (idx / X[0]) % X[1];
+        x[0] = idx % X[0];
+      }
+
+#pragma unroll
+      for (int dr = 0; dr < 4; dr++) {
+        x[dr] += arg.border[dr];
+        X[dr] += 2 * arg.border[dr];
+      }
+
+      Link link[4], link1[4];
+#pragma unroll
+      for (int mu = 0; mu < 4; mu++) {
+        link[mu] = arg.u(mu, linkIndex(x, X), parity);
+        link1[mu] = arg.u(mu, linkIndexM1(x, X, mu), 1 - parity);
+      }
+
+      GaugeFixHit_Site<real, Arg::gauge_dir, 3>(link, link1, arg.relax_boost);
+
+#pragma unroll
+      for (int mu = 0; mu < 4; mu++) {
+        arg.u(mu, linkIndex(x, X), parity) = link[mu];
+        arg.u(mu, linkIndexM1(x, X, mu), 1 - parity) = link1[mu];
+      }
+    }
+  };
+
   template <typename store_t_, QudaReconstructType recon, bool pack_, bool top_>
   struct GaugeFixPackArg : kernel_param<> {
     using store_t = store_t_;
@@ -313,7 +418,7 @@ namespace quda {
         parity = 1 - parity;
       }
       int id = (((x[3] * X[2] + x[2]) * X[1] + x[1]) * X[0] + x[0]) >> 1;
-      using complex = complex<typename Arg::store_t>;
+      using complex = quda::complex<typename Arg::store_t>;
       typename Arg::real tmp[Arg::NElems];
       complex data[9];
       if (Arg::pack) {
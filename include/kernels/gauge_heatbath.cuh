@@ -3,6 +3,7 @@
 #include <index_helper.cuh>
 #include <atomic_helper.h>
 #include <random_helper.h>
+#include <random_helper_host.h>
 #include <kernel.h>
 
 namespace quda {
@@ -72,17 +73,17 @@ namespace quda {
     @brief Generate full SU(2) matrix (four real numbers instead of 2x2 complex matrix) and update link matrix.
     Get from MILC code.
     @param al weight
-    @param localstate CURAND rng state
+    @param localstate CURAND rng state, or host rng state
  */
-  template <class T>
-  __device__ inline Matrix<T,2> generate_su2_matrix_milc(T al, RNGState& localState)
+  template <class T, class State>
+  __host__ __device__ inline Matrix<T,2> generate_su2_matrix_milc(T al, State& localState)
   {
-    T xr1 = uniform<T>::rand(localState);
+    T xr1 = uniform_rand<T>(localState);
     xr1 = (log((xr1 + static_cast<T>(1.e-10))));
-    T xr2 = uniform<T>::rand(localState);
+    T xr2 = uniform_rand<T>(localState);
     xr2 = (log((xr2 + static_cast<T>(1.e-10))));
-    T xr3 = uniform<T>::rand(localState);
-    T xr4 = uniform<T>::rand(localState);
+    T xr3 = uniform_rand<T>(localState);
+    T xr4 = uniform_rand<T>(localState);
     xr3 = cospi(static_cast<T>(2.0) * xr3);
     T d = -(xr2 + xr1 * xr3 * xr3 ) / al;
     //now  beat each  site into submission
@@ -92,12 +93,12 @@ namespace quda {
 #pragma unroll
       for (int k = 0; k < 20; k++) {
         //get four random numbers (add a small increment to prevent taking log(0.)
-        xr1 = uniform<T>::rand(localState);
+        xr1 = uniform_rand<T>(localState);
         xr1 = (log((xr1 + 1.e-10)));
-        xr2 = uniform<T>::rand(localState);
+        xr2 = uniform_rand<T>(localState);
         xr2 = (log((xr2 + 1.e-10)));
-        xr3 = uniform<T>::rand(localState);
-        xr4 = uniform<T>::rand(localState);
+        xr3 = uniform_rand<T>(localState);
+        xr4 = uniform_rand<T>(localState);
         xr3 = cospi(static_cast<T>(2.0) * xr3);
         d = -(xr2 + xr1 * xr3 * xr3) / al;
         if ((1.00 - 0.5 * d) > xr4 * xr4 ) break;
@@ -111,8 +112,8 @@ namespace quda {
 #pragma unroll
       for (int k = 0; k < 20; k++) {
         //get two random numbers
-        xr1 = uniform<T>::rand(localState);
-        xr2 = uniform<T>::rand(localState);
+        xr1 = uniform_rand<T>(localState);
+        xr2 = uniform_rand<T>(localState);
         r = xr3 + xr4 * xr1;
         a(0,0) = 1.00 + log(r) / al;
         if ((1.0 - a(0,0) * a(0,0)) > xr2 * xr2) break;
@@ -127,13 +128,13 @@ namespace quda {
     xr3 = abs(xr3);
     r = sqrt(xr3);
     //compute a3
-    a(1,1) = (2.0 * uniform<T>::rand(localState) - 1.0) * r;
+    a(1,1) = (2.0 * uniform_rand<T>(localState) - 1.0) * r;
     //compute a1 and a2
     xr1 = xr3 - a(1,1) * a(1,1);
     xr1 = abs(xr1);
     xr1 = sqrt(xr1);
     //xr2 is a random number between 0 and 2*pi
-    xr2 = static_cast<T>(2.0) * uniform<T>::rand(localState);
+    xr2 = static_cast<T>(2.0) * uniform_rand<T>(localState);
     T tmp[2];
     sincospi(xr2, &tmp[1], &tmp[0]);
     a(0,1) = xr1 * tmp[0];
@@ -292,11 +293,11 @@ namespace quda {
     @brief Link update by pseudo-heatbath
     @param U link to be updated
     @param F staple
-    @param localstate CURAND rng state
+    @param localstate CURAND rng state, or host rng state
   */
-  template <class Float, int nColor>
-  __device__ inline void heatBathSUN( Matrix<complex<Float>,nColor>& U, Matrix<complex<Float>,nColor> F,
-                                      RNGState& localState, Float BetaOverNc )
+  template <class Float, int nColor, class State>
+  __host__ __device__ inline void heatBathSUN( Matrix<complex<Float>,nColor>& U, Matrix<complex<Float>,nColor> F,
+                                               State& localState, Float BetaOverNc )
   {
     if (nColor == 3) {
       //////////////////////////////////////////////////////////////////
@@ -432,7 +433,7 @@ namespace quda {
      @param F staple
    */
   template <class Float, int nColor>
-  __device__ inline void overrelaxationSUN( Matrix<complex<Float>,nColor>& U, Matrix<complex<Float>,nColor> F )
+  __host__ __device__ inline void overrelaxationSUN( Matrix<complex<Float>,nColor>& U, Matrix<complex<Float>,nColor> F )
   {
     if (nColor == 3) {
       //////////////////////////////////////////////////////////////////
@@ -572,21 +573,22 @@ namespace quda {
     }
   }
 
-  template <typename Float_, int nColor_, QudaReconstructType recon, bool heatbath_>
+  template <typename Float_, int nColor_, QudaReconstructType recon, bool heatbath_, typename rng_t = RNGState>
   struct MonteArg : kernel_param<> {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     using Gauge = typename gauge_mapper<Float, recon>::type;
     static constexpr bool heatbath = heatbath_;
+    using State = rng_t; // RNGState on the device, HostRNGState on the host
 
     int X[4];       // grid dimensions
     int border[4];
     Gauge dataOr;
     Float BetaOverNc;
-    RNGState *rng;
+    State *rng;
     int mu;
     int parity;
-    MonteArg(GaugeField &data, Float Beta, RNGState *rng, int mu, int parity) :
+    MonteArg(GaugeField &data, Float Beta, State *rng, int mu, int parity) :
       kernel_param(dim3(data.LocalVolumeCB(), 1, 1)),
       dataOr(data),
       rng(rng),
@@ -653,7 +655,7 @@ namespace quda {
         }
       U = arg.dataOr(mu, e_cb, parity);
       if (Arg::heatbath) {
-        RNGState localState = arg.rng[x_cb];
+        typename Arg::State localState = arg.rng[x_cb];
         heatBathSUN( U, conj(staple), localState, arg.BetaOverNc );
         arg.rng[x_cb] = localState;
       } else {
@@ -24,14 +24,16 @@ namespace quda
     const Gauge in;
 
     int_fastdiv E[4]; // extended grid dimensions
-    int_fastdiv X[4]; // grid dimensions
+    int_fastdiv X[4]; // dimensions of the region being updated
     int border[4];
+    int parity_shift = 0; // parity offset between the region being updated and the extended field
     const Float alpha;
     const int dir_ignore;
     const Float tolerance;
 
-    GaugeHYPArg(GaugeField &out, GaugeField *tmp[4], const GaugeField &in, double alpha, int dir_ignore) :
-      kernel_param(dim3(in.LocalVolumeCB(), 2, hypDim)),
+    GaugeHYPArg(GaugeField &out, GaugeField *tmp[4], const GaugeField &in, double alpha, int dir_ignore,
+                const lat_dim_t &depth) :
+      kernel_param(dim3(1, 2, hypDim)),
       out(out),
       tmp {*tmp[0], *tmp[1], *tmp[2], *tmp[3]},
       in(in),
@@ -40,10 +42,13 @@ namespace quda
       tolerance(in.toleranceSU3())
     {
       for (int dir = 0; dir < 4; ++dir) {
-        border[dir] = in.R()[dir];
+        border[dir] = in.R()[dir] - depth[dir];
         E[dir] = in.X()[dir];
         X[dir] = in.X()[dir] - border[dir] * 2;
+        this->threads.x *= X[dir];
+        parity_shift ^= depth[dir] & 1;
       }
+      this->threads.x /= 2;
     }
   };
 
@@ -212,6 +217,7 @@ namespace quda
       // compute spacetime and local coords
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
+      parity ^= arg.parity_shift;
 #pragma unroll
       for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
 
@@ -317,6 +323,7 @@ namespace quda
       // compute spacetime and local coords
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
+      parity ^= arg.parity_shift;
 #pragma unroll
       for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
 
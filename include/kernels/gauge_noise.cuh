@@ -2,16 +2,19 @@
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
 #include <random_helper.h>
+#include <random_helper_host.h>
 #include <kernel.h>
 
 namespace quda {
 
-  template <typename Float_, int nColor_, QudaNoiseType noise_>
+  template <typename Float_, int nColor_, QudaNoiseType noise_, typename rng_t = RNGState>
   struct GaugeNoiseArg : kernel_param<> {
     using Float = Float_;
     using real = typename mapper<Float>::type;
     static constexpr int nColor = nColor_;
     static constexpr QudaNoiseType noise = noise_;
+    using State = rng_t;
+    static constexpr bool counter = std::is_same_v<State, CounterRNGState>;
     using Gauge = gauge::FieldOrder<real, nColor, 1, QUDA_FLOAT2_GAUGE_ORDER, true, real>;
 
     int geometry;
@@ -19,7 +22,8 @@ namespace quda {
     int X[4]; // true grid dimensions
     int border[4];
     Gauge U;
-    RNGState *rng;
+    RNGState *rng = nullptr;
+    CounterRNGSite site;
     real sigma; // where U = exp(sigma * H)
 
     GaugeNoiseArg(const GaugeField &U, RNGState *rng) :
@@ -34,24 +38,37 @@ namespace quda {
         X[dir] = U.X()[dir] - border[dir] * 2;
       }
     }
+
+    GaugeNoiseArg(const GaugeField &U, const CounterRNG &rng) :
+      kernel_param(dim3(U.LocalVolumeCB(), 2, 1)),
+      geometry(U.Geometry()),
+      U(U),
+      site(U, rng)
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = U.R()[dir];
+        E[dir] = U.X()[dir];
+        X[dir] = U.X()[dir] - border[dir] * 2;
+      }
+    }
   };
 
-  template<typename real, typename Arg> // Gauss
-  __device__ __host__ inline void genGauss(Arg &arg, RNGState& localState, int parity, int x_cb, int g, int r, int c)
+  template<typename real, typename Arg, typename State> // Gauss
+  __device__ __host__ inline void genGauss(Arg &arg, State& localState, int parity, int x_cb, int g, int r, int c)
   {
-    real phi = 2.0 * uniform<real>::rand(localState);
-    real radius = uniform<real>::rand(localState);
+    real phi = 2.0 * uniform_rand<real>(localState);
+    real radius = uniform_rand<real>(localState);
     radius = sqrt(-log(radius));
     real phi_sin, phi_cos;
     quda::sincospi(phi, &phi_sin, &phi_cos);
     arg.U(g, parity, x_cb, r, c) = radius * complex<real>(phi_cos, phi_sin);
   }
 
-  template<typename real, typename Arg> // Uniform
-  __device__ __host__ inline void genUniform(Arg &arg, RNGState& localState, int parity, int x_cb, int g, int r, int c)
+  template<typename real, typename Arg, typename State> // Uniform
+  __device__ __host__ inline void genUniform(Arg &arg, State& localState, int parity, int x_cb, int g, int r, int c)
   {
-    real x = uniform<real>::rand(localState);
-    real y = uniform<real>::rand(localState);
+    real x = uniform_rand<real>(localState);
+    real y = uniform_rand<real>(localState);
     arg.U(g, parity, x_cb, r, c) = complex<real>(x, y);
   }
 
@@ -64,10 +81,13 @@ namespace quda {
     {
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
+      typename Arg::State localState;
+      if constexpr (Arg::counter) localState = arg.site.state(x);
+      else localState = arg.rng[parity * arg.threads.x + x_cb];
+
       for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
       int e_cb = linkIndex(x, arg.E);
 
-      RNGState localState = arg.rng[parity * arg.threads.x + x_cb];
       for (int g = 0; g < arg.geometry; g++) {
         for (int r = 0; r < Arg::nColor; r++) {
           for (int c = 0; c < Arg::nColor; c++) {
@@ -78,7 +98,7 @@ namespace quda {
           }
         }
       }
-      arg.rng[parity * arg.threads.x + x_cb] = localState;
+      if constexpr (!Arg::counter) arg.rng[parity * arg.threads.x + x_cb] = localState;
     }
   };
 
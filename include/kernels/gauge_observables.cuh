@@ -0,0 +1,143 @@
+#pragma once
+
+#include <gauge_field_order.h>
+#include <quda_matrix.h>
+#include <index_helper.cuh>
+#include <array.h>
+#include <reduction_kernel.h>
+
+namespace quda
+{
+
+  template <typename Float_, int nColor_, QudaReconstructType recon_, bool density_ = false>
+  struct GaugeObservablesArg : public ReduceArg<array<double, 5>> {
+    using Float = Float_;
+    static constexpr int nColor = nColor_;
+    static_assert(nColor == 3, "Only nColor=3 enabled at this time");
+    static constexpr QudaReconstructType recon = recon_;
+    static constexpr bool density = density_;
+    typedef typename gauge_mapper<Float, recon>::type Gauge;
+
+    int E[4]; // extended grid dimensions
+    int X[4]; // true grid dimensions
+    int border[4];
+    Gauge U;
+    Float *qDensity;
+
+    GaugeObservablesArg(const GaugeField &U_, Float *qDensity = nullptr) :
+      ReduceArg<reduce_t>(dim3(U_.LocalVolumeCB(), 2, 1)), U(U_), qDensity(qDensity)
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = U_.R()[dir];
+        E[dir] = U_.X()[dir];
+        X[dir] = U_.X()[dir] - border[dir] * 2;
+      }
+    }
+  };
+
+  /**
+     @brief Load the link in direction dir at the site x + dmu * mu + dnu * nu
+  */
+  template <typename Arg>
+  __device__ __host__ inline auto getLink(const Arg &arg, const int x[], int parity, int dir, int mu, int dmu, int nu,
+                                          int dnu)
+  {
+    int dx[4] = {0, 0, 0, 0};
+    dx[mu] += dmu;
+    dx[nu] += dnu;
+    return Matrix<complex<typename Arg::Float>, Arg::nColor>(
+      arg.U(dir, linkIndexShift(x, dx, arg.E), (parity + dmu + dnu) & 1));
+  }
+
+  /**
+     @brief Compute the clover-leaf field strength F_{mu,nu} at site x,
+     together with the trace of the plaquette U_{mu,nu}(x), which is
+     the first of the four leaves.  This is equivalent to
+     computeFmunuCore, except the result is returned in registers.
+  */
+  template <typename Arg>
+  __device__ __host__ inline auto cloverField(const Arg &arg, const int x[], int parity, int mu, int nu, double &plaq)
+  {
+    using Link = Matrix<complex<typename Arg::Float>, Arg::nColor>;
+
+    // U(x,mu) U(x+mu,nu) U[dagger](x+nu,mu) U[dagger](x,nu)
+    Link F = getLink(arg, x, parity, mu, mu, 0, nu, 0) * getLink(arg, x, parity, nu, mu, 1, nu, 0)
+      * conj(getLink(arg, x, parity, mu, mu, 0, nu, 1)) * conj(getLink(arg, x, parity, nu, mu, 0, nu, 0));
+    plaq = getTrace(F).real();
+
+    // U(x,nu) U[dagger](x+nu-mu,mu) U[dagger](x-mu,nu) U(x-mu, mu)
+    F += getLink(arg, x, parity, nu, mu, 0, nu, 0) * conj(getLink(arg, x, parity, mu, mu, -1, nu, 1))
+      * conj(getLink(arg, x, parity, nu, mu, -1, nu, 0)) * getLink(arg, x, parity, mu, mu, -1, nu, 0);
+
+    // U[dagger](x-nu,nu) U(x-nu,mu) U(x+mu-nu,nu) U[dagger](x,mu)
+    F += conj(getLink(arg, x, parity, nu, mu, 0, nu, -1)) * getLink(arg, x, parity, mu, mu, 0, nu, -1)
+      * getLink(arg, x, parity, nu, mu, 1, nu, -1) * conj(getLink(arg, x, parity, mu, mu, 0, nu, 0));
+
+    // U[dagger](x-mu,mu) U[dagger](x-mu-nu,nu) U(x-mu-nu,mu) U(x-nu,nu)
+    F += conj(getLink(arg, x, parity, mu, mu, -1, nu, 0)) * conj(getLink(arg, x, parity, nu, mu, -1, nu, -1))
+      * getLink(arg, x, parity, mu, mu, -1, nu, -1) * getLink(arg, x, parity, nu, mu, 0, nu, -1);
+
+    F -= conj(F);
+    F *= static_cast<typename Arg::Float>(0.125);
+    return F;
+  }
+
+  /**
+     Fused computation of the spatial and temporal plaquette, the
+     spatial and temporal field energy and the topological charge.
+     The six components of the field strength are computed at each
+     site in registers and never written to memory.
+  */
+  template <typename Arg> struct GaugeObservables : plus<typename Arg::reduce_t> {
+    using reduce_t = typename Arg::reduce_t;
+    using plus<reduce_t>::operator();
+    static constexpr int reduce_block_dim = 2; // x_cb in x, parity in y
+    const Arg &arg;
+    constexpr GaugeObservables(const Arg &arg) : arg(arg) { }
+    static constexpr const char *filename() { return KERNEL_FILE; }
+
+    // return (plaq_s, plaq_t, E_s, E_t, Q) at site (x_cb, parity)
+    __device__ __host__ inline reduce_t operator()(reduce_t &value, int x_cb, int parity)
+    {
+      using real = typename Arg::Float;
+      using Link = Matrix<complex<real>, Arg::nColor>;
+      constexpr real q_norm = static_cast<real>(-1.0 / (4 * M_PI * M_PI));
+      constexpr real n_inv = static_cast<real>(1.0 / Arg::nColor);
+
+      reduce_t local {0, 0, 0, 0, 0};
+
+      int x[4];
+      getCoords(x, x_cb, arg.X, parity);
+#pragma unroll
+      for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
+
+      // F0 = F[Y,X], F1 = F[Z,X], F2 = F[Z,Y],
+      // F3 = F[T,X], F4 = F[T,Y], F5 = F[T,Z]
+      constexpr int mu[] = {1, 2, 2, 3, 3, 3};
+      constexpr int nu[] = {0, 0, 1, 0, 1, 2};
+
+      Link iden;
+      setIdentity(&iden);
+
+      Link F[6];
+#pragma unroll
+      for (int i = 0; i < 6; i++) {
+        double plaq;
+        F[i] = cloverField(arg, x, parity, mu[i], nu[i], plaq);
+        local[i < 3 ? 0 : 1] += plaq;
+
+        // energy from the traceless field strength
+        auto tmp = F[i] - n_inv * getTrace(F[i]) * iden;
+        local[i < 3 ? 2 : 3] -= getTrace(tmp * tmp).real();
+      }
+
+      // topological charge with the levi-civita symbol applied
+      double Q = getTrace(F[0] * F[5]).real() - getTrace(F[1] * F[4]).real() + getTrace(F[2] * F[3]).real();
+      local[4] = Q * q_norm;
+      if (Arg::density) arg.qDensity[x_cb + parity * arg.threads.x] = local[4];
+
+      return operator()(local, value);
+    }
+  };
+
+} // namespace quda
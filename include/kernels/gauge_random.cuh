@@ -2,17 +2,20 @@
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
 #include <random_helper.h>
+#include <random_helper_host.h>
 #include <kernel.h>
 
 namespace quda {
 
-  template <typename Float_, int nColor_, QudaReconstructType recon_, bool group_>
+  template <typename Float_, int nColor_, QudaReconstructType recon_, bool group_, typename rng_t = RNGState>
   struct GaugeGaussArg : kernel_param<> {
     using Float = Float_;
     using real = typename mapper<Float>::type;
     static constexpr int nColor = nColor_;
     static constexpr QudaReconstructType recon = recon_;
     static constexpr bool group = group_;
+    using State = rng_t;
+    static constexpr bool counter = std::is_same_v<State, CounterRNGState>;
 
     using Gauge = typename gauge_mapper<Float, recon>::type;
 
@@ -20,7 +23,8 @@ namespace quda {
     int X[4]; // true grid dimensions
     int border[4];
     Gauge U;
-    RNGState *rng;
+    RNGState *rng = nullptr;
+    CounterRNGSite site;
     real sigma; // where U = exp(sigma * H)
 
     GaugeGaussArg(const GaugeField &U, RNGState *rng, double sigma) :
@@ -35,16 +39,29 @@ namespace quda {
         X[dir] = U.X()[dir] - border[dir] * 2;
       }
     }
+
+    GaugeGaussArg(const GaugeField &U, const CounterRNG &rng, double sigma) :
+      kernel_param(dim3(U.LocalVolumeCB(), 2, 1)),
+      U(U),
+      site(U, rng),
+      sigma(sigma)
+    {
+      for (int dir = 0; dir < 4; ++dir) {
+        border[dir] = U.R()[dir];
+        E[dir] = U.X()[dir];
+        X[dir] = U.X()[dir] - border[dir] * 2;
+      }
+    }
   };
 
-  template <typename real, typename Link> __device__ __host__ Link gauss_su3(RNGState &localState)
+  template <typename real, typename Link, typename State> __device__ __host__ Link gauss_su3(State &localState)
   {
     Link ret;
     real rand1[4], rand2[4], phi[4], radius[4], temp1[4], temp2[4];
 
     for (int i = 0; i < 4; ++i) {
-      rand1[i] = uniform<real>::rand(localState);
-      rand2[i] = uniform<real>::rand(localState);
+      rand1[i] = uniform_rand<real>(localState);
+      rand2[i] = uniform_rand<real>(localState);
       phi[i] = 2.0 * rand1[i];
       radius[i] = sqrt(-log(rand2[i]));
       quda::sincospi(phi[i], &temp2[i], &temp1[i]);
@@ -80,6 +97,8 @@ namespace quda {
 
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
+      typename Arg::State localState;
+      if constexpr (Arg::counter) localState = arg.site.state(x);
       for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
 
       if (arg.group and arg.sigma == 0.0) {
@@ -93,7 +112,7 @@ namespace quda {
         for (int mu = 0; mu < 4; mu++) arg.U(mu, linkIndex(x, arg.E), parity) = O;
       } else {
         for (int mu = 0; mu < 4; mu++) {
-          RNGState localState = arg.rng[parity * arg.threads.x + x_cb];
+          if constexpr (!Arg::counter) localState = arg.rng[parity * arg.threads.x + x_cb];
 
           // generate Gaussian distributed su(n) field
           Link u = arg.sigma * gauss_su3<real, Link>(localState);
@@ -102,7 +121,7 @@ namespace quda {
           }
           arg.U(mu, linkIndex(x, arg.E), parity) = u;
 
-          arg.rng[parity * arg.threads.x + x_cb] = localState;
+          if constexpr (!Arg::counter) arg.rng[parity * arg.threads.x + x_cb] = localState;
         }
       }
     }
@@ -22,14 +22,15 @@ namespace quda
     Gauge out;
     const Gauge in;
 
-    int X[4]; // grid dimensions
+    int X[4]; // dimensions of the region being updated
     int border[4];
+    int parity_shift = 0; // parity offset between the region being updated and the extended field
     const Float rho;
     const Float staple_coeff;
     const Float rectangle_coeff;
     const int dir_ignore;
 
-    STOUTArg(GaugeField &out, const GaugeField &in, Float rho, Float epsilon, int dir_ignore) :
+    STOUTArg(GaugeField &out, const GaugeField &in, Float rho, Float epsilon, int dir_ignore, const lat_dim_t &depth) :
       kernel_param(dim3(1, 2, stoutDim)),
       out(out),
       in(in),
@@ -39,9 +40,10 @@ namespace quda
       dir_ignore(dir_ignore)
     {
       for (int dir = 0; dir < 4; ++dir) {
-        border[dir] = in.R()[dir];
+        border[dir] = in.R()[dir] - depth[dir];
         X[dir] = in.X()[dir] - border[dir] * 2;
         this->threads.x *= X[dir];
+        parity_shift ^= depth[dir] & 1;
       }
       this->threads.x /= 2;
     }
@@ -65,6 +67,7 @@ namespace quda
       for (int dr = 0; dr < 4; ++dr) X[dr] = arg.X[dr];
       int x[4];
       getCoords(x, x_cb, X, parity);
+      parity ^= arg.parity_shift;
       for (int dr = 0; dr < 4; ++dr) {
         x[dr] += arg.border[dr];
         X[dr] += 2 * arg.border[dr];
@@ -144,6 +147,7 @@ namespace quda
       for (int dr = 0; dr < 4; ++dr) X[dr] = arg.X[dr];
       int x[4];
       getCoords(x, x_cb, X, parity);
+      parity ^= arg.parity_shift;
       for (int dr = 0; dr < 4; ++dr) {
         x[dr] += arg.border[dr];
         X[dr] += 2 * arg.border[dr];
@@ -266,4 +266,27 @@ namespace quda
       }
     }
   }
+
+  /**
+     @brief Return the checkerboard volume of the region updated by a
+     smearing kernel: the interior of the extended field u together
+     with the inner depth[d] layers of its halo in each dimension.
+  */
+  inline unsigned int smearRegionVolumeCB(const GaugeField &u, const lat_dim_t &depth)
+  {
+    unsigned int volume = 1;
+    for (int d = 0; d < 4; d++) volume *= u.X()[d] - 2 * (u.R()[d] - depth[d]);
+    return volume / 2;
+  }
+
+  /**
+     @brief Append the halo depth to the tuning string when a
+     smearing kernel is updating part of the halo region
+  */
+  inline void setSmearDepthString(char *aux, const lat_dim_t &depth)
+  {
+    if (depth[0] == 0 && depth[1] == 0 && depth[2] == 0 && depth[3] == 0) return;
+    strcat(aux, ",depth=");
+    for (int d = 0; d < 4; d++) i32toa(aux + strlen(aux), depth[d]);
+  }
 }
@@ -25,6 +25,8 @@ namespace quda
     Gauge out;
     Matrix temp;
     const Gauge in;
+    Matrix embedded; // embedded lower-order solution, and then the local error estimate
+    const bool adaptive;
 
     int_fastdiv X[4]; // grid dimensions
     int border[4];
@@ -33,11 +35,13 @@ namespace quda
     const real coeff1x1;
     const real coeff2x1;
 
-    GaugeWFlowArg(GaugeField &out, GaugeField &temp, const GaugeField &in, const real epsilon) :
+    GaugeWFlowArg(GaugeField &out, GaugeField &temp, const GaugeField &in, const real epsilon, GaugeField *embedded) :
       kernel_param(dim3(in.LocalVolumeCB(), 2, wflow_dim)),
       out(out),
       temp(temp),
       in(in),
+      embedded(embedded ? *embedded : temp),
+      adaptive(embedded != nullptr),
       epsilon(epsilon),
       coeff1x1(5.0 / 3.0),
       coeff2x1(-1.0 / 12.0)
@@ -85,6 +89,22 @@ namespace quda
     return Z;
   }
 
+  /**
+     @brief Apply the flow update exp(Z) U, where Z is projected onto
+     the anti-hermitian traceless matrices
+     @param[in] Z The (scaled) flow generator
+     @param[in] U The link we are updating
+     @return The updated link
+  */
+  template <typename real, int nColor>
+  __host__ __device__ inline auto flowUpdate(Matrix<complex<real>, nColor> Z, const Matrix<complex<real>, nColor> &U)
+  {
+    complex<real> im(0.0, -1.0);
+    makeAntiHerm(Z);
+    Z = im * Z;
+    return exponentiate_iQ(Z) * U;
+  }
+
   template <typename Link, typename Ftor>
   __host__ __device__ inline auto computeW1Step(const Ftor &ftor, Link &U, const int *x, const int parity,
                                                 const int x_cb, const int dir)
@@ -106,15 +126,25 @@ namespace quda
   {
     using Arg = typename Ftor::Arg;
     const Arg &arg = ftor.arg;
+    using real = typename Arg::real;
     // Compute staples and Z1
-    Link Z1 = static_cast<typename Arg::real>(8.0 / 9.0) * computeStaple(ftor, x, parity, dir);
+    Link Z1 = computeStaple(ftor, x, parity, dir);
     U = arg.in(dir, linkIndex(x, arg.E), parity);
     Z1 *= conj(U);
 
-    // Retrieve Z0, (8/9 Z1 - 17/36 Z0) stored in temp
+    // Retrieve Z0
     Link Z0 = arg.temp(dir, x_cb, parity);
-    Z0 *= static_cast<typename Arg::real>(17.0 / 36.0);
-    Z1 = Z1 - Z0;
+
+    if (arg.adaptive) {
+      // Embedded second-order integrator sharing the Z0 and Z1 stages:
+      // exp(2 Z1 - 5/4 Z0) W1, see https://arxiv.org/abs/1301.4388
+      Link Ze = static_cast<real>(2.0) * Z1 - static_cast<real>(5.0 / 4.0) * Z0;
+      Ze *= arg.epsilon;
+      arg.embedded(dir, x_cb, parity) = flowUpdate(Ze, U);
+    }
+
+    // (8/9 Z1 - 17/36 Z0) stored in temp
+    Z1 = static_cast<real>(8.0 / 9.0) * Z1 - static_cast<real>(17.0 / 36.0) * Z0;
     arg.temp(dir, x_cb, parity) = Z1;
     Z1 *= arg.epsilon;
     return Z1;
@@ -152,7 +182,6 @@ namespace quda
     {
       using real = typename Arg::real;
       using Link = Matrix<complex<real>, Arg::nColor>;
-      complex<real> im(0.0, -1.0);
 
       // Get spacetime and local coords
       int x[4];
@@ -167,10 +196,15 @@ namespace quda
       }
 
       // Compute anti-hermitian projection of Z, exponentiate, update U
-      makeAntiHerm(Z);
-      Z = im * Z;
-      U = exponentiate_iQ(Z) * U;
+      U = flowUpdate(Z, U);
       arg.out(dir, linkIndex(x, arg.E), parity) = U;
+
+      // The difference between the third-order and embedded
+      // second-order solutions is the local error estimate
+      if (Arg::step_type == WFLOW_STEP_VT && arg.adaptive) {
+        Link Ue = arg.embedded(dir, x_cb, parity);
+        arg.embedded(dir, x_cb, parity) = U - Ue;
+      }
     }
   };
 
@@ -41,11 +41,12 @@ namespace quda
       static constexpr int n = n_;
       static constexpr int NXZ = NXZ_;
       static constexpr int NYW_max = max_YW_size<NXZ, store_t, y_store_t, Functor>();
+      const int NYW;
       Functor f;
 
       template <typename V>
       MultiBlasArg(V &x, V &y, V &z, V &w, Functor f, int NYW, int length) :
-        kernel_param(dim3(length * warp_split, NYW, x.SiteSubset())), f(f)
+        kernel_param(dim3(length * warp_split, NYW, x.SiteSubset())), NYW(NYW), f(f)
       {
         if (NYW > NYW_max) errorQuda("NYW = %d greater than maximum size of %d", NYW, NYW_max);
 
@@ -114,6 +115,46 @@ namespace quda
       }
     };
 
+    /**
+       Host multi-blas functor.  Rather than each y index owning a
+       single NYW vector, as on the device, each y index is a tile of
+       NYW vectors that are all held in registers at a given site.
+       Each NXZ site vector is then loaded once per tile and applied to
+       every NYW vector in the tile, instead of being reloaded for each
+       of them.
+    */
+    template <typename Arg> struct MultiBlasHost_ {
+      static constexpr int tile = 8;
+      const Arg &arg;
+      constexpr MultiBlasHost_(const Arg &arg) : arg(arg) {}
+      static constexpr const char *filename() { return KERNEL_FILE; }
+
+      inline void operator()(int i, int k_tile, int parity)
+      {
+        using vec = array<complex<typename Arg::real>, Arg::n/2>;
+        const int k_begin = k_tile * tile;
+        const int k_size = std::min(tile, arg.NYW - k_begin);
+
+        vec y[tile], w[tile];
+        for (int k = 0; k < k_size; k++) {
+          if (arg.f.read.Y) arg.Y[k_begin + k].load(y[k], i, parity);
+          if (arg.f.read.W) arg.W[k_begin + k].load(w[k], i, parity);
+        }
+
+        for (int l = 0; l < Arg::NXZ; l++) {
+          vec x, z;
+          if (arg.f.read.X) arg.X[l].load(x, i, parity);
+          if (arg.f.read.Z) arg.Z[l].load(z, i, parity);
+          for (int k = 0; k < k_size; k++) arg.f(x, y[k], z, w[k], k_begin + k, l);
+        }
+
+        for (int k = 0; k < k_size; k++) {
+          if (arg.f.write.Y) arg.Y[k_begin + k].save(y[k], i, parity);
+          if (arg.f.write.W) arg.W[k_begin + k].save(w[k], i, parity);
+        }
+      }
+    };
+
     template <typename coeff_t_, bool multi_1d_ = false>
     struct MultiBlasFunctor : MultiBlasParam<coeff_t_, false, multi_1d_> {
       using coeff_t = coeff_t_;
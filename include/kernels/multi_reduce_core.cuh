@@ -120,6 +120,56 @@ namespace quda
       }
     };
 
+    /**
+       Host multi-reduction functor.  Rather than each batch index
+       owning a single NYW vector, as on the device, each batch index
+       is a tile of max_n_batch_block NYW vectors that are all held in
+       registers at a given site.  Each NXZ site vector is then loaded
+       once per tile and accumulated against every NYW vector in the
+       tile, instead of being reloaded for each of them.
+    */
+    template <typename Arg> struct MultiReduceHost_ :
+      plus<array<typename Arg::Reducer::reduce_t, Arg::NXZ * Arg::max_n_batch_block>> {
+      static constexpr int tile = Arg::max_n_batch_block;
+      using reduce_t = array<typename Arg::Reducer::reduce_t, Arg::NXZ * tile>;
+      using plus<reduce_t>::operator();
+      using vec = array<complex<typename Arg::real>, Arg::n/2>;
+      const Arg &arg;
+      constexpr MultiReduceHost_(const Arg &arg) : arg(arg) {}
+      static constexpr const char *filename() { return KERNEL_FILE; }
+
+      // overload comm_reduce to defer until the entire "tile" is complete
+      template <typename U> static inline void comm_reduce(U &) { }
+
+      inline reduce_t operator()(reduce_t &sum, int tid, int, int k_tile) const
+      {
+        unsigned int parity = tid >= arg.length_cb ? 1 : 0;
+        unsigned int i = tid - parity * arg.length_cb;
+        const int k_begin = k_tile * tile;
+        const int k_size = std::min(tile, arg.NYW - k_begin);
+
+        vec y[tile], w[tile];
+        for (int k = 0; k < k_size; k++) {
+          if (arg.f.read.Y) arg.Y[k_begin + k].load(y[k], i, parity);
+          if (arg.f.read.W) arg.W[k_begin + k].load(w[k], i, parity);
+        }
+
+        for (int l = 0; l < Arg::NXZ; l++) {
+          vec x, z;
+          if (arg.f.read.X) arg.X[l].load(x, i, parity);
+          if (arg.f.read.Z) arg.Z[l].load(z, i, parity);
+          for (int k = 0; k < k_size; k++) arg.f(sum[k * Arg::NXZ + l], x, y[k], z, w[k], k_begin + k, l);
+        }
+
+        for (int k = 0; k < k_size; k++) {
+          if (arg.f.write.Y) arg.Y[k_begin + k].save(y[k], i, parity);
+          if (arg.f.write.W) arg.W[k_begin + k].save(w[k], i, parity);
+        }
+
+        return sum;
+      }
+    };
+
     /**
        Base class from which all reduction functors should derive.
 
@@ -1,6 +1,7 @@
 #include <quda_matrix.h>
 #include <gauge_field_order.h>
 #include <random_helper.h>
+#include <random_helper_host.h>
 #include <index_helper.cuh>
 #include <kernel.h>
 
@@ -42,17 +43,18 @@ namespace quda {
     }
   };
 
-  template <typename Float, int nColor_, QudaReconstructType recon_>
+  template <typename Float, int nColor_, QudaReconstructType recon_, typename rng_t = RNGState>
   struct InitGaugeHotArg : kernel_param<> {
     static constexpr int nColor = nColor_;
     static constexpr QudaReconstructType recon = recon_;
     using real = typename mapper<Float>::type;
     using Gauge = typename gauge_mapper<real, recon>::type;
+    using State = rng_t; // RNGState on the device, HostRNGState on the host
     int X[4]; // grid dimensions
     Gauge U;
-    RNGState *rng;
+    State *rng;
     int border[4];
-    InitGaugeHotArg(const GaugeField &U, RNGState *rng) :
+    InitGaugeHotArg(const GaugeField &U, State *rng) :
       //the optimal number of RNG states in rngstate array must be equal to half the lattice volume
       //this number is the same used in heatbath...
       kernel_param(dim3(U.LocalVolumeCB(), 1, 1)),
@@ -108,22 +110,22 @@ namespace quda {
 
   /**
      @brief Generate the four random real elements of the SU(2) matrix
-     @param localstate CURAND rng state
+     @param localstate CURAND rng state, or host rng state
      @return four real numbers of the SU(2) matrix
   */
-  template <class T>
-  __device__ static inline Matrix<T,2> randomSU2(RNGState& localState){
+  template <class T, class State>
+  __host__ __device__ static inline Matrix<T,2> randomSU2(State& localState){
     Matrix<T,2> a;
     T aabs, ctheta, stheta, phi;
-    a(0,0) = uniform<T>::rand(localState, (T)-1.0, (T)1.0);
+    a(0,0) = uniform_rand<T>(localState, (T)-1.0, (T)1.0);
     aabs = sqrt( 1.0 - a(0,0) * a(0,0));
-    ctheta = uniform<T>::rand(localState, (T)-1.0, (T)1.0);
-    phi = PII * uniform<T>::rand(localState);
+    ctheta = uniform_rand<T>(localState, (T)-1.0, (T)1.0);
+    phi = PII * uniform_rand<T>(localState);
 
     // Was   xurand(*localState>& 1 ? 1 : -1
     // which presumably just selects when the lowest bit is 1 or 0 with 50% probability each
     // so this should do the same, without an appeal to the bit swizzle, but may end up being slower.
-    stheta = ( uniform<T>::rand(localState) < static_cast<T>(0.5) ? 1 : -1 ) * sqrt( (T)1.0 - ctheta * ctheta );
+    stheta = ( uniform_rand<T>(localState) < static_cast<T>(0.5) ? 1 : -1 ) * sqrt( (T)1.0 - ctheta * ctheta );
     a(0,1) = aabs * stheta * cos( phi );
     a(1,0) = aabs * stheta * sin( phi );
     a(1,1) = aabs * ctheta;
@@ -174,17 +176,17 @@ namespace quda {
 
   /**
      @brief Generate a SU(Nc) random matrix
-     @param localstate CURAND rng state
+     @param localstate CURAND rng state, or host rng state
      @return SU(Nc) matrix
   */
-  template <class Float, int nColor>
-  __device__ inline Matrix<complex<Float>,nColor> randomize( RNGState& localState )
+  template <class Float, int nColor, class State>
+  __host__ __device__ inline Matrix<complex<Float>,nColor> randomize( State& localState )
   {
     Matrix<complex<Float>,nColor> U;
 
     for ( int i = 0; i < nColor; i++ )
       for ( int j = 0; j < nColor; j++ )
-        U(i,j) = complex<Float>( (Float)(uniform<Float>::rand(localState) - 0.5), (Float)(uniform<Float>::rand(localState) - 0.5) );
+        U(i,j) = complex<Float>( (Float)(uniform_rand<Float>(localState) - 0.5), (Float)(uniform_rand<Float>(localState) - 0.5) );
     reunit_link<Float>(U);
     return U;
 
@@ -208,7 +210,7 @@ namespace quda {
       int X[4], x[4];
       for ( int dr = 0; dr < 4; ++dr ) X[dr] = arg.X[dr];
       for ( int dr = 0; dr < 4; ++dr ) X[dr] += 2 * arg.border[dr];
-      RNGState localState = arg.rng[x_cb];
+      typename Arg::State localState = arg.rng[x_cb];
       for (int parity = 0; parity < 2; parity++) {
         getCoords(x, x_cb, arg.X, parity);
         for (int dr = 0; dr < 4; dr++) x[dr] += arg.border[dr];
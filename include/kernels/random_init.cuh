@@ -1,6 +1,7 @@
 #pragma once
 
 #include <random_helper.h>
+#include <random_helper_host.h>
 #include <lattice_field.h>
 #include <index_helper.cuh>
 #include <comm_quda.h>
@@ -8,20 +9,22 @@
 
 namespace quda {
 
-  struct rngArg : kernel_param<> {
+  template <typename State> struct rngArg : kernel_param<> {
     int commCoord[QUDA_MAX_DIM];
     int X[QUDA_MAX_DIM];
     uint64_t X_global[QUDA_MAX_DIM];
-    RNGState *state;
+    State *state;
     unsigned long long seed;
-    rngArg(RNGState *state, unsigned long long seed, const LatticeField &meta) :
+    rngArg(State *state, unsigned long long seed, const LatticeField &meta) :
       kernel_param(dim3(meta.LocalVolumeCB(), meta.SiteSubset(), 1)),
       state(state),
       seed(seed)
     {
       for (int i=0; i<4; i++) {
         commCoord[i] = comm_coord(i);
-        X[i] = meta.LocalX()[i];
+        // single-parity fields store half the x extent, while the
+        // coordinates are those of the full lattice
+        X[i] = meta.LocalX()[i] * (i == 0 && meta.SiteSubset() == QUDA_PARITY_SITE_SUBSET ? 2 : 1);
         X_global[i] = X[i] * comm_dim(i);
       }
     }
@@ -37,10 +40,10 @@ namespace quda {
   template <typename Arg>
   struct init_random {
     const Arg &arg;
-    __device__ constexpr init_random(const Arg &arg) : arg(arg) {}
+    constexpr init_random(const Arg &arg) : arg(arg) {}
     static constexpr const char *filename() { return KERNEL_FILE; }
 
-    __device__ inline void operator()(int id, int parity)
+    __device__ __host__ inline void operator()(int id, int parity)
     {
       // Each thread gets same seed, a different sequence number, no offset
       int x[4];
@@ -69,7 +69,7 @@ namespace quda {
     __device__ __host__ void operator()(int x_cb, int c, int parity)
     {
       using real = typename Arg::real;
-      using complex = complex<real>;
+      using complex = quda::complex<real>;
       constexpr int nDim = 4;
 
       int ic_f = c / Arg::fineColor;
@@ -489,6 +489,17 @@ extern "C" {
     double a_min;
     double a_max;
 
+    /** Select a_min and poly_deg automatically from a stochastic
+        Chebyshev (kernel polynomial method) estimate of the spectral
+        density, overwriting the values passed in **/
+    QudaBoolean poly_acc_auto;
+    /** Number of Chebyshev moments used in the spectral density estimate **/
+    int kpm_n_moments;
+    /** Number of random vectors used in the spectral density estimate **/
+    int kpm_n_vec;
+    /** On return, the spectral density estimate of the n_conv-th eigenvalue **/
+    double kpm_eval_n_conv;
+
     /** Whether to preserve the deflation space between solves.  If
         true, the space will be stored in an instance of the
         deflation_space struct, pointed to by preserve_deflation_space */
@@ -873,6 +884,15 @@ extern "C" {
     double t0;                     /**< Starting flow time for Wilson flow */
     int dir_ignore;                /**< The direction to be ignored by the smearing algorithm
                                         A negative value means 3D for APE/STOUT and 4D for OVRIMP_STOUT/HYP */
+    double tol;        /**< Local error tolerance for adaptive step-size Wilson/Symanzik flow, with epsilon the
+                          initial step size.  If zero then the flow uses the fixed step size epsilon */
+    unsigned int n_meas_t; /**< Number of flow times at which to measure with adaptive flow.  If zero then we
+                              measure at t0 + k * meas_interval * epsilon up to t0 + n_steps * epsilon */
+    double *meas_t;        /**< Increasing flow times at which to measure with adaptive flow, where the flow
+                              stops at the last one */
+    unsigned int steps_per_exchange; /**< Number of APE, STOUT or HYP smearing steps applied per halo exchange,
+                                        with the extended region widened to match.  If zero then each step
+                                        performs its own halo exchanges */
   } QudaGaugeSmearParam;
 
   typedef struct QudaBLASParam_s {
@@ -987,6 +1007,28 @@ extern "C" {
 
   void initCommsGridQuda(int nDim, const int *dims, QudaCommsMap func, void *fdata);
 
+  /**
+   * Declare the grid mapping ("logical topology" in QMP parlance)
+   * used for communications in a multi-GPU grid, choosing the
+   * mapping of ranks to grid coordinates that minimizes the halo
+   * traffic between nodes for the given lattice.  Ranks sharing a
+   * node (as determined by their hostnames) are assigned to a block
+   * of the grid, with the shape of the block chosen to minimize the
+   * inter-node halo bytes per dslash, which is reported.  This may
+   * be called in place of initCommsGridQuda().  With QMP, the
+   * application must not have declared a QMP logical topology, since
+   * that would fix the rank mapping.
+   *
+   * @param nDim   Number of grid dimensions.  "4" is the only supported
+   *               value currently.
+   *
+   * @param dims   Array of grid dimensions.  dims[0]*dims[1]*dims[2]*dims[3]
+   *               must equal the total number of MPI ranks or QMP nodes.
+   *
+   * @param X      Array of global lattice dimensions
+   */
+  void initCommsGridTopologyQuda(int nDim, const int *dims, const int *X);
+
   /**
    * Initialize the library.  This is a low-level interface that is
    * called by initQuda.  Calling initQudaDevice requires that the
@@ -1662,6 +1704,22 @@ extern "C" {
    */
   void performWuppertalnStep(void *h_out, void *h_in, QudaInvertParam *param, unsigned int n_steps, double alpha);
 
+  /**
+   * Performs Wuppertal smearing on a set of spinors, as in
+   * performWuppertalnStep.  The sources are smeared in tiles of up
+   * to QUDA_MAX_MULTI_RHS, with each application of the Laplace
+   * operator applied to the whole tile at once.
+   * @param h_out  Array of result spinor fields
+   * @param h_in   Array of input spinor fields
+   * @param n_src  Number of spinor fields
+   * @param param  Contains all metadata regarding host and device
+   *               storage and operator which will be applied to the spinors
+   * @param n_steps Number of steps to apply.
+   * @param alpha  Alpha coefficient for Wuppertal smearing.
+   */
+  void performWuppertalnStepMultiSrc(void **h_out, void **h_in, int n_src, QudaInvertParam *param,
+                                     unsigned int n_steps, double alpha);
+
   /**
    * LEGACY
    * Performs gaussian smearing on a given spinor using the gauge field
@@ -1725,6 +1783,11 @@ extern "C" {
                     const int *X);
 
   /**
+   * Momentum-projected contraction of host propagators.  The
+   * contraction is always executed on the device; use
+   * contractFTMultiQuda() with location = QUDA_CPU_FIELD_LOCATION to
+   * execute on the host.
+   *
    * @param[in] x pointer to host data array
    * @param[in] y pointer to host data array
    * @param[out] result pointer to the spin*spin projections per lattice slice site
@@ -1741,6 +1804,42 @@ extern "C" {
                       const int src_colors, const int *X, const int *const source_position, const int n_mom,
                       const int *const mom_modes, const QudaFFTSymmType *const fft_type);
 
+  /**
+   * @brief Batched momentum-projected contractions of two sets of
+   * host spinors.  For every pair (i,j) of x and y the color
+   * contraction M_{s1 s2} = \sum_c conj(x_i(s1,c)) y_j(s2,c) is
+   * projected onto all momenta in one pass, with the momentum sum
+   * done as a GEMM against a phase table.  With n_gamma = 0 the open
+   * spin matrices are returned, else the channels
+   * \sum_{s1,s2} gamma[g][s1][s2] M_{s1 s2}.  The result overwrites
+   * the output array, ordered as [mom][slice][i][j][channel].
+   *
+   * Memory: besides native copies of all n_x + n_y spinors, the
+   * execution location holds the per-site spin matrices of one tile
+   * of pairs, a buffer of 64 complex numbers in the field precision
+   * per local site (2 GiB for a 32^3x64 local volume in double
+   * precision), independent of n_x, n_y and n_mom.
+   * @param[in] x array of n_x pointers to host spinors
+   * @param[in] n_x number of spinors in x
+   * @param[in] y array of n_y pointers to host spinors
+   * @param[in] n_y number of spinors in y
+   * @param[out] result pointer to the complex (double) results
+   * @param[in] cType Which type of contraction (DR_FT_T, DR_FT_Z or STAGGERED_FT_T)
+   * @param[in] cs_param_ptr meta data for construction of ColorSpinorFields.
+   * @param[in] X local lattice dimensions
+   * @param[in] source_position source position array
+   * @param[in] n_mom number of momentum modes
+   * @param[in] mom_modes momentum modes
+   * @param[in] fft_type Fourier phase factor type (cos, sin or exp{ikx})
+   * @param[in] n_gamma number of gamma structures (0 for open spin matrices)
+   * @param[in] gamma n_gamma row-major nSpin x nSpin complex matrices
+   * @param[in] location where to execute the contraction (host or device)
+   */
+  void contractFTMultiQuda(void **x, int n_x, void **y, int n_y, void *result, const QudaContractType cType,
+                           void *cs_param_ptr, const int *X, const int *const source_position, const int n_mom,
+                           const int *const mom_modes, const QudaFFTSymmType *const fft_type, const int n_gamma,
+                           const double *gamma, QudaFieldLocation location);
+
   /**
    * @brief Gauge fixing with overrelaxation with support for single and multi GPU.
    * @param[in,out] gauge, gauge field to be fixed
@@ -1857,6 +1956,20 @@ extern "C" {
    */
   void performTwoLinkGaussianSmearNStep(void *h_in, QudaQuarkSmearParam *smear_param);
 
+  /**
+   * Performs two-link Gaussian smearing on a set of spinors (for
+   * staggered fermions), as in performTwoLinkGaussianSmearNStep.  The
+   * two-link field is computed at most once per call, and is kept
+   * resident for later calls unless smear_param->delete_2link is set.
+   * The sources are smeared in tiles of up to QUDA_MAX_MULTI_RHS, with
+   * each application of the smearing operator applied to the whole
+   * tile at once.
+   * @param[in,out] h_in Array of input spinor fields to smear
+   * @param[in] n_src Number of spinor fields
+   * @param[in] smear_param Contains all metadata the operator which will be applied to the spinors
+   */
+  void performTwoLinkGaussianSmearNStepMultiSrc(void **h_in, int n_src, QudaQuarkSmearParam *smear_param);
+
   /**
    * @brief Performs contractions between a set of quark fields and
    * eigenvectors of the 3-d Laplace operator.
@@ -9,16 +9,24 @@ namespace quda {
   // The nature of the state is defined in the target-specific implementation
   struct RNGState;
 
+  // The state used for host-located fields (random_helper_host.h)
+  struct HostRNGState;
+
   /**
      @brief Class declaration to initialize and hold RNG states
   */
   class RNG
   {
 
-    size_t size;                     /*! @brief number of curand states */
-    std::shared_ptr<RNGState> state; /*! array with current curand rng state */
-    RNGState *backup_state;          /*! array for backup of current curand rng state */
-    unsigned long long seed;         /*! initial rng seed */
+    size_t size;                              /*! @brief number of curand states */
+    QudaFieldLocation location;               /*! location of the rng states */
+    std::shared_ptr<RNGState> state;          /*! array with current curand rng state */
+    std::shared_ptr<HostRNGState> host_state; /*! array with current host rng state */
+    void *backup_state;                       /*! array for backup of current rng state */
+    unsigned long long seed;                  /*! initial rng seed */
+
+    /*! @brief Size in bytes of the rng state array */
+    size_t Bytes() const;
 
   public:
     /**
@@ -26,8 +34,12 @@ namespace quda {
        takes its metadata from pre-existing field
        @param[in] meta The field whose data we use
        @param[in] seed Seed to initialize the RNG
+       @param[in] location Location of the states: device states are
+       used with device fields and host states (HostRNGState) with
+       host fields
     */
-    RNG(const LatticeField &meta, unsigned long long seedin);
+    RNG(const LatticeField &meta, unsigned long long seedin,
+        QudaFieldLocation location = QUDA_CUDA_FIELD_LOCATION);
 
     unsigned long long Seed() { return seed; };
 
@@ -38,6 +50,50 @@ namespace quda {
     void backup();
 
     /*! @brief Get pointer to RNGState */
-    RNGState *State() { return state.get(); };
+    RNGState *State()
+    {
+      if (location != QUDA_CUDA_FIELD_LOCATION) errorQuda("RNG states are not on the device");
+      return state.get();
+    };
+
+    /*! @brief Get pointer to HostRNGState */
+    HostRNGState *HostState()
+    {
+      if (location != QUDA_CPU_FIELD_LOCATION) errorQuda("RNG states are not on the host");
+      return host_state.get();
+    };
+
+    /*! @brief Location of the rng states */
+    QudaFieldLocation Location() const { return location; }
+  };
+
+  /**
+     @brief Counter-based (Philox4x32-10) random number generator.
+     No state array is stored: the random numbers drawn at a site are
+     a pure function of the seed, the global site index and the call
+     counter, so they are independent of the partitioning, and the
+     host and device streams are identical.  Each field generated
+     from this generator advances the call counter by one.
+  */
+  class CounterRNG
+  {
+    unsigned long long seed; /*! rng seed */
+    uint64_t counter;        /*! call counter */
+
+  public:
+    /**
+       @brief Constructor for a counter-based generator
+       @param[in] seed Seed of the generator
+       @param[in] counter Initial value of the call counter
+    */
+    CounterRNG(unsigned long long seed, uint64_t counter = 0) : seed(seed), counter(counter) { }
+
+    unsigned long long Seed() const { return seed; }
+
+    /*! @brief Current value of the call counter */
+    uint64_t Counter() const { return counter; }
+
+    /*! @brief Advance the call counter, once the current value has been consumed */
+    void advance() { counter++; }
   };
 }
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+   @file reproducible_sum.h
+
+   @section DESCRIPTION
+   Helpers for reproducible floating-point summation.  Each summand is
+   converted into a fixed-point representation relative to a common
+   exponent, stored as a short array of signed 64-bit limbs.  Integer
+   addition is associative, so the limbs can be summed in any order
+   (e.g., with MPI_Allreduce) and the result converted back to a
+   double is bitwise identical regardless of the reduction order or
+   the number of partial sums.
+ */
+
+namespace quda
+{
+
+  namespace reproducible
+  {
+
+    /** Number of limbs used for each fixed-point value */
+    constexpr int n_limb = 3;
+
+    /** Number of bits stored in each limb */
+    constexpr int limb_bits = 32;
+
+    /**
+       @brief Return the common exponent to use for a set of summands
+       whose maximum magnitude is max_abs, such that every summand
+       satisfies |x| < 2^exponent.
+       @param[in] max_abs The maximum absolute value of the summands
+       @return The exponent
+     */
+    inline int exponent(double max_abs)
+    {
+      int e = 0;
+      std::frexp(max_abs, &e);
+      return e;
+    }
+
+    /**
+       @brief Convert a double into fixed-point limbs relative to
+       2^exponent.  The conversion retains n_limb * limb_bits bits
+       below 2^exponent, with any lower bits truncated toward zero.
+       Each limb has magnitude less than 2^limb_bits, so up to
+       2^(63 - limb_bits) values can be summed limb-wise without
+       overflow.
+       @param[out] limb The fixed-point limbs, most significant first
+       @param[in] x The value to convert, requiring |x| < 2^exponent
+       @param[in] exponent The common exponent
+     */
+    inline void to_fixed(int64_t limb[n_limb], double x, int exponent)
+    {
+      double r = std::ldexp(x, -exponent);
+      for (int k = 0; k < n_limb; k++) {
+        r = std::ldexp(r, limb_bits);
+        double l = std::trunc(r);
+        limb[k] = static_cast<int64_t>(l);
+        r -= l; // exact since l is the integer part of r
+      }
+    }
+
+    /**
+       @brief Convert a sum of fixed-point limbs back to a double.
+       The carries are first propagated so that all but the leading
+       limb lie in [0, 2^limb_bits), and the limbs are then
+       accumulated from least to most significant.  The result depends
+       only on the limb values, not on how they were summed.
+       @param[in] limb The fixed-point limbs, most significant first
+       @param[in] exponent The common exponent
+       @return The value as a double
+     */
+    inline double from_fixed(const int64_t limb[n_limb], int exponent)
+    {
+      constexpr int64_t base = int64_t(1) << limb_bits;
+      int64_t l[n_limb];
+      for (int k = 0; k < n_limb; k++) l[k] = limb[k];
+
+      for (int k = n_limb - 1; k > 0; k--) {
+        int64_t lo = l[k] & (base - 1);
+        l[k - 1] += (l[k] - lo) / base;
+        l[k] = lo;
+      }
+
+      double sum = 0.0;
+      for (int k = n_limb - 1; k >= 0; k--) sum += std::ldexp(static_cast<double>(l[k]), exponent - limb_bits * (k + 1));
+      return sum;
+    }
+
+    /**
+       @brief Reproducible in-place global sum of an array of doubles.
+       Each partial sum is converted to fixed point relative to the
+       global maximum magnitude, and the limbs are summed as integers,
+       which is exact and so independent of the reduction order, with
+       O(size) rather than O(P * size) traffic.  Non-finite values are
+       mapped to infinity in the magnitude reduction so all ranks agree
+       on falling back to a plain floating-point sum.  The
+       communication is supplied by the caller, so this is shared by
+       the communicator backends.
+       @param[in,out] data The local partial sums, overwritten with the global sums
+       @param[in] size The number of elements
+       @param[in] max_reduce Global elementwise max: max_reduce(const double *in, double *out, size_t n)
+       @param[in] sum_reduce Global elementwise sum: sum_reduce(const double *in, double *out, size_t n)
+       @param[in] limb_reduce Global elementwise sum: limb_reduce(const int64_t *in, int64_t *out, size_t n)
+     */
+    template <typename MaxReduce, typename SumReduce, typename LimbReduce>
+    void allreduce_sum(double *data, size_t size, MaxReduce &&max_reduce, SumReduce &&sum_reduce,
+                       LimbReduce &&limb_reduce)
+    {
+      std::vector<double> max_abs(size);
+      for (size_t i = 0; i < size; i++)
+        max_abs[i] = std::isfinite(data[i]) ? std::abs(data[i]) : std::numeric_limits<double>::infinity();
+      std::vector<double> max_recv(size);
+      max_reduce(max_abs.data(), max_recv.data(), size);
+
+      if (!std::all_of(max_recv.begin(), max_recv.end(), [](double x) { return std::isfinite(x); })) {
+        // the result is not finite regardless of summation order
+        std::vector<double> recv(size);
+        sum_reduce(data, recv.data(), size);
+        std::copy(recv.begin(), recv.end(), data);
+        return;
+      }
+
+      std::vector<int64_t> limb(size * n_limb, 0);
+      for (size_t i = 0; i < size; i++)
+        if (max_recv[i] > 0.0) to_fixed(&limb[i * n_limb], data[i], exponent(max_recv[i]));
+
+      std::vector<int64_t> limb_recv(size * n_limb);
+      limb_reduce(limb.data(), limb_recv.data(), size * n_limb);
+
+      for (size_t i = 0; i < size; i++)
+        data[i] = max_recv[i] > 0.0 ? from_fixed(&limb_recv[i * n_limb], exponent(max_recv[i])) : 0.0;
+    }
+
+  } // namespace reproducible
+
+} // namespace quda
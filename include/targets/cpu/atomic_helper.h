@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array.h>
+#include <algorithm>
+
+/**
+   @file atomic_helper.h
+
+   @section Provides definitions of atomic functions that are used in
+   QUDA.  On the CPU target these are OpenMP atomics.
+ */
+
+namespace quda
+{
+
+  /**
+     @brief atomic_fetch_add function performs similarly as atomic_ref::fetch_add
+     @param[in,out] addr The memory address of the variable we are
+     updating atomically
+     @param[in] val The value we summing to the value at addr
+  */
+  template <typename T> inline void atomic_fetch_add(T *addr, T val)
+  {
+#pragma omp atomic update
+    *addr += val;
+  }
+
+  template <typename T> inline void atomic_fetch_add(complex<T> *addr, complex<T> val)
+  {
+    atomic_fetch_add(reinterpret_cast<T *>(addr) + 0, val.real());
+    atomic_fetch_add(reinterpret_cast<T *>(addr) + 1, val.imag());
+  }
+
+  template <typename T, int n> inline void atomic_fetch_add(array<T, n> *addr, array<T, n> val)
+  {
+    for (int i = 0; i < n; i++) atomic_fetch_add(&(*addr)[i], val[i]);
+  }
+
+  inline void atomic_fetch_add(int4 *addr, int4 val)
+  {
+    atomic_fetch_add(reinterpret_cast<int *>(addr) + 0, val.x);
+    atomic_fetch_add(reinterpret_cast<int *>(addr) + 1, val.y);
+    atomic_fetch_add(reinterpret_cast<int *>(addr) + 2, val.z);
+    atomic_fetch_add(reinterpret_cast<int *>(addr) + 3, val.w);
+  }
+
+  /**
+     @brief atomic_fetch_max function that does an atomic max.
+     @param[in,out] addr The memory address of the variable we are
+     updating atomically
+     @param[in] val The value we are comparing against.  Must be
+     positive valued else result is undefined.
+  */
+  template <typename T> inline void atomic_fetch_abs_max(T *addr, T val)
+  {
+#pragma omp critical
+    *addr = std::max(*addr, val);
+  }
+
+  struct fetch_add_atomic_t {
+    template <class T> inline void operator()(T *out, T in) { atomic_fetch_add(out, in); }
+  };
+
+} // namespace quda
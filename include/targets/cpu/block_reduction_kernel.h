@@ -0,0 +1,46 @@
+#pragma once
+
+#include <target_device.h>
+#include <reduce_helper.h>
+#include <block_reduction_kernel_host.h>
+
+namespace quda
+{
+
+  /**
+     @brief This class is derived from the arg class that the functor
+     creates and curries in the block size.  This allows the block
+     size to be set statically at launch time in the actual argument
+     class that is passed to the kernel.
+   */
+  template <unsigned int block_size_, typename Arg_> struct BlockKernelArg : Arg_ {
+    using Arg = Arg_;
+    static constexpr unsigned int block_size = block_size_;
+    BlockKernelArg(const Arg &arg) : Arg(arg) { }
+  };
+
+  /**
+     @brief BlockKernel2D is the entry point of the generic block
+     kernel on the CPU target.  Block kernels split the work of a
+     block across its threads (Arg::block_size of them), which
+     requires the block to be executed cooperatively, so only the
+     single-thread block instantiation is supported here.
+
+     @tparam Functor Kernel functor that defines the kernel
+     @tparam Arg Kernel argument struct that set any required meta
+     data for the kernel
+     @tparam grid_stride Whether the kernel does multiple computations
+     per thread (in the x dimension).  Not supported at present.
+     @param[in] arg Kernel argument
+  */
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false> void BlockKernel2D(const void *arg)
+  {
+    static_assert(!grid_stride, "grid_stride not supported for BlockKernel");
+    if constexpr (Arg::block_size == 1) {
+      BlockKernel2D_host<Functor>(*static_cast<const Arg *>(arg));
+    } else {
+      errorQuda("Block kernels with block size %u are not supported on the CPU target", Arg::block_size);
+    }
+  }
+
+} // namespace quda
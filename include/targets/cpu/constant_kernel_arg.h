@@ -0,0 +1,12 @@
+#pragma once
+
+#include <target_device.h>
+
+/**
+   @file constant_kernel_arg.h
+
+   This file is included in the kernel files for which we wish to
+   utilize __constant__ memory for the kernel parameter struct.  The
+   CPU target always passes the parameter struct by reference, so
+   there is nothing to do here.
+ */
@@ -0,0 +1,43 @@
+#pragma once
+#include <kernel_helper.h>
+#include <target_device.h>
+#include <kernel_host.h>
+
+/**
+   @file kernel.h
+
+   @section Kernel entry points for the CPU target.  Each entry point
+   has the type-erased signature void(const void *) so that it can be
+   passed through kernel_t and qudaLaunchKernel like a device kernel
+   symbol; the body runs the corresponding OpenMP host loop.
+ */
+
+namespace quda
+{
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false> void Kernel1D(const void *arg)
+  {
+    Kernel1D_host<Functor, Arg>(*static_cast<const Arg *>(arg));
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false> void Kernel2D(const void *arg)
+  {
+    Kernel2D_host<Functor, Arg>(*static_cast<const Arg *>(arg));
+  }
+
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false> void Kernel3D(const void *arg)
+  {
+    Kernel3D_host<Functor, Arg>(*static_cast<const Arg *>(arg));
+  }
+
+  /**
+     @brief Raw kernels take responsibility for their own thread
+     assignment and typically rely on cooperation between the threads
+     of a block, which has no equivalent on the CPU target.
+  */
+  template <template <typename> class Functor, typename Arg, bool grid_stride = false> void raw_kernel(const void *)
+  {
+    errorQuda("Raw kernels are not supported on the CPU target");
+  }
+
+} // namespace quda
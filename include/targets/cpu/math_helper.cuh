@@ -0,0 +1,3 @@
+#pragma once
+
+#include "../generic/math_helper.h"
@@ -0,0 +1,103 @@
+#pragma once
+
+// standard headers that the GPU runtime headers provide transitively
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+/**
+   @file quda_cpu.h
+
+   @section This file provides the host-side definitions of the
+   language extensions and built-in types that the kernel code expects
+   from a GPU compiler (function-space qualifiers, vector types,
+   dim3 and the block-level intrinsics).  On the CPU target every
+   thread block consists of a single thread, so the synchronization
+   intrinsics are no-ops.
+ */
+
+#define __host__
+#define __device__
+#define __global__
+#define __shared__
+#define __constant__
+#define __forceinline__ inline __attribute__((always_inline))
+#define __launch_bounds__(...)
+
+#define QUDA_CPU_VECTOR_TYPE(T, name, align2, align4)                                                                   \
+  struct alignas(align2) name##2 {                                                                                     \
+    T x, y;                                                                                                            \
+  };                                                                                                                   \
+  struct name##3 {                                                                                                     \
+    T x, y, z;                                                                                                         \
+  };                                                                                                                   \
+  struct alignas(align4) name##4 {                                                                                     \
+    T x, y, z, w;                                                                                                      \
+  };                                                                                                                   \
+  constexpr name##2 make_##name##2(T x, T y) { return {x, y}; }                                                        \
+  constexpr name##3 make_##name##3(T x, T y, T z) { return {x, y, z}; }                                                \
+  constexpr name##4 make_##name##4(T x, T y, T z, T w) { return {x, y, z, w}; }
+
+// alignments match those of the CUDA built-in vector types
+QUDA_CPU_VECTOR_TYPE(signed char, char, 2, 4)
+QUDA_CPU_VECTOR_TYPE(unsigned char, uchar, 2, 4)
+QUDA_CPU_VECTOR_TYPE(short, short, 4, 8)
+QUDA_CPU_VECTOR_TYPE(unsigned short, ushort, 4, 8)
+QUDA_CPU_VECTOR_TYPE(int, int, 8, 16)
+QUDA_CPU_VECTOR_TYPE(unsigned int, uint, 8, 16)
+QUDA_CPU_VECTOR_TYPE(long long, longlong, 16, 16)
+QUDA_CPU_VECTOR_TYPE(unsigned long long, ulonglong, 16, 16)
+QUDA_CPU_VECTOR_TYPE(float, float, 8, 16)
+QUDA_CPU_VECTOR_TYPE(double, double, 16, 16)
+
+#undef QUDA_CPU_VECTOR_TYPE
+
+/**
+   @brief Host equivalent of the CUDA dim3 type
+ */
+struct dim3 {
+  unsigned int x, y, z;
+  constexpr dim3(unsigned int x = 1, unsigned int y = 1, unsigned int z = 1) : x(x), y(y), z(z) { }
+  constexpr dim3(uint3 v) : x(v.x), y(v.y), z(v.z) { }
+  constexpr operator uint3() const { return {x, y, z}; }
+};
+
+/**
+   @brief Each thread block is a single thread on the CPU target, so
+   a block-wide barrier is a no-op.
+ */
+inline void __syncthreads() { }
+
+/**
+   @brief Memory fence: a no-op on the CPU target since there is no
+   cross-block communication in a kernel.
+ */
+inline void __threadfence() { }
+
+inline unsigned int __float_as_uint(float x)
+{
+  unsigned int y;
+  memcpy(&y, &x, sizeof(y));
+  return y;
+}
+
+inline float __uint_as_float(unsigned int x)
+{
+  float y;
+  memcpy(&y, &x, sizeof(y));
+  return y;
+}
+
+inline int __float_as_int(float x)
+{
+  int y;
+  memcpy(&y, &x, sizeof(y));
+  return y;
+}
+
+inline float __int_as_float(int x)
+{
+  float y;
+  memcpy(&y, &x, sizeof(y));
+  return y;
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <quda_internal.h>
+#include <target_device.h>
+#include <block_reduce_helper.h>
+#include <kernel_helper.h>
+
+using count_t = unsigned int;
+
+namespace quda
+{
+
+  // declaration of reduce function
+  template <typename Reducer, typename Arg, typename T>
+  inline void reduce(Arg &arg, const Reducer &r, const T &in, const int idx = 0);
+
+  /**
+     @brief ReduceArg is the argument type that all kernel arguments
+     shoud inherit from if the kernel is to utilize global reductions.
+     @tparam T the type that will be reduced
+     @tparam use_kernel_arg Whether the kernel will source the
+     parameter struct as an explicit kernel argument or from constant
+     memory
+   */
+  template <typename T, use_kernel_arg_p use_kernel_arg = use_kernel_arg_p::TRUE>
+  struct ReduceArg : kernel_param<use_kernel_arg> {
+    using reduce_t = T;
+
+    template <typename Reducer, typename Arg, typename I>
+    friend void reduce(Arg &, const Reducer &, const I &, const int);
+    qudaError_t launch_error; /** only do complete if no launch error to avoid hang */
+    static constexpr unsigned int max_n_batch_block
+      = 1; /** by default reductions do not support batching withing the block */
+
+  private:
+    const int n_reduce; /** number of reductions of length n_item */
+    T *result_d;        /** device-mapped host buffer */
+    T *result_h;        /** host buffer */
+    T *device_output_async_buffer = nullptr; // Optional device output buffer for the reduction result
+
+  public:
+    /**
+       @brief Constructor for ReduceArg
+       @param[in] threads The number threads partaking in the kernel
+       @param[in] n_reduce The number of reductions
+    */
+    ReduceArg(dim3 threads, int n_reduce = 1, bool = false) :
+      kernel_param<use_kernel_arg>(threads), launch_error(QUDA_ERROR_UNINITIALIZED), n_reduce(n_reduce)
+    {
+      reducer::init(n_reduce, sizeof(*result_d));
+      // these buffers may be allocated in init, so we can't set the local copies until now
+      result_d = static_cast<decltype(result_d)>(reducer::get_mapped_buffer());
+      result_h = static_cast<decltype(result_h)>(reducer::get_host_buffer());
+
+      if (commAsyncReduction()) result_d = static_cast<decltype(result_d)>(reducer::get_device_buffer());
+    }
+
+    /**
+      @brief Set device_output_async_buffer
+    */
+    void set_output_async_buffer(T *ptr)
+    {
+      if (!commAsyncReduction()) {
+        errorQuda("When setting the asynchronous buffer the commAsyncReduction option must be set.");
+      }
+      device_output_async_buffer = ptr;
+    }
+
+    /**
+      @brief Get device_output_async_buffer
+    */
+    T *get_output_async_buffer() const { return device_output_async_buffer; }
+
+    /**
+       @brief Finalize the reduction, returning the computed reduction
+       into result.  Kernels complete before the launch returns on the
+       CPU target, so the result is already in the host buffer.
+       @param[out] result The reduction result is copied here
+       @param[in] stream The stream on which we the reduction is being done
+     */
+    template <typename host_t, typename device_t = host_t>
+    void complete(std::vector<host_t> &result, const qudaStream_t stream = device::get_default_stream())
+    {
+      if (launch_error == QUDA_ERROR) return; // kernel launch failed so return
+      if (launch_error == QUDA_ERROR_UNINITIALIZED) errorQuda("No reduction kernel appears to have been launched");
+      qudaStreamSynchronize(stream);
+
+      // copy back result element by element and convert if necessary to host reduce type
+      // unit size here may differ from system_atomic_t size, e.g., if doing double-double
+      const int n_element = n_reduce * sizeof(T) / sizeof(device_t);
+      if (result.size() != (unsigned)n_element)
+        errorQuda("result vector length %lu does not match n_reduce %d", result.size(), n_element);
+      for (int i = 0; i < n_element; i++) result[i] = reinterpret_cast<device_t *>(result_h)[i];
+    }
+  };
+
+  /**
+     @brief Reduction write-out for the CPU target.  The host kernel
+     has already reduced over the entire grid (x and y thread
+     dimensions) before calling this, so all that remains is to store
+     the result for batch index idx.
+
+     @param[in,out] arg The kernel argument, this must derive from ReduceArg
+     @param[in] r Instance of the reducer to be used in this reduction (unused)
+     @param[in] in The fully reduced value
+     @param[in] idx In the case of multiple reductions, idx identifies
+     which reduction this value corresponds to
+  */
+  template <typename Reducer, typename Arg, typename T>
+  inline void reduce(Arg &arg, const Reducer &, const T &in, const int idx)
+  {
+    if (arg.get_output_async_buffer()) {
+      arg.get_output_async_buffer()[idx] = in;
+    } else {
+      arg.result_d[idx] = in;
+    }
+  }
+
+} // namespace quda
@@ -0,0 +1,49 @@
+#pragma once
+#include <target_device.h>
+#include <reduce_helper.h>
+#include <reduction_kernel_host.h>
+
+namespace quda
+{
+
+  /**
+     @brief Reduction2D is the entry point of the generic 2-d
+     reduction kernel on the CPU target.  The OpenMP host reduction
+     contracts both the x and y thread dimensions, and the result is
+     then written out through the ReduceArg buffers so that the
+     completion path is the same as on the GPU targets.
+
+     @tparam Functor Kernel functor that defines the kernel
+     @tparam Arg Kernel argument struct that set any required meta
+     data for the kernel
+     @tparam grid_stride Unused on the CPU target
+     @param[in] arg Kernel argument
+   */
+  template <template <typename> class Functor, typename Arg, bool grid_stride = true> void Reduction2D(const void *arg)
+  {
+    auto &arg_ = *const_cast<Arg *>(static_cast<const Arg *>(arg));
+    auto value = Reduction2D_host<Functor, Arg>(arg_);
+    reduce(arg_, Functor<Arg>(arg_), value);
+  }
+
+  /**
+     @brief MultiReduction is the entry point of the generic
+     multi-reduction kernel on the CPU target.  The x and y thread
+     dimensions are contracted, and the z thread dimension is the
+     batch dimension, with each batch result written to its own slot.
+
+     @tparam Functor Kernel functor that defines the kernel
+     @tparam Arg Kernel argument struct that set any required meta
+     data for the kernel
+     @tparam grid_stride Unused on the CPU target
+     @param[in] arg Kernel argument
+   */
+  template <template <typename> class Functor, typename Arg, bool grid_stride = true> void MultiReduction(const void *arg)
+  {
+    auto &arg_ = *const_cast<Arg *>(static_cast<const Arg *>(arg));
+    auto value = MultiReduction_host<Functor, Arg>(arg_);
+    Functor<Arg> t(arg_);
+    for (int j = 0; j < static_cast<int>(arg_.threads.z); j++) reduce(arg_, t, value[j], j);
+  }
+
+} // namespace quda
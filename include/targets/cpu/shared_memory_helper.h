@@ -0,0 +1,89 @@
+#pragma once
+
+#include <target_device.h>
+#include <kernel_ops.h>
+#include <shared_memory_host.h>
+
+/**
+   @file shared_memory_helper.h
+
+   Target specific helper for allocating and accessing shared memory.
+   On the CPU target each thread block is executed by a single host
+   thread, so "shared" memory is a per-thread scratch buffer.
+ */
+
+namespace quda
+{
+
+  namespace device
+  {
+
+    /**
+       @brief The size of the per-thread buffer that backs shared
+       memory on the CPU target.
+    */
+    constexpr size_t max_shared_memory_size() { return host_shared_memory_size(); }
+
+  } // namespace device
+
+  /**
+     @brief Class which is used to allocate and access shared memory.
+     The shared memory is treated as an array of type T, with the
+     number of elements given by a call to the static member
+     S::size(target::block_dim()).  The byte offset from the beginning
+     of the total shared memory block is given by the static member
+     O::shared_mem_size(target::block_dim()), or 0 if O is void.
+   */
+  template <typename T, typename S, typename O = void> class SharedMemory
+  {
+  public:
+    using value_type = T;
+
+  private:
+    T *data;
+
+    static T *cache(unsigned int offset)
+    {
+      return reinterpret_cast<T *>(host_shared_memory(shared_mem_size(target::block_dim())) + offset);
+    }
+
+  public:
+    /**
+       @brief Byte offset for this shared memory object.
+    */
+    static constexpr unsigned int get_offset(dim3 block)
+    {
+      unsigned int o = 0;
+      if constexpr (!std::is_same_v<O, void>) { o = O::shared_mem_size(block); }
+      return o;
+    }
+
+    /**
+       @brief Shared memory size in bytes.
+    */
+    static constexpr unsigned int shared_mem_size(dim3 block) { return get_offset(block) + S::size(block) * sizeof(T); }
+
+    /**
+       @brief Constructor for SharedMemory object.
+    */
+    SharedMemory() : data(cache(get_offset(target::block_dim()))) { }
+
+    /**
+       @brief Constructor for SharedMemory object.
+    */
+    template <typename... U> SharedMemory(const KernelOps<U...> &) : data(cache(get_offset(target::block_dim()))) { }
+
+    /**
+       @brief Return this SharedMemory object.
+    */
+    constexpr auto sharedMem() const { return *this; }
+
+    /**
+       @brief Subscripting operator returning a reference to element.
+       @param[in] i The index to use.
+       @return Reference to value stored at that index.
+     */
+    T &operator[](int i) const { return data[i]; }
+  };
+
+} // namespace quda
@@ -0,0 +1,163 @@
+#pragma once
+#include <quda_arch.h>
+#include <quda_api.h>
+#include <algorithm>
+
+/**
+   @file target_device.h
+
+   @section Target helpers for the CPU target.  There is no device
+   compilation pass on this target: all kernels are executed on the
+   host, with each OpenMP thread executing a sequence of
+   single-thread blocks.
+ */
+
+namespace quda
+{
+
+  namespace target
+  {
+
+    /**
+       @brief Dispatch always selects the host variant on the CPU target
+    */
+    template <template <bool, typename...> class f, typename... Args> auto dispatch(Args &&...args)
+    {
+      return f<false>()(args...);
+    }
+
+    /**
+       @brief Helper function that returns if the current execution
+       region is on the device
+    */
+    constexpr bool is_device() { return false; }
+
+    /**
+       @brief Helper function that returns if the current execution
+       region is on the host
+    */
+    constexpr bool is_host() { return true; }
+
+    /**
+       @brief Helper function that returns the thread block
+       dimensions.  On the CPU target this is always (1, 1, 1).
+    */
+    constexpr dim3 block_dim() { return dim3(1, 1, 1); }
+
+    /**
+       @brief Helper function that returns the grid dimensions.  On
+       the CPU target this is always (1, 1, 1).
+    */
+    constexpr dim3 grid_dim() { return dim3(1, 1, 1); }
+
+    /**
+       @brief Helper function that returns the block indices.  On the
+       CPU target this is always (0, 0, 0).
+    */
+    constexpr dim3 block_idx() { return dim3(0, 0, 0); }
+
+    /**
+       @brief Helper function that returns the thread indices within a
+       thread block.  On the CPU target this is always (0, 0, 0).
+    */
+    constexpr dim3 thread_idx() { return dim3(0, 0, 0); }
+
+    /**
+       @brief Helper function that returns a linear thread index within a thread block.
+    */
+    template <int> constexpr unsigned int thread_idx_linear() { return 0; }
+
+    /**
+       @brief Helper function that returns the total number thread in a thread block
+    */
+    template <int> constexpr unsigned int block_size() { return 1; }
+
+  } // namespace target
+
+  namespace device
+  {
+
+    /**
+       @brief Helper function that returns the warp-size of the
+       architecture we are running on.
+    */
+    constexpr int warp_size() { return 1; }
+
+    /**
+       @brief Return the thread mask for a converged warp.
+    */
+    constexpr unsigned int warp_converged_mask() { return 0x1; }
+
+    /**
+       @brief Helper function that returns the maximum number of threads
+       in a block in the x dimension.  This only bounds the launch
+       parameters the autotuner may consider, since each block is
+       executed by a single thread.
+    */
+    template <int block_size_y = 1, int block_size_z = 1> constexpr unsigned int max_block_size()
+    {
+      return std::max(warp_size(), 1024 / (block_size_y * block_size_z));
+    }
+
+    /**
+       @brief Helper function that returns the maximum size of a
+       __constant__ buffer on the target architecture.  There is no
+       constant memory on the CPU target, but this bound is used to
+       size the parameter structs of the multi-blas kernels, so we
+       use the same 32 KiB as the GPU targets.
+    */
+    constexpr size_t max_constant_size() { return 32768; }
+
+    /**
+       @brief Helper function that returns the maximum static size of
+       the kernel arguments passed to a kernel on the target
+       architecture.  Arguments are passed by reference on the CPU
+       target, so this is only a bound on the parameter struct size.
+    */
+    constexpr size_t max_kernel_arg_size() { return max_constant_size(); }
+
+    /**
+       @brief Helper function that returns true if we are to pass the
+       kernel parameter struct to the kernel as an explicit kernel
+       argument.  This is always the case on the CPU target.
+    */
+    template <typename Arg> constexpr bool use_kernel_arg() { return true; }
+
+    /**
+       @brief Helper function that returns kernel argument from
+       __constant__ memory.  There is no __constant__ memory on the
+       CPU target and the kernel argument is always passed
+       explicitly (see use_kernel_arg), so instantiating this is a
+       compile-time error.
+     */
+    template <typename Arg> inline const Arg &get_arg()
+    {
+      static_assert(sizeof(Arg) == 0, "get_arg() is not supported on the CPU target");
+    }
+
+    /**
+       @brief Helper function that returns a pointer to the
+       __constant__ memory buffer.  Note this is the dummy
+       implementation, and is present only to keep the compiler happy.
+     */
+    template <typename Arg> constexpr void *get_constant_buffer() { return nullptr; }
+
+    template <typename Tag> constexpr int get_default_kernel1D_launch_bounds() { return 1024; }
+
+    template <typename Tag> constexpr int get_default_kernel2D_launch_bounds() { return 1024; }
+
+    template <typename Tag> constexpr int get_default_kernel3D_launch_bounds() { return 1024; }
+
+    template <typename Tag> constexpr int get_default_reduction_launch_bounds() { return 1024; }
+
+    template <typename Tag> constexpr int get_default_multireduction_launch_bounds() { return 1024; }
+
+    /**
+     @brief Return the maximum number of threads per block for block
+     ortho routines.
+    */
+    template <typename Tag> constexpr int get_max_ortho_block_size() { return 1024; }
+
+  } // namespace device
+
+} // namespace quda
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <tune_quda.h>
+#include <target_device.h>
+#include <lattice_field.h>
+#include <kernel_helper.h>
+#include <kernel.h>
+#include <kernel_ops_target.h>
+
+namespace quda
+{
+
+  /**
+      @brief Launch a CPU-target kernel.  The launch is synchronous
+      with respect to the host: streams are in-order queues, so once
+      this returns the work has completed.
+      @param[in] func Kernel entry point (of type void(const void *))
+      @param[in] tp TuneParam containing the launch parameters
+      @param[in] stream Stream identifier
+      @param[in] arg Host address of argument struct
+   */
+  qudaError_t qudaLaunchKernel(const void *func, const TuneParam &tp, const qudaStream_t &stream, const void *arg);
+
+  /**
+     @brief This helper function indicates if the present
+     compilation unit has explicit constant memory usage enabled.
+     There is no constant memory on the CPU target.
+  */
+  static constexpr bool use_constant_memory() { return false; }
+
+  class TunableKernel : public Tunable
+  {
+
+  protected:
+    QudaFieldLocation location;
+
+    template <template <typename> class Functor, bool grid_stride, typename Arg>
+    qudaError_t launch_device(const kernel_t &kernel, const TuneParam &tp, const qudaStream_t &stream, const Arg &arg)
+    {
+      launch_error = qudaLaunchKernel(kernel.func, tp, stream, static_cast<const void *>(&arg));
+      return launch_error;
+    }
+
+  public:
+    /**
+       @brief Special kernel launcher used for raw CUDA kernels with no
+       assumption made about shape of parallelism.  These are not
+       supported on the CPU target.
+     */
+    template <template <typename> class Functor, typename Arg>
+    void launch_cuda(const TuneParam &tp, const qudaStream_t &stream, const Arg &arg) const
+    {
+      constexpr bool grid_stride = false;
+      const_cast<TunableKernel *>(this)->launch_device<Functor, grid_stride>(KERNEL(raw_kernel), tp, stream, arg);
+    }
+
+    TunableKernel(const LatticeField &field, QudaFieldLocation location = QUDA_INVALID_FIELD_LOCATION) :
+      location(location != QUDA_INVALID_FIELD_LOCATION ? location : field.Location())
+    {
+      strcpy(vol, field.VolString().c_str());
+      strcpy(aux, compile_type_str(field, location));
+      strcat(aux, getOmpThreadStr());
+      strcat(aux, field.AuxString().c_str());
+    }
+
+    TunableKernel(size_t n_items, QudaFieldLocation location = QUDA_INVALID_FIELD_LOCATION) : location(location)
+    {
+      u64toa(vol, n_items);
+      strcpy(aux, compile_type_str(location));
+      strcat(aux, getOmpThreadStr());
+    }
+
+    /**
+       @brief The launch geometry has no effect on the CPU target
+       since each block is executed by a single thread, so there is
+       nothing to tune.
+     */
+    virtual bool advanceTuneParam(TuneParam &) const override { return false; }
+
+    TuneKey tuneKey() const override { return TuneKey(vol, typeid(*this).name(), aux); }
+  };
+
+} // namespace quda
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <target_device.h>
+
+namespace quda
+{
+
+  /**
+     @brief Combine the partial results of a warp split.  Warp
+     fission is only used on the device, so on the CPU target each
+     thread already holds the complete result.
+  */
+  template <int warp_split, typename T> inline T warp_combine(T &x) { return x; }
+
+} // namespace quda
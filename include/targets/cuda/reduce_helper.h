@@ -281,7 +281,7 @@ namespace quda
     using atomic_t = typename atomic_type<T>::type;
     constexpr size_t n = sizeof(T) / sizeof(atomic_t);
     constexpr auto n_batch_block = std::min(Arg::max_n_batch_block, device::max_block_size());
-    using BlockReduce = BlockReduce<T, Reducer::reduce_block_dim, n_batch_block>;
+    using BlockReduce = quda::BlockReduce<T, Reducer::reduce_block_dim, n_batch_block>;
 
     T aggregate = BlockReduce(target::thread_idx().z).Reduce(in, r);
 
@@ -2,6 +2,7 @@
 
 #include <target_device.h>
 #include <kernel_ops.h>
+#include <shared_memory_host.h>
 
 /**
    @file shared_memory_helper.h
@@ -29,13 +30,15 @@ namespace quda
     T *data;
 
     /**
-       @brief This is a dummy instantiation for the host compiler
+       @brief This is the instantiation for the host compiler.  Host
+       kernels execute each thread block with a single host thread
+       (block_dim() is (1, 1, 1) on the host), so shared memory is
+       backed by a per-thread scratch buffer.
     */
     template <bool, typename dummy = void> struct cache_dynamic {
-      T *operator()(unsigned int)
+      T *operator()(unsigned int offset)
       {
-        static T *cache_;
-        return cache_;
+        return reinterpret_cast<T *>(host_shared_memory(offset + S::size(dim3(1, 1, 1)) * sizeof(T)) + offset);
       }
     };
 
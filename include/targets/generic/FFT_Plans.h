@@ -1,15 +1,25 @@
 #pragma once
 
 #include <quda_internal.h>
+#include <FFT_Plans_host.h>
 
-// Dummy implementation that does nothing
-
-#define FFT_FORWARD 0
+#define FFT_FORWARD -1
 #define FFT_INVERSE 1
 
 namespace quda
 {
 
+#ifdef QUDA_TARGET_CPU
+
+  // device memory is host memory, so use the host FFTs
+  using FFTPlanHandle = FFTHostPlanHandle;
+
+  inline static constexpr bool HaveFFT() { return true; }
+
+#else
+
+  // Dummy implementation that does nothing
+
   typedef struct {
     bool isDouble;
   } FFTPlanHandle;
@@ -26,4 +36,6 @@ namespace quda
 
   inline void FFTDestroyPlan(FFTPlanHandle &) { errorQuda("FFTs are disabled"); }
 
+#endif
+
 } // namespace quda
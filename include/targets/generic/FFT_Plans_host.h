@@ -0,0 +1,81 @@
+#pragma once
+
+#include <complex>
+#include <vector>
+#include <quda_internal.h>
+
+/**
+   @file FFT_Plans_host.h
+
+   @section DESCRIPTION
+   Host implementation of batched complex-to-complex FFTs, with the
+   same plan layouts and conventions as the device FFT plans:
+   transforms are unnormalized, the direction is the sign of the
+   exponent (-1 forward, +1 inverse), and the batches are contiguous
+   with the outer-most dimension first.  Each dimension is
+   transformed with a mixed-radix Stockham autosort FFT, with the
+   lines and batches distributed over OpenMP threads.
+ */
+
+namespace quda
+{
+
+  /**
+     @brief Plan for a batch of multi-dimensional FFTs on the host
+  */
+  struct FFTHostPlanHandle {
+    std::vector<int> n;                                     /** Transform dimensions, outer-most first */
+    std::vector<std::vector<int>> factor;                   /** Prime factors of each dimension */
+    std::vector<std::vector<std::complex<double>>> twiddle; /** exp(-2 pi i j / n) for each dimension */
+    int batch = 0;                                          /** Number of transforms */
+    QudaPrecision precision = QUDA_INVALID_PRECISION;       /** Precision of the data */
+  };
+
+  /**
+     @brief Perform a single-precision complex-to-complex transform on
+     the host in the direction specified
+     @param[in] plan The host FFT plan
+     @param[in] data_in Pointer to the complex input data (in host memory)
+     @param[out] data_out Pointer to the complex output data (in host memory), may equal data_in
+     @param[in] direction The transform direction: FFT_FORWARD or FFT_INVERSE
+  */
+  void ApplyFFT(FFTHostPlanHandle &plan, float2 *data_in, float2 *data_out, int direction);
+
+  /**
+     @brief Perform a double-precision complex-to-complex transform on
+     the host in the direction specified
+     @param[in] plan The host FFT plan
+     @param[in] data_in Pointer to the complex input data (in host memory)
+     @param[out] data_out Pointer to the complex output data (in host memory), may equal data_in
+     @param[in] direction The transform direction: FFT_FORWARD or FFT_INVERSE
+  */
+  void ApplyFFT(FFTHostPlanHandle &plan, double2 *data_in, double2 *data_out, int direction);
+
+  /**
+     @brief Creates a host FFT plan supporting 4D (1D+3D) data layouts
+     @param[out] plan The host FFT plan
+     @param[in] size int4 with lattice size dimensions, (.x,.y,.z,.w) -> (Nx, Ny, Nz, Nt)
+     @param[in] dim 1 for 1D plan along the temporal direction with batch size Nx*Ny*Nz, 3 for 3D plan along Nx, Ny and
+     Nz with batch size Nt
+     @param[in] precision The precision of the computation
+     @param[in] batch Number of consecutive lattice-sized fields to transform
+  */
+  void SetPlanFFTMany(FFTHostPlanHandle &plan, int4 size, int dim, QudaPrecision precision, int batch = 1);
+
+  /**
+     @brief Creates a host FFT plan supporting 4D (2D+2D) data layouts
+     @param[out] plan The host FFT plan
+     @param[in] size int4 with lattice size dimensions, (.x,.y,.z,.w) -> (Nx, Ny, Nz, Nt)
+     @param[in] dim 0 for 2D plan in Z-T planes with batch size Nx*Ny, 1 for 2D plan in X-Y planes with batch size Nz*Nt
+     @param[in] precision The precision of the computation
+     @param[in] batch Number of consecutive lattice-sized fields to transform
+  */
+  void SetPlanFFT2DMany(FFTHostPlanHandle &plan, int4 size, int dim, QudaPrecision precision, int batch = 1);
+
+  /**
+     @brief Release the resources of a host FFT plan
+     @param[in,out] plan The host FFT plan
+  */
+  void FFTDestroyPlan(FFTHostPlanHandle &plan);
+
+} // namespace quda
@@ -189,17 +189,27 @@ namespace quda
         skip(prn, subsequence, subsequenceBase);
       }
 
+      /**
+         @brief Remainder of an integer-valued double as computed by
+         fmod.  The recurrences in uniform() stay below 2^53 in
+         magnitude, so this is exact and, unlike fmod, constexpr.
+      */
+      constexpr double mod_exact(double x, double m)
+      {
+        return static_cast<double>(static_cast<int64_t>(x) % static_cast<int64_t>(m));
+      }
+
       constexpr double uniform(MRG32k3a &prn)
       {
         double p1 = a12 * (double)(prn.s1[1]) - a13n * (double)(prn.s1[0]);
-        p1 = fmod(p1, m1);
+        p1 = mod_exact(p1, m1);
         if (p1 < 0.0) p1 += m1;
         prn.s1[0] = prn.s1[1];
         prn.s1[1] = prn.s1[2];
         prn.s1[2] = static_cast<uint32_t>(p1);
 
         double p2 = a21 * (double)(prn.s2[2]) - a23n * (double)(prn.s2[0]);
-        p2 = fmod(p2, m2);
+        p2 = mod_exact(p2, m2);
         if (p2 < 0.0) p2 += m2;
         prn.s2[0] = prn.s2[1];
         prn.s2[1] = prn.s2[2];
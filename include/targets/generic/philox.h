@@ -0,0 +1,81 @@
+/*
+   An implementation of the Philox4x32-10 counter-based generator based on constexpr.
+   Original algorithm from
+      John K. Salmon, Mark A. Moraes, Ron O. Dror and David E. Shaw
+      Parallel Random Numbers: As Easy as 1, 2, 3
+      Proceedings of SC11 (2011), 16:1-16:12.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace quda
+{
+  namespace target
+  {
+    namespace rng
+    {
+
+      struct Philox4x32 {
+        uint32_t d[4];
+        constexpr uint32_t &operator[](int i) { return d[i]; }
+        constexpr const uint32_t &operator[](int i) const { return d[i]; }
+      };
+
+      struct Philox4x32Key {
+        uint32_t d[2];
+        constexpr uint32_t &operator[](int i) { return d[i]; }
+        constexpr const uint32_t &operator[](int i) const { return d[i]; }
+      };
+
+      constexpr uint32_t philoxM0 = 0xD2511F53;
+      constexpr uint32_t philoxM1 = 0xCD9E8D57;
+      constexpr uint32_t philoxW0 = 0x9E3779B9;
+      constexpr uint32_t philoxW1 = 0xBB67AE85;
+      constexpr int philoxRounds = 10;
+
+      constexpr void mulhilo(uint32_t a, uint32_t b, uint32_t &lo, uint32_t &hi)
+      {
+        uint64_t p = static_cast<uint64_t>(a) * b;
+        lo = static_cast<uint32_t>(p);
+        hi = static_cast<uint32_t>(p >> 32);
+      }
+
+      /**
+         @brief Apply the Philox4x32-10 bijection to a counter
+         @param[in] ctr The counter
+         @param[in] key The key
+         @return The four random words associated with (ctr, key)
+      */
+      constexpr Philox4x32 philox(Philox4x32 ctr, Philox4x32Key key)
+      {
+        for (int r = 0; r < philoxRounds; r++) {
+          uint32_t lo0 = 0, hi0 = 0, lo1 = 0, hi1 = 0;
+          mulhilo(philoxM0, ctr[0], lo0, hi0);
+          mulhilo(philoxM1, ctr[2], lo1, hi1);
+          ctr = Philox4x32 {{hi1 ^ ctr[1] ^ key[0], lo1, hi0 ^ ctr[3] ^ key[1], lo0}};
+          key[0] += philoxW0;
+          key[1] += philoxW1;
+        }
+        return ctr;
+      }
+
+      /**
+         @brief Return a uniform deviate in (0, 1] with 24 bits of
+         randomness from a single random word
+      */
+      constexpr float uniform_float(uint32_t a) { return ((a >> 8) + 1) * 5.9604644775390625e-08f; }
+
+      /**
+         @brief Return a uniform deviate in (0, 1] with 53 bits of
+         randomness from two random words
+      */
+      constexpr double uniform_double(uint32_t a, uint32_t b)
+      {
+        return ((static_cast<uint64_t>(a >> 5) << 26 | (b >> 6)) + 1) * 1.1102230246251565e-16;
+      }
+
+    } // namespace rng
+  }   // namespace target
+} // namespace quda
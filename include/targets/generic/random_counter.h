@@ -0,0 +1,132 @@
+#pragma once
+
+#include <philox.h>
+#include <random_quda.h>
+#include <comm_quda.h>
+
+/**
+   @file random_counter.h
+
+   @section DESCRIPTION
+   Counter-based (Philox4x32-10) random number generation, available
+   with every target and identical on the host and the device.  The
+   random numbers drawn at a site are a pure function of the seed,
+   the global lattice site index and the call counter of the
+   CounterRNG, so no state array is required and the noise does not
+   depend on the partitioning of the lattice.
+ */
+
+namespace quda
+{
+
+  /**
+     @brief Counter-based RNG state of a single site.  The key holds
+     the seed, while the counter holds the global site index (words 0
+     and 1), the call counter (word 2) and the index of the block of
+     four words drawn at this site (word 3).  The top bit of word 3
+     marks single-parity fields.
+  */
+  struct CounterRNGState {
+    target::rng::Philox4x32 ctr;
+    target::rng::Philox4x32Key key;
+    target::rng::Philox4x32 out;
+    int idx;
+  };
+
+  /**
+   * \brief random init
+   * @param [in] seed -- The RNG seed
+   * @param [in] site -- The global site index
+   * @param [in] counter -- The call counter
+   * @param [in,out] state - the RNG State
+   * @param [in] parity_subset -- Whether the site belongs to a single-parity field
+   */
+  constexpr void random_init(unsigned long long seed, uint64_t site, uint64_t counter, CounterRNGState &state,
+                             bool parity_subset = false)
+  {
+    state.key = {{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}};
+    state.ctr = {{static_cast<uint32_t>(site), static_cast<uint32_t>(site >> 32), static_cast<uint32_t>(counter),
+                  parity_subset ? 1u << 31 : 0u}};
+    state.out = {};
+    state.idx = 4;
+  }
+
+  /**
+     @brief Return the next random word from a counter-based state
+     @param[in,out] state The RNG state
+  */
+  constexpr uint32_t random_word(CounterRNGState &state)
+  {
+    if (state.idx == 4) {
+      state.out = target::rng::philox(state.ctr, state.key);
+      state.ctr[3]++;
+      state.idx = 0;
+    }
+    return state.out[state.idx++];
+  }
+
+  /**
+     @brief Return a uniform deviate in (0, 1] from a counter-based state
+     @param[in,out] state The RNG state
+  */
+  template <typename Real> constexpr Real uniform_counter(CounterRNGState &state)
+  {
+    if constexpr (sizeof(Real) == sizeof(float)) {
+      return target::rng::uniform_float(random_word(state));
+    } else {
+      uint32_t a = random_word(state);
+      return target::rng::uniform_double(a, random_word(state));
+    }
+  }
+
+  /**
+     @brief Metadata for initializing the counter-based states of a
+     field: each site is identified by its global lexicographical
+     index, computed in the same way as for the MRG32k3a states, with
+     the fifth coordinate of 5-d fields as the slowest index.  Sites of
+     single-parity fields are indexed by their position in the even
+     sublattice and are flagged in the counter, so they never share a
+     stream with the sites of a full field.
+  */
+  struct CounterRNGSite {
+    int commCoord[4];
+    int X[4]; /** Full-parity local 4-d dimensions */
+    uint64_t X_global[4];
+    int volume_4d_cb; /** Local 4-d checkerboard volume */
+    bool parity_subset;
+    unsigned long long seed;
+    uint64_t counter;
+
+    CounterRNGSite() = default;
+
+    CounterRNGSite(const LatticeField &meta, const CounterRNG &rng) :
+      parity_subset(meta.SiteSubset() == QUDA_PARITY_SITE_SUBSET), seed(rng.Seed()), counter(rng.Counter())
+    {
+      volume_4d_cb = 1;
+      for (int i = 0; i < 4; i++) {
+        commCoord[i] = comm_coord(i);
+        // single-parity fields store half the x extent
+        X[i] = meta.LocalX()[i] * (i == 0 && parity_subset ? 2 : 1);
+        X_global[i] = X[i] * comm_dim(i);
+        volume_4d_cb *= X[i];
+      }
+      volume_4d_cb /= 2;
+    }
+
+    /**
+       @brief Return the initialized state of a site
+       @param[in] x Local 4-d coordinates of the site (excluding any halo)
+       @param[in] s Fifth coordinate of the site for 5-d fields
+    */
+    __device__ __host__ CounterRNGState state(const int x[4], int s = 0) const
+    {
+      uint64_t y[4];
+      for (int i = 0; i < 4; i++) y[i] = x[i] + commCoord[i] * X[i];
+      auto idd = ((((s * X_global[3] + y[3]) * X_global[2] + y[2]) * X_global[1]) + y[1]) * X_global[0] + y[0];
+      CounterRNGState state = {};
+      random_init(seed, idd, counter, state, parity_subset);
+      return state;
+    }
+  };
+
+} // namespace quda
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <type_traits>
+#include <random_helper.h>
+#include <mrg32k3a.h>
+#include <random_counter.h>
+
+/**
+   @file random_helper_host.h
+
+   @section DESCRIPTION
+   MRG32k3a random number generator state for host-located fields,
+   available with every target.  Each site has its own stream, seeded
+   and spaced in the same way as the MRG32k3a device streams, so the
+   results do not depend on the number of host threads.
+ */
+
+namespace quda
+{
+
+  /**
+     @brief RNG state of a single site of a host-located field
+  */
+  struct HostRNGState {
+    target::rng::MRG32k3a state;
+  };
+
+  /**
+   * \brief random init
+   * @param [in] seed -- The RNG seed
+   * @param [in] sequence -- The sequence
+   * @param [in] offset -- the offset
+   * @param [in,out] state - the RNG State
+   */
+  constexpr void random_init(unsigned long long seed, unsigned long long sequence, unsigned long long offset,
+                             HostRNGState &state)
+  {
+    target::rng::seed(state.state, seed, sequence);
+    target::rng::skip(state.state, offset);
+  }
+
+  /**
+     @brief Return a uniform deviate between 0 and 1 from either a
+     target RNG state, a host RNG state or a counter-based RNG state
+     @param[in,out] state The RNG state
+  */
+  template <typename Real, typename State> __host__ __device__ inline Real uniform_rand(State &state)
+  {
+    if constexpr (std::is_same_v<State, HostRNGState>)
+      return static_cast<Real>(target::rng::uniform(state.state));
+    else if constexpr (std::is_same_v<State, CounterRNGState>)
+      return uniform_counter<Real>(state);
+    else
+      return uniform<Real>::rand(state);
+  }
+
+  /**
+     @brief Return a uniform deviate between a and b from either a
+     target RNG state, a host RNG state or a counter-based RNG state
+     @param[in,out] state The RNG state
+     @param[in] a The lower end of the range
+     @param[in] b The upper end of the range
+  */
+  template <typename Real, typename State> __host__ __device__ inline Real uniform_rand(State &state, Real a, Real b)
+  {
+    return a + (b - a) * uniform_rand<Real>(state);
+  }
+
+} // namespace quda
@@ -1,46 +1,104 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 namespace quda
 {
 
+  /**
+     @brief Number of iterations in each chunk of the host
+     reductions.  The iteration space is partitioned into chunks of
+     this size regardless of the number of OpenMP threads, so that the
+     order in which the partial results are formed and combined, and
+     hence the result, is independent of the thread count.
+  */
+  constexpr int host_reduce_chunk = 256;
+
+  /**
+     @brief Combine a set of partial reductions using a fixed pairwise
+     tree, where the shape of the tree depends only on the number of
+     partials.  The input is overwritten.
+     @param[in,out] partial The partial results to combine
+     @param[in] offset The offset of the first partial in the set
+     @param[in] n The number of partials in the set
+     @return The combined result
+  */
+  template <typename Functor, typename reduce_t>
+  reduce_t host_tree_reduce(std::vector<reduce_t> &partial, size_t offset, size_t n)
+  {
+    if (n == 0) return Functor::init();
+    for (size_t stride = 1; stride < n; stride *= 2) {
+      for (size_t i = 0; i + stride < n; i += 2 * stride)
+        partial[offset + i] = Functor::apply(partial[offset + i], partial[offset + i + stride]);
+    }
+    return partial[offset];
+  }
+
+  /**
+     @brief Reduce a chunk of a 2-d (x, y) iteration space, where the
+     chunk is the range [begin, end) of the flattened index x + y * nx.
+     Iterations are visited in the same order as a serial loop over y
+     (outer) and x (inner).
+  */
+  template <typename Functor, typename... Idx>
+  auto host_reduce_chunk_2d(Functor t, int nx, long begin, long end, Idx... idx)
+  {
+    auto value = t.init();
+    int i = begin % nx;
+    int j = begin / nx;
+    for (long n = begin; n < end; n++) {
+      value = t(value, i, j, idx...);
+      if (++i == nx) {
+        i = 0;
+        j++;
+      }
+    }
+    return value;
+  }
+
   template <template <typename> class Functor, typename Arg> auto Reduction2D_host(const Arg &arg)
   {
     using reduce_t = typename Functor<Arg>::reduce_t;
     Functor<Arg> t(arg);
 
-    reduce_t value = t.init();
-#pragma omp parallel for collapse(2) reduction(Functor <Arg>::apply : value)
-    for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-      for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { value = t(value, i, j); }
+    const int nx = arg.threads.x;
+    const long n = static_cast<long>(arg.threads.x) * arg.threads.y;
+    const long n_chunk = (n + host_reduce_chunk - 1) / host_reduce_chunk;
+
+    std::vector<reduce_t> partial(n_chunk);
+#pragma omp parallel for
+    for (long c = 0; c < n_chunk; c++) {
+      partial[c] = host_reduce_chunk_2d(t, nx, c * host_reduce_chunk, std::min((c + 1) * host_reduce_chunk, n));
     }
 
-    return value;
+    return host_tree_reduce<Functor<Arg>>(partial, 0, n_chunk);
   }
 
   template <template <typename> class Functor, typename Arg> auto MultiReduction_host(const Arg &arg)
   {
-#pragma omp declare reduction(multi_reduce                                                                             \
-                              : typename Functor <Arg>::reduce_t                                                       \
-                              : omp_out = Functor <Arg>::apply(omp_out, omp_in))                                       \
-  initializer(omp_priv = Functor <Arg>::init())
-
     using reduce_t = typename Functor<Arg>::reduce_t;
     Functor<Arg> t(arg);
 
-    std::vector<reduce_t> value(arg.threads.z, t.init());
-    for (int k = 0; k < static_cast<int>(arg.threads.z); k++) {
-      auto val = t.init();
+    const int nx = arg.threads.x;
+    const int nz = arg.threads.z;
+    const long n = static_cast<long>(arg.threads.x) * arg.threads.y;
+    const long n_chunk = (n + host_reduce_chunk - 1) / host_reduce_chunk;
 
-#pragma omp parallel for collapse(2) reduction(multi_reduce : val)
-      for (int j = 0; j < static_cast<int>(arg.threads.y); j++) {
-        for (int i = 0; i < static_cast<int>(arg.threads.x); i++) { val = t(val, i, j, k); }
+    // chunk over all batch indices at once so that small reductions
+    // with many batches still expose enough parallelism
+    std::vector<reduce_t> partial(nz * n_chunk);
+#pragma omp parallel for collapse(2)
+    for (int k = 0; k < nz; k++) {
+      for (long c = 0; c < n_chunk; c++) {
+        partial[k * n_chunk + c]
+          = host_reduce_chunk_2d(t, nx, c * host_reduce_chunk, std::min((c + 1) * host_reduce_chunk, n), k);
       }
-
-      value[k] = val;
     }
 
+    std::vector<reduce_t> value(nz);
+    for (int k = 0; k < nz; k++) value[k] = host_tree_reduce<Functor<Arg>>(partial, k * n_chunk, n_chunk);
+
     return value;
   }
 
@@ -31,7 +31,7 @@ namespace quda
   template <typename T, typename D = DimsBlock, typename O = void>
   class SharedMemoryCache : SharedMemory<atom_t<T>, SizeDims<D, sizeof(T) / sizeof(atom_t<T>)>, O>
   {
-    using Smem = SharedMemory<atom_t<T>, SizeDims<D, sizeof(T) / sizeof(atom_t<T>)>, O>;
+    using Smem = SharedMemory<quda::atom_t<T>, SizeDims<D, sizeof(T) / sizeof(quda::atom_t<T>)>, O>;
 
   public:
     using value_type = T;
@@ -43,7 +43,7 @@ namespace quda
     const dim3 block;
     const int stride;
     using Smem::sharedMem;
-    using atom_t = atom_t<T>;
+    using atom_t = quda::atom_t<T>;
     static_assert(sizeof(T) % 4 == 0, "Shared memory cache does not support sub-word size types");
 
     // The number of elements of type atom_t that we break T into for optimal shared-memory access
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <util_quda.h>
+
+/**
+   @file shared_memory_host.h
+
+   Backing store for shared memory in host kernels.  Host kernels
+   execute each thread block with a single host thread, so shared
+   memory is a per-thread scratch buffer.  This is used by the CPU
+   target and by the host instantiation of the device targets.
+ */
+
+namespace quda
+{
+
+  /**
+     @brief The size of the per-thread buffer that backs shared
+     memory in host kernels.
+  */
+  constexpr size_t host_shared_memory_size() { return 65536; }
+
+  /**
+     @brief Return the base address of the calling thread's shared
+     memory buffer.
+     @param[in] bytes The number of bytes required from the base address
+  */
+  inline char *host_shared_memory(size_t bytes)
+  {
+    alignas(64) static thread_local char buffer[host_shared_memory_size()];
+    if (bytes > host_shared_memory_size())
+      errorQuda("Requested shared memory %lu exceeds the per-thread buffer size %lu", bytes, host_shared_memory_size());
+    return buffer;
+  }
+
+} // namespace quda
@@ -22,7 +22,7 @@ namespace quda
   template <typename T, int N_ = 0, typename O = void>
   class ThreadLocalCache : SharedMemory<atom_t<T>, SizePerThread<std::max(1, N_) * sizeof(T) / sizeof(atom_t<T>)>, O>
   {
-    using Smem = SharedMemory<atom_t<T>, SizePerThread<std::max(1, N_) * sizeof(T) / sizeof(atom_t<T>)>, O>;
+    using Smem = SharedMemory<quda::atom_t<T>, SizePerThread<std::max(1, N_) * sizeof(T) / sizeof(quda::atom_t<T>)>, O>;
 
   public:
     using value_type = T;
@@ -34,7 +34,7 @@ namespace quda
   private:
     const int stride;
     using Smem::sharedMem;
-    using atom_t = atom_t<T>;
+    using atom_t = quda::atom_t<T>;
     static_assert(sizeof(T) % 4 == 0, "Thread local cache does not support sub-word size types");
 
     // The number of elements of type atom_t that we break T into for optimal shared-memory access
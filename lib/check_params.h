@@ -172,6 +172,10 @@ void printQudaEigParam(QudaEigParam *param) {
   P(poly_deg, 0);
   P(a_min, 0.0);
   P(a_max, 0.0);
+  P(poly_acc_auto, QUDA_BOOLEAN_FALSE);
+  P(kpm_n_moments, 64);
+  P(kpm_n_vec, 4);
+  P(kpm_eval_n_conv, 0.0);
   P(preserve_deflation, QUDA_BOOLEAN_FALSE);
   P(preserve_deflation_space, 0);
   P(preserve_evals, QUDA_BOOLEAN_TRUE);
@@ -206,6 +210,9 @@ void printQudaEigParam(QudaEigParam *param) {
   P(poly_deg, INVALID_INT);
   P(a_min, INVALID_DOUBLE);
   P(a_max, INVALID_DOUBLE);
+  P(poly_acc_auto, QUDA_BOOLEAN_INVALID);
+  P(kpm_n_moments, INVALID_INT);
+  P(kpm_n_vec, INVALID_INT);
   P(preserve_deflation, QUDA_BOOLEAN_INVALID);
   P(preserve_evals, QUDA_BOOLEAN_INVALID);
   P(use_dagger, QUDA_BOOLEAN_INVALID);
@@ -1177,6 +1184,10 @@ void printQudaGaugeSmearParam(QudaGaugeSmearParam *param)
   P(alpha2, 0.0);
   P(alpha3, 0.0);
   P(dir_ignore, -1);
+  P(tol, 0.0);
+  P(n_meas_t, 0);
+  P(meas_t, nullptr);
+  P(steps_per_exchange, 0);
 #else
   P(n_steps, (unsigned int)INVALID_INT);
   P(meas_interval, (unsigned int)INVALID_INT);
@@ -1189,6 +1200,9 @@ void printQudaGaugeSmearParam(QudaGaugeSmearParam *param)
   P(alpha2, INVALID_DOUBLE);
   P(alpha3, INVALID_DOUBLE);
   P(dir_ignore, INVALID_INT);
+  P(tol, INVALID_DOUBLE);
+  P(n_meas_t, (unsigned int)INVALID_INT);
+  P(steps_per_exchange, (unsigned int)INVALID_INT);
 #endif
 
 #ifdef INIT_PARAM
@@ -1,6 +1,9 @@
 #include <unistd.h> // for gethostname()
 #include <assert.h>
 #include <limits>
+#include <array>
+#include <cstring>
+#include <vector>
 
 #include <quda_internal.h>
 #include <communicator_quda.h>
@@ -131,6 +134,129 @@ namespace quda
     return topo;
   }
 
+  int comm_topology_rank_from_coords(const int *coords, void *fdata)
+  {
+    auto &map = *static_cast<TopologyMap *>(fdata);
+    return map.ranks[index(map.ndim, map.dims, coords)];
+  }
+
+  /**
+     @brief Compute the halo bytes per dslash sent between ranks on
+     different nodes for a given mapping
+  */
+  static size_t inter_node_bytes(int ndim, const int *dims, const std::vector<int> &ranks, const std::vector<int> &node,
+                                 const size_t *face_bytes)
+  {
+    size_t bytes = 0;
+    int x[QUDA_MAX_DIM] = {};
+    do {
+      int rank = ranks[index(ndim, dims, x)];
+      for (int d = 0; d < ndim; d++) {
+        if (dims[d] == 1) continue;
+        for (int dir = -1; dir <= 1; dir += 2) {
+          int y[QUDA_MAX_DIM] = {};
+          for (int i = 0; i < ndim; i++) y[i] = x[i];
+          y[d] = mod(x[d] + dir, dims[d]);
+          if (node[ranks[index(ndim, dims, y)]] != node[rank]) bytes += face_bytes[d];
+        }
+      }
+    } while (advance_coords(ndim, dims, x));
+    return bytes;
+  }
+
+  /**
+     @brief Enumerate all node sub-grids whose dimensions divide the
+     process grid and whose volume is the number of ranks per node
+  */
+  static void node_grids(int d, int ndim, const int *dims, int remaining, std::array<int, QUDA_MAX_DIM> &n,
+                         std::vector<std::array<int, QUDA_MAX_DIM>> &grids)
+  {
+    if (d == ndim) {
+      if (remaining == 1) grids.push_back(n);
+      return;
+    }
+    for (int nd = 1; nd <= dims[d]; nd++) {
+      if (dims[d] % nd != 0 || remaining % nd != 0) continue;
+      n[d] = nd;
+      node_grids(d + 1, ndim, dims, remaining / nd, n, grids);
+    }
+  }
+
+  void comm_optimize_topology(int ndim, const int *dims, TopologyMap &map, const char *hostname, int n_rank)
+  {
+    map.ndim = ndim;
+    for (int d = 0; d < ndim; d++) map.dims[d] = dims[d];
+
+    // start from the default lexicographical mapping
+    map.ranks.resize(n_rank);
+    for (int r = 0; r < n_rank; r++) map.ranks[r] = r;
+
+    // group the ranks into nodes in order of first appearance
+    std::vector<int> node(n_rank);
+    std::vector<std::vector<int>> node_ranks;
+    for (int r = 0; r < n_rank; r++) {
+      const char *host = &hostname[QUDA_MAX_HOSTNAME_STRING * r];
+      int j = 0;
+      while (j < static_cast<int>(node_ranks.size())
+             && strncmp(host, &hostname[QUDA_MAX_HOSTNAME_STRING * node_ranks[j][0]], QUDA_MAX_HOSTNAME_STRING))
+        j++;
+      if (j == static_cast<int>(node_ranks.size())) node_ranks.emplace_back();
+      node_ranks[j].push_back(r);
+      node[r] = j;
+    }
+
+    size_t face_bytes[QUDA_MAX_DIM] = {};
+    for (int d = 0; d < ndim; d++) {
+      if (map.lattice[d] % dims[d] != 0)
+        errorQuda("Lattice dimension %d = %d not divisible by process grid dimension %d", d, map.lattice[d], dims[d]);
+      size_t face = 1;
+      for (int i = 0; i < ndim; i++)
+        if (i != d) face *= map.lattice[i] / dims[i];
+      face_bytes[d] = face / 2 * map.site_bytes;
+    }
+
+    map.inter_node_bytes_lex = inter_node_bytes(ndim, dims, map.ranks, node, face_bytes);
+    map.inter_node_bytes = map.inter_node_bytes_lex;
+    for (int d = 0; d < ndim; d++) map.node_dims[d] = 0;
+
+    int ranks_per_node = node_ranks[0].size();
+    for (auto &n : node_ranks) {
+      if (static_cast<int>(n.size()) != ranks_per_node) {
+        warningQuda("Nodes have differing numbers of ranks, retaining the default rank mapping");
+        return;
+      }
+    }
+
+    std::array<int, QUDA_MAX_DIM> n = {};
+    std::vector<std::array<int, QUDA_MAX_DIM>> grids;
+    node_grids(0, ndim, dims, ranks_per_node, n, grids);
+
+    std::vector<int> ranks(n_rank);
+    for (auto &g : grids) {
+      int node_grid[QUDA_MAX_DIM];
+      for (int d = 0; d < ndim; d++) node_grid[d] = dims[d] / g[d];
+
+      // each node is assigned a block of the process grid
+      int x[QUDA_MAX_DIM] = {};
+      do {
+        int b[QUDA_MAX_DIM] = {};
+        int l[QUDA_MAX_DIM] = {};
+        for (int d = 0; d < ndim; d++) {
+          b[d] = x[d] / g[d];
+          l[d] = x[d] % g[d];
+        }
+        ranks[index(ndim, dims, x)] = node_ranks[index(ndim, node_grid, b)][index(ndim, g.data(), l)];
+      } while (advance_coords(ndim, dims, x));
+
+      auto bytes = inter_node_bytes(ndim, dims, ranks, node, face_bytes);
+      if (bytes < map.inter_node_bytes) {
+        map.inter_node_bytes = bytes;
+        map.ranks = ranks;
+        for (int d = 0; d < ndim; d++) map.node_dims[d] = g[d];
+      }
+    }
+  }
+
   void comm_abort(int status)
   {
 #ifdef HOST_DEBUG
@@ -0,0 +1,688 @@
+/**
+ * Mock communications layer that simulates a multi-rank job on a
+ * single node without MPI.  When the default communicator is created
+ * with a grid of N ranks, the process forks into N processes, one per
+ * simulated rank, that are connected pairwise by UNIX domain sockets.
+ * Each rank is a separate process, so all of QUDA's per-process state
+ * (device, tune cache, ghost buffers, field caches) is naturally
+ * per-rank.  Point-to-point messages are driven by a simple progress
+ * engine, and the collectives are built from point-to-point messages
+ * with the reduction applied in rank order, so they are deterministic.
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <vector>
+
+#include <communicator_quda.h>
+
+namespace quda
+{
+
+  struct MsgHandle_s {
+    /** Whether this is a send (else a receive) */
+    bool send;
+
+    /** Global rank of the peer process */
+    int peer;
+
+    /** Context of the communicator this message belongs to */
+    int context;
+
+    /** Message tag */
+    int tag;
+
+    /** User buffer */
+    char *buffer;
+
+    /** Size in bytes of each contiguous block */
+    size_t blksize;
+
+    /** Number of blocks (1 for a contiguous message) */
+    int nblocks;
+
+    /** Stride in bytes between blocks */
+    size_t stride;
+
+    /** Packed staging buffer for strided sends */
+    std::vector<char> staging;
+
+    /** Whether the message has completed */
+    bool complete;
+
+    size_t nbytes() const { return blksize * nblocks; }
+  };
+
+  struct NeighborHandle_s {
+    /** The point-to-point messages making up the neighborhood exchange */
+    std::vector<MsgHandle> recv;
+    std::vector<MsgHandle> send;
+  };
+
+  namespace mock
+  {
+
+    /** Reserved tags for the collectives: user tags are non-negative */
+    constexpr int gather_tag = -1;
+    constexpr int broadcast_tag = -2;
+    constexpr int neighbor_tag = -3;
+
+    struct header_t {
+      int context;
+      int tag;
+      uint64_t nbytes;
+    };
+
+    /** A received message that has not yet been matched */
+    struct message_t {
+      int src;
+      header_t header;
+      std::vector<char> data;
+    };
+
+    /** A send in flight, where offset counts the header and the payload */
+    struct outgoing_t {
+      header_t header;
+      const char *data;
+      size_t offset;
+      MsgHandle *mh;
+    };
+
+    /** Partially read message from a peer */
+    struct incoming_t {
+      header_t header;
+      size_t offset = 0;
+      std::vector<char> data;
+    };
+
+    struct World {
+      int rank = 0;
+      int size = 1;
+      pid_t parent = 0;
+      std::vector<pid_t> children;
+      std::vector<int> fd;
+      std::vector<bool> closed;
+      std::vector<std::deque<outgoing_t>> outgoing;
+      std::vector<incoming_t> incoming;
+      std::list<message_t> unexpected;
+      std::list<MsgHandle *> posted;
+      int next_context = 1;
+
+      ~World()
+      {
+        for (auto f : fd)
+          if (f >= 0) close(f);
+
+        // the root process collects the exit status of the other ranks
+        bool failed = false;
+        for (auto pid : children) {
+          int status;
+          if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed = true;
+        }
+        if (failed) {
+          fprintf(stderr, "Mock comms: at least one simulated rank did not exit cleanly\n");
+          std::_Exit(EXIT_FAILURE);
+        }
+      }
+    };
+
+    static World world;
+
+    /**
+       @brief Fork into n processes, one per simulated rank, and connect
+       every pair of ranks with a socket.  The calling process becomes
+       rank 0.
+     */
+    static void launch(int n)
+    {
+      if (world.size > 1 || n == 1) {
+        if (n != world.size) errorQuda("Mock comms already launched with %d ranks, requested %d", world.size, n);
+        return;
+      }
+
+      // pair[i * n + j] for i < j holds the socket pair connecting ranks i and j
+      std::vector<int> pair(2 * n * n, -1);
+      for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+          if (socketpair(AF_UNIX, SOCK_STREAM, 0, &pair[2 * (i * n + j)]) != 0)
+            errorQuda("Mock comms failed to create socket pair (%s)", strerror(errno));
+        }
+      }
+
+      // avoid duplicating buffered output in the children
+      fflush(stdout);
+      fflush(stderr);
+
+      pid_t root = getpid();
+      int rank = 0;
+      for (int r = 1; r < n; r++) {
+        pid_t pid = fork();
+        if (pid < 0) errorQuda("Mock comms failed to fork rank %d (%s)", r, strerror(errno));
+        if (pid == 0) {
+          rank = r;
+          world.children.clear();
+          break;
+        }
+        world.children.push_back(pid);
+      }
+
+      world.rank = rank;
+      world.size = n;
+      world.parent = rank == 0 ? 0 : root;
+      world.fd.assign(n, -1);
+      world.closed.assign(n, false);
+      world.outgoing.resize(n);
+      world.incoming.resize(n);
+
+      for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+          int *p = &pair[2 * (i * n + j)];
+          if (rank == i) {
+            world.fd[j] = p[0];
+            close(p[1]);
+          } else if (rank == j) {
+            world.fd[i] = p[1];
+            close(p[0]);
+          } else {
+            close(p[0]);
+            close(p[1]);
+          }
+        }
+      }
+
+      for (auto f : world.fd)
+        if (f >= 0) fcntl(f, F_SETFL, fcntl(f, F_GETFL) | O_NONBLOCK);
+
+      // report writes to an exited peer as errors rather than signals
+      signal(SIGPIPE, SIG_IGN);
+    }
+
+    static void complete_recv(MsgHandle *mh, const std::vector<char> &data)
+    {
+      if (data.size() != mh->nbytes())
+        errorQuda("Mock comms message size mismatch from rank %d tag %d: received %lu, expected %lu", mh->peer,
+                  mh->tag, data.size(), mh->nbytes());
+      for (int b = 0; b < mh->nblocks; b++)
+        memcpy(mh->buffer + b * mh->stride, data.data() + b * mh->blksize, mh->blksize);
+      mh->complete = true;
+    }
+
+    static bool match(const MsgHandle *mh, int src, const header_t &header)
+    {
+      return mh->peer == src && mh->context == header.context && mh->tag == header.tag;
+    }
+
+    /**
+       @brief Deliver a received message, either to the first matching
+       posted receive or to the unexpected message queue
+     */
+    static void deliver(message_t &&msg)
+    {
+      for (auto it = world.posted.begin(); it != world.posted.end(); it++) {
+        if (match(*it, msg.src, msg.header)) {
+          complete_recv(*it, msg.data);
+          world.posted.erase(it);
+          return;
+        }
+      }
+      world.unexpected.push_back(std::move(msg));
+    }
+
+    static void progress_read(int p)
+    {
+      auto &in = world.incoming[p];
+      while (true) {
+        char *ptr;
+        size_t remaining;
+        if (in.offset < sizeof(header_t)) {
+          ptr = reinterpret_cast<char *>(&in.header) + in.offset;
+          remaining = sizeof(header_t) - in.offset;
+        } else {
+          ptr = in.data.data() + (in.offset - sizeof(header_t));
+          remaining = in.header.nbytes - (in.offset - sizeof(header_t));
+        }
+
+        if (remaining > 0) {
+          ssize_t n = read(world.fd[p], ptr, remaining);
+          if (n == 0) {
+            world.closed[p] = true;
+            return;
+          }
+          if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return;
+            errorQuda("Mock comms read from rank %d failed (%s)", p, strerror(errno));
+          }
+          in.offset += n;
+          if (in.offset == sizeof(header_t)) in.data.resize(in.header.nbytes);
+        }
+
+        if (in.offset >= sizeof(header_t) && in.offset == sizeof(header_t) + in.header.nbytes) {
+          deliver({p, in.header, std::move(in.data)});
+          in = incoming_t();
+        }
+      }
+    }
+
+    static void progress_write(int p)
+    {
+      auto &queue = world.outgoing[p];
+      while (!queue.empty()) {
+        auto &out = queue.front();
+        const size_t total = sizeof(header_t) + out.header.nbytes;
+
+        while (out.offset < total) {
+          const char *ptr = out.offset < sizeof(header_t) ?
+            reinterpret_cast<const char *>(&out.header) + out.offset :
+            out.data + (out.offset - sizeof(header_t));
+          size_t remaining = out.offset < sizeof(header_t) ? sizeof(header_t) - out.offset : total - out.offset;
+
+          ssize_t n = write(world.fd[p], ptr, remaining);
+          if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return;
+            errorQuda("Mock comms write to rank %d failed (%s)", p, strerror(errno));
+          }
+          out.offset += n;
+        }
+
+        out.mh->complete = true;
+        queue.pop_front();
+      }
+    }
+
+    /**
+       @brief Make progress on all outstanding sends and receives
+       @param[in] block Whether to block until at least one socket is
+       ready
+     */
+    static void progress(bool block)
+    {
+      std::vector<pollfd> fds;
+      std::vector<int> peer;
+      for (int p = 0; p < world.size; p++) {
+        if (p == world.rank || world.closed[p]) continue;
+        short events = POLLIN;
+        if (!world.outgoing[p].empty()) events |= POLLOUT;
+        fds.push_back({world.fd[p], events, 0});
+        peer.push_back(p);
+      }
+      if (fds.empty()) return;
+
+      if (poll(fds.data(), fds.size(), block ? -1 : 0) < 0) {
+        if (errno == EINTR) return;
+        errorQuda("Mock comms poll failed (%s)", strerror(errno));
+      }
+
+      for (auto i = 0u; i < fds.size(); i++) {
+        if (fds[i].revents & POLLIN) progress_read(peer[i]);
+        if (fds[i].revents & POLLOUT) progress_write(peer[i]);
+        if ((fds[i].revents & (POLLHUP | POLLERR)) && !(fds[i].revents & POLLIN)) world.closed[peer[i]] = true;
+      }
+    }
+
+    static void start(MsgHandle *mh)
+    {
+      mh->complete = false;
+
+      if (mh->send) {
+        const char *data = mh->buffer;
+        if (mh->nblocks > 1) {
+          mh->staging.resize(mh->nbytes());
+          for (int b = 0; b < mh->nblocks; b++)
+            memcpy(mh->staging.data() + b * mh->blksize, mh->buffer + b * mh->stride, mh->blksize);
+          data = mh->staging.data();
+        }
+
+        header_t header = {mh->context, mh->tag, mh->nbytes()};
+        if (mh->peer == world.rank) {
+          deliver({world.rank, header, std::vector<char>(data, data + mh->nbytes())});
+          mh->complete = true;
+        } else {
+          world.outgoing[mh->peer].push_back({header, data, 0, mh});
+          progress_write(mh->peer);
+        }
+      } else {
+        for (auto it = world.unexpected.begin(); it != world.unexpected.end(); it++) {
+          if (match(mh, it->src, it->header)) {
+            complete_recv(mh, it->data);
+            world.unexpected.erase(it);
+            return;
+          }
+        }
+        world.posted.push_back(mh);
+      }
+    }
+
+    static void wait(MsgHandle *mh)
+    {
+      while (!mh->complete) {
+        if (world.closed[mh->peer]) errorQuda("Mock comms rank %d exited with a pending message", mh->peer);
+        progress(true);
+      }
+    }
+
+    static MsgHandle make_handle(bool send, int peer, int context, int tag, void *buffer, size_t blksize,
+                                 int nblocks = 1, size_t stride = 0)
+    {
+      return {send, peer, context, tag, static_cast<char *>(buffer), blksize, nblocks, stride, {}, true};
+    }
+
+    /**
+       @brief Gather bytes from every rank in the group to every rank
+       in the group, ordered by rank within the group
+     */
+    static void allgather(const std::vector<int> &group, int context, int local, const void *in, void *out,
+                          size_t bytes)
+    {
+      const int n = group.size();
+      std::vector<MsgHandle> send, recv;
+      send.reserve(n);
+      recv.reserve(n);
+
+      for (int r = 0; r < n; r++) {
+        if (r == local) continue;
+        send.push_back(make_handle(true, group[r], context, gather_tag, const_cast<void *>(in), bytes));
+        recv.push_back(make_handle(false, group[r], context, gather_tag, static_cast<char *>(out) + r * bytes, bytes));
+      }
+
+      for (auto &mh : recv) start(&mh);
+      for (auto &mh : send) start(&mh);
+      memcpy(static_cast<char *>(out) + local * bytes, in, bytes);
+      for (auto &mh : send) wait(&mh);
+      for (auto &mh : recv) wait(&mh);
+    }
+
+    /**
+       @brief Reduce an array across the group.  Every rank applies
+       the reduction to the gathered arrays in rank order, so the
+       result is deterministic and identical on every rank.
+     */
+    template <typename T, typename Reducer>
+    static void allreduce(const std::vector<int> &group, int context, int local, T *data, size_t size, Reducer r)
+    {
+      const int n = group.size();
+      std::vector<T> recv_buf(size * n);
+      allgather(group, context, local, data, recv_buf.data(), size * sizeof(T));
+
+      for (size_t i = 0; i < size; i++) {
+        data[i] = recv_buf[i];
+        for (int j = 1; j < n; j++) data[i] = r(data[i], recv_buf[j * size + i]);
+      }
+    }
+
+  } // namespace mock
+
+  Communicator::Communicator(int nDim, const int *commDims, QudaCommsMap rank_from_coords, void *map_data, bool, void *)
+  {
+    int grid_size = 1;
+    for (int d = 0; d < nDim; d++) grid_size *= commDims[d];
+
+    mock::launch(grid_size);
+
+    rank = mock::world.rank;
+    size = mock::world.size;
+    mock_context = 0;
+    mock_group.resize(size);
+    for (int r = 0; r < size; r++) mock_group[r] = r;
+
+    comm_init(nDim, commDims, rank_from_coords, map_data);
+
+    globalReduce.push(true);
+  }
+
+  Communicator::Communicator(Communicator &other, const int *comm_split) : globalReduce(other.globalReduce)
+  {
+    constexpr int nDim = 4;
+
+    CommKey comm_dims_split;
+    CommKey comm_key_split;
+    CommKey comm_color_split;
+
+    for (int d = 0; d < nDim; d++) {
+      assert(other.comm_dim(d) % comm_split[d] == 0);
+      comm_dims_split[d] = other.comm_dim(d) / comm_split[d];
+      comm_key_split[d] = other.comm_coord(d) % comm_dims_split[d];
+      comm_color_split[d] = other.comm_coord(d) / comm_dims_split[d];
+    }
+
+    int key = index(nDim, comm_dims_split.data(), comm_key_split.data());
+    int color = index(nDim, comm_split, comm_color_split.data());
+
+    // gather the color and key of every rank in the parent to form the split group
+    int color_key[2] = {color, key};
+    std::vector<int> all_color_key(2 * other.size);
+    mock::allgather(other.mock_group, other.mock_context, other.rank, color_key, all_color_key.data(), sizeof(color_key));
+
+    size = 0;
+    for (int r = 0; r < other.size; r++)
+      if (all_color_key[2 * r] == color) size++;
+
+    mock_group.resize(size);
+    for (int r = 0; r < other.size; r++)
+      if (all_color_key[2 * r] == color) mock_group[all_color_key[2 * r + 1]] = other.mock_group[r];
+
+    rank = key;
+    // split communicators are created collectively, so the context counter is consistent across ranks
+    mock_context = mock::world.next_context++;
+
+    QudaCommsMap func = lex_rank_from_coords_dim_t;
+    comm_init(nDim, comm_dims_split.data(), func, comm_dims_split.data());
+  }
+
+  Communicator::~Communicator() { comm_finalize(); }
+
+  void Communicator::comm_init(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data)
+  {
+    int grid_size = 1;
+    for (int i = 0; i < ndim; i++) { grid_size *= dims[i]; }
+    if (grid_size != size) {
+      errorQuda("Communication grid size declared via initCommsGridQuda() does not match"
+                " total number of mock ranks (%d != %d)",
+                grid_size, size);
+    }
+
+    comm_init_common(ndim, dims, rank_from_coords, map_data);
+  }
+
+  int Communicator::comm_rank(void) { return rank; }
+
+  size_t Communicator::comm_size(void) { return size; }
+
+  void Communicator::comm_gather_hostname(char *hostname_recv_buf)
+  {
+    mock::allgather(mock_group, mock_context, rank, comm_hostname(), hostname_recv_buf, QUDA_MAX_HOSTNAME_STRING);
+  }
+
+  void Communicator::comm_gather_gpuid(int *gpuid_recv_buf)
+  {
+    int gpuid = comm_gpuid();
+    mock::allgather(mock_group, mock_context, rank, &gpuid, gpuid_recv_buf, sizeof(int));
+  }
+
+  static int displaced_tag(const int displacement[], int ndim, int sign)
+  {
+    int tag = 0;
+    for (int i = ndim - 1; i >= 0; i--) tag = tag * 4 * max_displacement + sign * displacement[i] + max_displacement;
+    return tag >= 0 ? tag : 2 * std::pow(4 * max_displacement, ndim) + tag;
+  }
+
+  MsgHandle *Communicator::comm_declare_send_rank(void *buffer, int rank, int tag, size_t nbytes)
+  {
+    return new MsgHandle(mock::make_handle(true, mock_group[rank], mock_context, tag, buffer, nbytes));
+  }
+
+  MsgHandle *Communicator::comm_declare_recv_rank(void *buffer, int rank, int tag, size_t nbytes)
+  {
+    return new MsgHandle(mock::make_handle(false, mock_group[rank], mock_context, tag, buffer, nbytes));
+  }
+
+  MsgHandle *Communicator::comm_declare_send_displaced(void *buffer, const int displacement[], size_t nbytes)
+  {
+    return comm_declare_strided_send_displaced(buffer, displacement, nbytes, 1, nbytes);
+  }
+
+  MsgHandle *Communicator::comm_declare_receive_displaced(void *buffer, const int displacement[], size_t nbytes)
+  {
+    return comm_declare_strided_receive_displaced(buffer, displacement, nbytes, 1, nbytes);
+  }
+
+  MsgHandle *Communicator::comm_declare_strided_send_displaced(void *buffer, const int displacement[], size_t blksize,
+                                                               int nblocks, size_t stride)
+  {
+    Topology *topo = comm_default_topology();
+    int ndim = comm_ndim(topo);
+    check_displacement(displacement, ndim);
+
+    int rank = comm_rank_displaced(topo, displacement);
+    int tag = displaced_tag(displacement, ndim, 1);
+
+    return new MsgHandle(mock::make_handle(true, mock_group[rank], mock_context, tag, buffer, blksize, nblocks, stride));
+  }
+
+  MsgHandle *Communicator::comm_declare_strided_receive_displaced(void *buffer, const int displacement[],
+                                                                  size_t blksize, int nblocks, size_t stride)
+  {
+    Topology *topo = comm_default_topology();
+    int ndim = comm_ndim(topo);
+    check_displacement(displacement, ndim);
+
+    int rank = comm_rank_displaced(topo, displacement);
+    int tag = displaced_tag(displacement, ndim, -1);
+
+    return new MsgHandle(mock::make_handle(false, mock_group[rank], mock_context, tag, buffer, blksize, nblocks, stride));
+  }
+
+  void Communicator::comm_free(MsgHandle *&mh)
+  {
+    mock::world.posted.remove(mh);
+    delete mh;
+    mh = nullptr;
+  }
+
+  void Communicator::comm_start(MsgHandle *mh) { mock::start(mh); }
+
+  void Communicator::comm_wait(MsgHandle *mh) { mock::wait(mh); }
+
+  int Communicator::comm_query(MsgHandle *mh)
+  {
+    if (!mh->complete) mock::progress(false);
+    return mh->complete;
+  }
+
+  NeighborHandle *Communicator::comm_declare_neighbor_alltoallv(void *send_buffer, const std::vector<CommNeighbor> &dst,
+                                                                void *recv_buffer, const std::vector<CommNeighbor> &src)
+  {
+    // there is no graph communicator to create, so the neighborhood
+    // exchange is carried out with point-to-point messages
+    auto nh = new NeighborHandle;
+    for (auto &n : src)
+      nh->recv.push_back(mock::make_handle(false, mock_group[n.rank], mock_context, mock::neighbor_tag,
+                                           static_cast<char *>(recv_buffer) + n.offset, n.bytes));
+    for (auto &n : dst)
+      nh->send.push_back(mock::make_handle(true, mock_group[n.rank], mock_context, mock::neighbor_tag,
+                                           static_cast<char *>(send_buffer) + n.offset, n.bytes));
+    return nh;
+  }
+
+  void Communicator::comm_neighbor_alltoallv(NeighborHandle *nh)
+  {
+    for (auto &mh : nh->recv) mock::start(&mh);
+    for (auto &mh : nh->send) mock::start(&mh);
+    for (auto &mh : nh->recv) mock::wait(&mh);
+    for (auto &mh : nh->send) mock::wait(&mh);
+  }
+
+  void Communicator::comm_free(NeighborHandle *&nh)
+  {
+    delete nh;
+    nh = nullptr;
+  }
+
+  void Communicator::comm_allreduce_sum_array(double *data, size_t size)
+  {
+    // the rank-ordered reduction is deterministic regardless of QUDA_DETERMINISTIC_REDUCE
+    mock::allreduce(mock_group, mock_context, rank, data, size, [](double a, double b) { return a + b; });
+  }
+
+  void Communicator::comm_allreduce_sum(size_t &a)
+  {
+    mock::allreduce(mock_group, mock_context, rank, &a, 1, [](size_t a, size_t b) { return a + b; });
+  }
+
+  void Communicator::comm_allreduce_max_array(deviation_t<double> *data, size_t size)
+  {
+    mock::allreduce(mock_group, mock_context, rank, data, size,
+                    [](const deviation_t<double> &a, const deviation_t<double> &b) { return a > b ? a : b; });
+  }
+
+  void Communicator::comm_allreduce_max_array(double *data, size_t size)
+  {
+    mock::allreduce(mock_group, mock_context, rank, data, size, [](double a, double b) { return a > b ? a : b; });
+  }
+
+  void Communicator::comm_allreduce_min_array(double *data, size_t size)
+  {
+    mock::allreduce(mock_group, mock_context, rank, data, size, [](double a, double b) { return a < b ? a : b; });
+  }
+
+  void Communicator::comm_allreduce_int(int &data)
+  {
+    mock::allreduce(mock_group, mock_context, rank, &data, 1, [](int a, int b) { return a + b; });
+  }
+
+  void Communicator::comm_allreduce_xor(uint64_t &data)
+  {
+    mock::allreduce(mock_group, mock_context, rank, &data, 1, [](uint64_t a, uint64_t b) { return a ^ b; });
+  }
+
+  void Communicator::comm_broadcast(void *data, size_t nbytes, int root)
+  {
+    if (rank == root) {
+      std::vector<MsgHandle> send;
+      send.reserve(size);
+      for (int r = 0; r < size; r++) {
+        if (r == root) continue;
+        send.push_back(mock::make_handle(true, mock_group[r], mock_context, mock::broadcast_tag, data, nbytes));
+        mock::start(&send.back());
+      }
+      for (auto &mh : send) mock::wait(&mh);
+    } else {
+      auto mh = mock::make_handle(false, mock_group[root], mock_context, mock::broadcast_tag, data, nbytes);
+      mock::start(&mh);
+      mock::wait(&mh);
+    }
+  }
+
+  void Communicator::comm_barrier(void)
+  {
+    int dummy = 0;
+    comm_allreduce_int(dummy);
+  }
+
+  void Communicator::comm_abort_(int status)
+  {
+    // take down the other simulated ranks: the root signals its
+    // children, while the other ranks signal the root, whose exit is
+    // then seen by the remaining ranks as a closed socket
+    if (mock::world.rank == 0) {
+      for (auto pid : mock::world.children) kill(pid, SIGTERM);
+      mock::world.children.clear();
+    } else if (mock::world.parent > 0) {
+      kill(mock::world.parent, SIGTERM);
+    }
+    exit(status);
+  }
+
+  int Communicator::comm_rank_global() { return mock::world.rank; }
+
+} // namespace quda
@@ -282,16 +282,17 @@ namespace quda
       MPI_CHECK(MPI_Allreduce(data, recvbuf.data(), size, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE));
       memcpy(data, recvbuf.data(), size * sizeof(double));
     } else {
-      size_t n = comm_size();
-      std::vector<double> recv_buf(size * n);
-      MPI_CHECK(MPI_Allgather(data, size, MPI_DOUBLE, recv_buf.data(), size, MPI_DOUBLE, MPI_COMM_HANDLE));
-
-      std::vector<double> recv_trans(size * n);
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < size; j++) { recv_trans[j * n + i] = recv_buf[i * size + j]; }
-      }
-
-      for (size_t i = 0; i < size; i++) { data[i] = deterministic_reduce(recv_trans.data() + i * n, n); }
+      reproducible::allreduce_sum(
+        data, size,
+        [&](const double *in, double *out, size_t n) {
+          MPI_CHECK(MPI_Allreduce(in, out, n, MPI_DOUBLE, MPI_MAX, MPI_COMM_HANDLE));
+        },
+        [&](const double *in, double *out, size_t n) {
+          MPI_CHECK(MPI_Allreduce(in, out, n, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE));
+        },
+        [&](const int64_t *in, int64_t *out, size_t n) {
+          MPI_CHECK(MPI_Allreduce(in, out, n, MPI_INT64_T, MPI_SUM, MPI_COMM_HANDLE));
+        });
     }
   }
 
@@ -0,0 +1,108 @@
+#include <communicator_quda.h>
+
+/**
+   @file communicator_neighbor_mpi.cpp
+
+   @section DESCRIPTION
+   Neighborhood collectives for the MPI and QMP communicators.  QMP
+   has no neighborhood collectives, so both backends use MPI directly
+   on the communicator's MPI_COMM_HANDLE.
+ */
+
+#define MPI_CHECK(mpi_call)                                                                                            \
+  do {                                                                                                                 \
+    int status = mpi_call;                                                                                             \
+    if (status != MPI_SUCCESS) {                                                                                       \
+      char err_string[MPI_MAX_ERROR_STRING];                                                                           \
+      int err_len;                                                                                                     \
+      MPI_Error_string(status, err_string, &err_len);                                                                  \
+      err_string[127] = '\0';                                                                                          \
+      errorQuda("(MPI) %s", err_string);                                                                               \
+    }                                                                                                                  \
+  } while (0)
+
+namespace quda
+{
+
+  struct NeighborHandle_s {
+    /** The distributed-graph communicator spanning the neighborhood */
+    MPI_Comm comm;
+
+    /** Buffers from which we send and into which we receive */
+    void *send_buffer;
+    void *recv_buffer;
+
+    /** Message sizes and displacements for each neighbor */
+    std::vector<int> send_count;
+    std::vector<int> send_displ;
+    std::vector<int> recv_count;
+    std::vector<int> recv_displ;
+
+#if MPI_VERSION >= 4
+    /** Persistent request created with MPI_Neighbor_alltoallv_init */
+    MPI_Request request;
+#endif
+  };
+
+  NeighborHandle *Communicator::comm_declare_neighbor_alltoallv(void *send_buffer, const std::vector<CommNeighbor> &dst,
+                                                                void *recv_buffer, const std::vector<CommNeighbor> &src)
+  {
+    auto to_int = [](size_t n) {
+      if (n > static_cast<size_t>(std::numeric_limits<int>::max()))
+        errorQuda("Neighbor message offset or size %lu exceeds int range", n);
+      return static_cast<int>(n);
+    };
+
+    auto nh = new NeighborHandle;
+    nh->send_buffer = send_buffer;
+    nh->recv_buffer = recv_buffer;
+
+    std::vector<int> dst_rank;
+    for (auto &n : dst) {
+      dst_rank.push_back(n.rank);
+      nh->send_count.push_back(to_int(n.bytes));
+      nh->send_displ.push_back(to_int(n.offset));
+    }
+
+    std::vector<int> src_rank;
+    for (auto &n : src) {
+      src_rank.push_back(n.rank);
+      nh->recv_count.push_back(to_int(n.bytes));
+      nh->recv_displ.push_back(to_int(n.offset));
+    }
+
+    MPI_CHECK(MPI_Dist_graph_create_adjacent(MPI_COMM_HANDLE, src_rank.size(), src_rank.data(), MPI_UNWEIGHTED,
+                                             dst_rank.size(), dst_rank.data(), MPI_UNWEIGHTED, MPI_INFO_NULL, 0,
+                                             &nh->comm));
+
+#if MPI_VERSION >= 4
+    MPI_CHECK(MPI_Neighbor_alltoallv_init(send_buffer, nh->send_count.data(), nh->send_displ.data(), MPI_BYTE,
+                                          recv_buffer, nh->recv_count.data(), nh->recv_displ.data(), MPI_BYTE, nh->comm,
+                                          MPI_INFO_NULL, &nh->request));
+#endif
+
+    return nh;
+  }
+
+  void Communicator::comm_neighbor_alltoallv(NeighborHandle *nh)
+  {
+#if MPI_VERSION >= 4
+    MPI_CHECK(MPI_Start(&nh->request));
+    MPI_CHECK(MPI_Wait(&nh->request, MPI_STATUS_IGNORE));
+#else
+    MPI_CHECK(MPI_Neighbor_alltoallv(nh->send_buffer, nh->send_count.data(), nh->send_displ.data(), MPI_BYTE,
+                                     nh->recv_buffer, nh->recv_count.data(), nh->recv_displ.data(), MPI_BYTE, nh->comm));
+#endif
+  }
+
+  void Communicator::comm_free(NeighborHandle *&nh)
+  {
+#if MPI_VERSION >= 4
+    MPI_CHECK(MPI_Request_free(&nh->request));
+#endif
+    MPI_CHECK(MPI_Comm_free(&nh->comm));
+    delete nh;
+    nh = nullptr;
+  }
+
+} // namespace quda
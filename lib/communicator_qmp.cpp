@@ -307,17 +307,18 @@ void Communicator::comm_allreduce_sum_array(double *data, size_t size)
   if (!comm_deterministic_reduce()) {
     QMP_CHECK(QMP_comm_sum_double_array(QMP_COMM_HANDLE, data, size));
   } else {
-    // we need to break out of QMP for the deterministic floating point reductions
-    size_t n = comm_size();
-    std::vector<double> recv_buf(size * n);
-    MPI_CHECK(MPI_Allgather(data, size, MPI_DOUBLE, recv_buf.data(), size, MPI_DOUBLE, MPI_COMM_HANDLE));
-
-    std::vector<double> recv_trans(size * n);
-    for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < size; j++) { recv_trans[j * n + i] = recv_buf[i * size + j]; }
-    }
-
-    for (size_t i = 0; i < size; i++) { data[i] = deterministic_reduce(recv_trans.data() + i * n, n); }
+    // QMP has no max or integer array reductions, so the reproducible sum breaks out to MPI
+    reproducible::allreduce_sum(
+      data, size,
+      [&](const double *in, double *out, size_t n) {
+        MPI_CHECK(MPI_Allreduce(in, out, n, MPI_DOUBLE, MPI_MAX, MPI_COMM_HANDLE));
+      },
+      [&](const double *in, double *out, size_t n) {
+        MPI_CHECK(MPI_Allreduce(in, out, n, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE));
+      },
+      [&](const int64_t *in, int64_t *out, size_t n) {
+        MPI_CHECK(MPI_Allreduce(in, out, n, MPI_INT64_T, MPI_SUM, MPI_COMM_HANDLE));
+      });
   }
 }
 
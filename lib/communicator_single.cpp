@@ -81,6 +81,16 @@ namespace quda
 
   int Communicator::comm_query(MsgHandle *) { return 1; }
 
+  NeighborHandle *Communicator::comm_declare_neighbor_alltoallv(void *, const std::vector<CommNeighbor> &, void *,
+                                                                const std::vector<CommNeighbor> &)
+  {
+    return nullptr;
+  }
+
+  void Communicator::comm_neighbor_alltoallv(NeighborHandle *) { }
+
+  void Communicator::comm_free(NeighborHandle *&) { }
+
   void Communicator::comm_allreduce_sum_array(double *, size_t) { }
 
   void Communicator::comm_allreduce_sum(size_t &) { }
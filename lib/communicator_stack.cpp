@@ -234,6 +234,24 @@ namespace quda
 
   int comm_query(MsgHandle *mh) { CHECK_MH(mh); return get_current_communicator().comm_query(mh); }
 
+  NeighborHandle *comm_declare_neighbor_alltoallv(void *send_buffer, const std::vector<CommNeighbor> &dst,
+                                                  void *recv_buffer, const std::vector<CommNeighbor> &src)
+  {
+    return get_current_communicator().comm_declare_neighbor_alltoallv(send_buffer, dst, recv_buffer, src);
+  }
+
+  void comm_neighbor_alltoallv(NeighborHandle *nh)
+  {
+    CHECK_MH(nh);
+    get_current_communicator().comm_neighbor_alltoallv(nh);
+  }
+
+  void comm_free(NeighborHandle *&nh)
+  {
+    CHECK_MH(nh);
+    get_current_communicator().comm_free(nh);
+  }
+
 #undef CHECK_MH
 
   void comm_allreduce_sum_array(double *data, size_t size)
@@ -271,6 +289,11 @@ namespace quda
     comm_allreduce_sum_array(reinterpret_cast<double *>(a.data()), 4 * a.size());
   }
 
+  template <> void comm_allreduce_sum<std::vector<array<double, 5>>>(std::vector<array<double, 5>> &a)
+  {
+    comm_allreduce_sum_array(reinterpret_cast<double *>(a.data()), 5 * a.size());
+  }
+
   template <> void comm_allreduce_sum<double>(double &a) { comm_allreduce_sum_array(&a, 1); }
 
   template <> void comm_allreduce_sum<size_t>(size_t &a) { get_current_communicator().comm_allreduce_sum(a); }
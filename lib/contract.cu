@@ -4,6 +4,8 @@
 #include <tunable_nd.h>
 #include <tunable_reduction.h>
 #include <instantiate.h>
+#include <blas_lapack.h>
+#include <quda_ptr.h>
 #include <kernels/contraction.cuh>
 
 namespace quda {
@@ -123,6 +125,9 @@ namespace quda {
         errorQuda("Unexpected gamma basis x=%d y=%d", x.GammaBasis(), y.GammaBasis());
     }
     if (x.Ncolor() != 3 || y.Ncolor() != 3) errorQuda("Unexpected number of colors x=%d y=%d", x.Ncolor(), y.Ncolor());
+    checkLocation(x, y);
+    if (x.Location() != QUDA_CUDA_FIELD_LOCATION)
+      errorQuda("Summed contractions are only supported on the device, use contractFTMultiQuda for host fields");
 
     instantiate<ContractionSummed>(x, y, result_global, cType, source_position, mom_mode, fft_type, s1, b1);
   }
@@ -217,4 +222,251 @@ public:
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
   }
 
+  template <typename Float, int nColor> class ContractionSpinMatrix : TunableKernel2D
+  {
+    cvector_ref<const ColorSpinorField> &x;
+    cvector_ref<const ColorSpinorField> &y;
+    complex<Float> *M;
+    const int reduction_dim;
+    unsigned int minThreads() const override { return x.Volume(); }
+
+    template <int nSpin, int reduction_dim> void launch(TuneParam &tp, const qudaStream_t &stream)
+    {
+      constexpr bool enable_host = true;
+      ContractionSpinMatrixArg<Float, nColor, nSpin, reduction_dim> arg(x, y, M);
+      TunableKernel2D::launch<ColorContractSpinMatrix, enable_host>(tp, stream, arg);
+    }
+
+  public:
+    ContractionSpinMatrix(cvector_ref<const ColorSpinorField> &x, cvector_ref<const ColorSpinorField> &y, void *M,
+                          int reduction_dim) :
+      TunableKernel2D(x[0], x.size()), x(x), y(y), M(static_cast<complex<Float> *>(M)), reduction_dim(reduction_dim)
+    {
+      strcat(aux, reduction_dim == 2 ? ",z-slice,nx=" : ",t-slice,nx=");
+      char rhs_str[16];
+      i32toa(rhs_str, x.size());
+      strcat(aux, rhs_str);
+      strcat(aux, ",ny=");
+      i32toa(rhs_str, y.size());
+      strcat(aux, rhs_str);
+      apply(device::get_default_stream());
+    }
+
+    void apply(const qudaStream_t &stream) override
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      if (x.Nspin() == 4) {
+        if (reduction_dim == 2)
+          launch<4, 2>(tp, stream);
+        else
+          launch<4, 3>(tp, stream);
+      } else if (x.Nspin() == 1 && reduction_dim == 3) {
+        launch<1, 3>(tp, stream);
+      } else {
+        errorQuda("Unexpected nSpin = %d, reduction_dim = %d", x.Nspin(), reduction_dim);
+      }
+    }
+
+    long long flops() const override
+    {
+      return 8ll * x.size() * y.size() * x.Nspin() * x.Nspin() * x.Ncolor() * x.Volume();
+    }
+
+    long long bytes() const override
+    {
+      return x.Bytes() + y.Bytes() * x.size()
+        + x.size() * y.size() * x.Nspin() * x.Nspin() * x.Volume() * sizeof(complex<Float>);
+    }
+  };
+
+  /**
+     @brief Fill the Fourier phase table of a set of momenta over the
+     local slice of the lattice orthogonal to the reduction dimension,
+     together with the phase factor of each local slice.  The slice
+     table is the product of one-dimensional tables, so only O(L)
+     trigonometric evaluations are done per momentum.
+   */
+  template <typename Float>
+  void fourierPhaseTable(std::vector<complex<Float>> &phase, std::vector<Complex> &slice_phase, const int *X,
+                         int reduction_dim, const int *source_position, int n_mom, const int *mom_modes,
+                         const QudaFFTSymmType *fft_type)
+  {
+    auto phase_1d = [&](int m, int d, int x) -> Complex {
+      auto theta
+        = 2.0 * M_PI * (x + comm_coord(d) * X[d] - source_position[d]) * mom_modes[4 * m + d] / (comm_dim(d) * X[d]);
+      switch (fft_type[4 * m + d]) {
+      case QUDA_FFT_SYMM_EO: return {cos(theta), sin(theta)};
+      case QUDA_FFT_SYMM_EVEN: return {cos(theta), 0.0};
+      case QUDA_FFT_SYMM_ODD: return {0.0, sin(theta)};
+      default: errorQuda("Unexpected FFT symmetry type %d", fft_type[4 * m + d]);
+      }
+      return {};
+    };
+
+    int dims[3];
+    for (int d = 0, i = 0; d < 4; d++)
+      if (d != reduction_dim) dims[i++] = d;
+    auto V3 = X[dims[0]] * X[dims[1]] * X[dims[2]];
+
+    phase.resize(n_mom * V3);
+    slice_phase.resize(n_mom * X[reduction_dim]);
+
+    std::vector<Complex> table[3];
+    for (int m = 0; m < n_mom; m++) {
+      for (int i = 0; i < 3; i++) {
+        table[i].resize(X[dims[i]]);
+        for (int x = 0; x < X[dims[i]]; x++) table[i][x] = phase_1d(m, dims[i], x);
+      }
+      for (int x2 = 0; x2 < X[dims[2]]; x2++) {
+        for (int x1 = 0; x1 < X[dims[1]]; x1++) {
+          auto phase12 = table[2][x2] * table[1][x1];
+          for (int x0 = 0; x0 < X[dims[0]]; x0++) {
+            auto p = phase12 * table[0][x0];
+            phase[m * V3 + (x2 * X[dims[1]] + x1) * X[dims[0]] + x0] = {static_cast<Float>(p.real()),
+                                                                         static_cast<Float>(p.imag())};
+          }
+        }
+      }
+      for (int t = 0; t < X[reduction_dim]; t++) slice_phase[m * X[reduction_dim] + t] = phase_1d(m, reduction_dim, t);
+    }
+  }
+
+  template <typename Float>
+  void contractFTMulti(std::vector<Complex> &result, cvector_ref<const ColorSpinorField> &x,
+                       cvector_ref<const ColorSpinorField> &y, int reduction_dim, const int *source_position,
+                       int n_mom, const int *mom_modes, const QudaFFTSymmType *fft_type)
+  {
+    const auto location = x.Location();
+    const auto mem_type = location == QUDA_CUDA_FIELD_LOCATION ? QUDA_MEMORY_DEVICE : QUDA_MEMORY_HOST;
+    const int nSpinSq = x.Nspin() * x.Nspin();
+    const int n_slice = x.X(reduction_dim);
+    const int global_slices = n_slice * comm_dim(reduction_dim);
+    const int V3 = x.Volume() / n_slice;
+
+    std::vector<complex<Float>> phase_h;
+    std::vector<Complex> slice_phase;
+    fourierPhaseTable(phase_h, slice_phase, x[0].X(), reduction_dim, source_position, n_mom, mom_modes, fft_type);
+
+    // the phase table is built once and reused by every tile
+    quda_ptr phase_d;
+    void *phase = phase_h.data();
+    if (location == QUDA_CUDA_FIELD_LOCATION) {
+      phase_d = quda_ptr(mem_type, phase_h.size() * sizeof(complex<Float>));
+      qudaMemcpy(phase_d.data(), phase_h.data(), phase_h.size() * sizeof(complex<Float>), qudaMemcpyHostToDevice);
+      phase = phase_d.data();
+    }
+
+    // tiles are bounded by the spin-matrix elements per site, which sets the size of the intermediate
+    const auto max_nx = std::min(max_contract_nx, std::max(1ul, max_contract_k / nSpinSq));
+    quda_ptr M(mem_type, x.Volume() * max_contract_k * sizeof(complex<Float>));
+    quda_ptr C(mem_type, n_mom * n_slice * max_contract_k * sizeof(complex<Float>));
+    std::vector<complex<Float>> C_h(location == QUDA_CUDA_FIELD_LOCATION ? n_mom * n_slice * max_contract_k : 0);
+
+    for (auto tx = 0u; tx < x.size(); tx += max_nx) {
+      auto tile_x = std::min(max_nx, x.size() - tx);
+      auto max_ny = std::min(max_contract_ny, std::max(1ul, max_contract_k / (nSpinSq * tile_x)));
+      for (auto ty = 0u; ty < y.size(); ty += max_ny) {
+        auto tile_y = std::min(max_ny, y.size() - ty);
+        const int K = tile_x * tile_y * nSpinSq;
+
+        instantiate<ContractionSpinMatrix, Float>(
+          cvector_ref<const ColorSpinorField> {x.begin() + tx, x.begin() + tx + tile_x},
+          cvector_ref<const ColorSpinorField> {y.begin() + ty, y.begin() + ty + tile_y}, M.data(), reduction_dim);
+
+        // C[mom][slice * K] = phase[mom][xyz] * M[xyz][slice * K]
+        QudaBLASParam blas_param = {};
+        blas_param.struct_size = sizeof(blas_param);
+        blas_param.blas_type = QUDA_BLAS_GEMM;
+        blas_param.trans_a = QUDA_BLAS_OP_N;
+        blas_param.trans_b = QUDA_BLAS_OP_N;
+        blas_param.m = n_mom;
+        blas_param.n = n_slice * K;
+        blas_param.k = V3;
+        blas_param.lda = V3;
+        blas_param.ldb = n_slice * K;
+        blas_param.ldc = n_slice * K;
+        blas_param.a_stride = 1;
+        blas_param.b_stride = 1;
+        blas_param.c_stride = 1;
+        blas_param.alpha = 1.0;
+        blas_param.beta = 0.0;
+        blas_param.batch_count = 1;
+        blas_param.data_type = std::is_same_v<Float, double> ? QUDA_BLAS_DATATYPE_Z : QUDA_BLAS_DATATYPE_C;
+        blas_param.data_order = QUDA_BLAS_DATAORDER_ROW;
+
+        if (location == QUDA_CUDA_FIELD_LOCATION) {
+          blas_lapack::native::stridedBatchGEMM(phase, M.data(), C.data(), blas_param, location);
+          qudaMemcpy(C_h.data(), C.data(), n_mom * n_slice * K * sizeof(complex<Float>), qudaMemcpyDeviceToHost);
+        } else {
+          blas_lapack::generic::stridedBatchGEMM(phase, M.data(), C.data(), blas_param, location);
+        }
+
+        auto C_ptr = location == QUDA_CUDA_FIELD_LOCATION ? C_h.data() : static_cast<complex<Float> *>(C.data());
+        for (int m = 0; m < n_mom; m++) {
+          for (int t = 0; t < n_slice; t++) {
+            auto t_global = comm_coord(reduction_dim) * n_slice + t;
+            auto ph = slice_phase[m * n_slice + t];
+            for (auto i = 0u; i < tile_x; i++) {
+              for (auto j = 0u; j < tile_y; j++) {
+                for (int s = 0; s < nSpinSq; s++) {
+                  auto c = C_ptr[(m * n_slice + t) * K + (i * tile_y + j) * nSpinSq + s];
+                  result[(((m * global_slices + t_global) * x.size() + tx + i) * y.size() + ty + j) * nSpinSq + s]
+                    = ph * Complex(c.real(), c.imag());
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void contractFTMultiQuda(std::vector<Complex> &result, cvector_ref<const ColorSpinorField> &x,
+                           cvector_ref<const ColorSpinorField> &y, const QudaContractType cType,
+                           const int *const source_position, const int n_mom, const int *const mom_modes,
+                           const QudaFFTSymmType *const fft_type)
+  {
+    getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+    checkPrecision(x[0], y[0]);
+    checkNative(x[0], y[0]);
+    checkLocation(x[0], y[0]);
+    if (x.Nspin() != y.Nspin())
+      errorQuda("Contraction between unequal number of spins x=%d y=%d", x.Nspin(), y.Nspin());
+    if (x.Ncolor() != 3 || y.Ncolor() != 3) errorQuda("Unexpected number of colors x=%d y=%d", x.Ncolor(), y.Ncolor());
+
+    int reduction_dim = 3;
+    switch (cType) {
+    case QUDA_CONTRACT_TYPE_DR_FT_Z: reduction_dim = 2; [[fallthrough]];
+    case QUDA_CONTRACT_TYPE_DR_FT_T:
+      if (x.Nspin() != 4) errorQuda("Expected four-spinors x=%d y=%d", x.Nspin(), y.Nspin());
+      if (x[0].GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS || y[0].GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS)
+        errorQuda("Unexpected gamma basis x=%d y=%d", x[0].GammaBasis(), y[0].GammaBasis());
+      break;
+    case QUDA_CONTRACT_TYPE_STAGGERED_FT_T:
+      if (x.Nspin() != 1) errorQuda("Expected staggered fields x=%d y=%d", x.Nspin(), y.Nspin());
+      break;
+    default: errorQuda("Unexpected contraction type %d", cType);
+    }
+
+    result.assign(n_mom * x.X(reduction_dim) * comm_dim(reduction_dim) * x.size() * y.size() * x.Nspin() * x.Nspin(),
+                  0.0);
+
+    if (x.Precision() == QUDA_DOUBLE_PRECISION) {
+      if constexpr (is_enabled(QUDA_DOUBLE_PRECISION))
+        contractFTMulti<double>(result, x, y, reduction_dim, source_position, n_mom, mom_modes, fft_type);
+      else
+        errorQuda("QUDA_PRECISION=%d does not enable double precision", QUDA_PRECISION);
+    } else if (x.Precision() == QUDA_SINGLE_PRECISION) {
+      if constexpr (is_enabled(QUDA_SINGLE_PRECISION))
+        contractFTMulti<float>(result, x, y, reduction_dim, source_position, n_mom, mom_modes, fft_type);
+      else
+        errorQuda("QUDA_PRECISION=%d does not enable single precision", QUDA_PRECISION);
+    } else {
+      errorQuda("Unsupported precision %d", x.Precision());
+    }
+
+    comm_allreduce_sum(result);
+    getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+  }
+
 } // namespace quda
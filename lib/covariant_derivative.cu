@@ -21,7 +21,7 @@ namespace quda
 
   template <typename Arg> class CovDev : public Dslash<covDev, Arg>
   {
-    using Dslash = Dslash<covDev, Arg>;
+    using Dslash = quda::Dslash<covDev, Arg>;
     using Dslash::arg;
     using Dslash::halo;
     using Dslash::in;
@@ -8,11 +8,73 @@ namespace quda
 {
 
   using namespace blas;
-  using DynamicStride = Stride<Dynamic, Dynamic>;
 
   static auto pinned_allocator = [] (size_t bytes ) { return static_cast<Complex*>(pool_pinned_malloc(bytes)); };
   static auto pinned_deleter   = [] (Complex *hptr) { pool_pinned_free(hptr); };
 
+  /**
+     @brief Expand a packed Hermitian matrix into a dense one
+     @param[in] packed Upper triangle in packed format
+     @param[in] n Matrix dimension
+     @return The dense Hermitian matrix
+  */
+  static MatrixXcd unpack_hermitian(const Complex *packed, int n)
+  {
+    MatrixXcd mat(n, n);
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < j; i++) {
+        mat(i, j) = packed[DeflationParam::packed_idx(i, j)];
+        mat(j, i) = conj(mat(i, j));
+      }
+      mat(j, j) = packed[DeflationParam::packed_idx(j, j)].real();
+    }
+    return mat;
+  }
+
+  /**
+     @brief Border the Cholesky factor R of the leading j x j block
+     of the projection matrix with column j, i.e., solve R^H r = h for
+     the new off-diagonal column and set r_jj = sqrt(h_jj - |r|^2).
+     This costs O(j^2) compared to O(j^3) for a refactorization.
+     @param[in,out] chol Packed Cholesky factor
+     @param[in] proj Packed projection matrix
+     @param[in] j Index of the column to append
+     @return Whether the extended matrix is numerically positive definite
+  */
+  static bool cholesky_append(Complex *chol, const Complex *proj, int j)
+  {
+    Complex *r = &chol[DeflationParam::packed_idx(0, j)];
+    double diag = proj[DeflationParam::packed_idx(j, j)].real();
+    for (int i = 0; i < j; i++) {
+      Complex sum = proj[DeflationParam::packed_idx(i, j)];
+      for (int k = 0; k < i; k++) sum -= conj(chol[DeflationParam::packed_idx(k, i)]) * r[k];
+      r[i] = sum / chol[DeflationParam::packed_idx(i, i)].real();
+      diag -= norm(r[i]);
+    }
+    if (diag <= 0.0) return false;
+    r[j] = sqrt(diag);
+    return true;
+  }
+
+  /**
+     @brief Solve R^H R x = b in place using the packed Cholesky factor
+     @param[in] chol Packed Cholesky factor
+     @param[in] n Dimension of the system
+     @param[in,out] x On input the right hand side, on output the solution
+  */
+  static void cholesky_solve(const Complex *chol, int n, Complex *x)
+  {
+    for (int i = 0; i < n; i++) { // R^H y = b
+      const Complex *r = &chol[DeflationParam::packed_idx(0, i)];
+      for (int k = 0; k < i; k++) x[i] -= conj(r[k]) * x[k];
+      x[i] /= r[i].real();
+    }
+    for (int i = n - 1; i >= 0; i--) { // R x = y
+      for (int k = i + 1; k < n; k++) x[i] -= chol[DeflationParam::packed_idx(i, k)] * x[k];
+      x[i] /= chol[DeflationParam::packed_idx(i, i)].real();
+    }
+  }
+
   Deflation::Deflation(DeflationParam &param, TimeProfile &profile) :
     param(param),
     profile(profile),
@@ -83,14 +145,14 @@ namespace quda
     const int n_evs_to_print = param.cur_dim;
     if (n_evs_to_print == 0) errorQuda("Incorrect size of current deflation space");
 
-    std::unique_ptr<Complex, decltype(pinned_deleter) > projm( pinned_allocator(param.ld*param.cur_dim * sizeof(Complex)), pinned_deleter);
+    std::unique_ptr<Complex, decltype(pinned_deleter)> projm(
+      pinned_allocator(param.cur_dim * param.cur_dim * sizeof(Complex)), pinned_deleter);
 
-if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
-      Map<MatrixXcd, Unaligned, DynamicStride> projm_(param.matProj, param.cur_dim, param.cur_dim, DynamicStride(param.ld, 1));
-      Map<MatrixXcd, Unaligned, DynamicStride> evecs_(projm.get(), param.cur_dim, param.cur_dim, DynamicStride(param.ld, 1));
+    if (param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB) {
+      Map<MatrixXcd, Unaligned> evecs_(projm.get(), param.cur_dim, param.cur_dim);
 
-      SelfAdjointEigenSolver<MatrixXcd> es_projm( projm_ );
-      evecs_.block(0, 0, param.cur_dim, param.cur_dim) = es_projm.eigenvectors();
+      SelfAdjointEigenSolver<MatrixXcd> es_projm(unpack_hermitian(param.matProj, param.cur_dim));
+      evecs_ = es_projm.eigenvectors();
     } else {
       errorQuda("Library type %d is currently not supported", param.eig_global.extlib_type);
     }
@@ -101,7 +163,7 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
 
     for (int i = 0; i < n_evs_to_print; i++) {
       zero(*r);
-      blas::legacy::caxpy(&projm.get()[i * param.ld], rv, res); // multiblas
+      blas::legacy::caxpy(&projm.get()[i * param.cur_dim], rv, res); // multiblas
       *r_sloppy = *r;
       param.matDeflation(*Av_sloppy, *r_sloppy);
       double3 dotnorm = cDotProductNormA(*r_sloppy, *Av_sloppy);
@@ -120,7 +182,7 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
 
     if(param.cur_dim == 0) return;//nothing to do
 
-    std::unique_ptr<Complex[] > vec(new Complex[param.ld]);
+    std::unique_ptr<Complex[]> vec(new Complex[param.cur_dim]);
 
     double check_nrm2 = norm2(b);
 
@@ -136,13 +198,13 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
     blas::legacy::cDotProduct(vec.get(), rv_, in_); //<i, b>
 
     if (!param.use_inv_ritz) {
-      if (param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB) {
-        Map<MatrixXcd, Unaligned, DynamicStride> projm_(param.matProj, param.cur_dim, param.cur_dim,
-                                                        DynamicStride(param.ld, 1));
+      if (param.use_chol) {
+        cholesky_solve(param.matChol, param.cur_dim, vec.get());
+      } else if (param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB) {
         Map<VectorXcd, Unaligned> vec_(vec.get(), param.cur_dim);
 
         VectorXcd vec2_(param.cur_dim);
-        vec2_ = projm_.fullPivHouseholderQr().solve(vec_);
+        vec2_ = unpack_hermitian(param.matProj, param.cur_dim).fullPivHouseholderQr().solve(vec_);
         vec_ = vec2_;
       } else {
         errorQuda("Library type %d is currently not supported", param.eig_global.extlib_type);
@@ -217,7 +279,7 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
       param.matDeflation(*Av_sloppy, param.RV->Component(i)); // precision must match!
       // load diagonal:
       *Av = *Av_sloppy;
-      param.matProj[i * param.ld + i] = cDotProduct(*accum, *Av);
+      param.matProj[DeflationParam::packed_idx(i, i)] = cDotProduct(*accum, *Av);
 
       if (i > 0) {
         std::vector<ColorSpinorField *> vj_(param.RV->Components().begin(), param.RV->Components().begin() + i);
@@ -226,10 +288,14 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
 
         blas::legacy::cDotProduct(alpha.get(), vj_, av_);
 
-        for (int j = 0; j < i; j++) {
-          param.matProj[i * param.ld + j] = alpha[j];
-          param.matProj[j * param.ld + i] = conj(alpha[j]); // conj
-        }
+        // only the upper triangle is stored: column i is contiguous
+        for (int j = 0; j < i; j++) param.matProj[DeflationParam::packed_idx(j, i)] = alpha[j];
+      }
+
+      // border the Cholesky factor with the new column
+      if (param.use_chol && !cholesky_append(param.matChol, param.matProj, i)) {
+        warningQuda("Projection matrix is not numerically positive definite at dim %d, falling back to QR solve", i + 1);
+        param.use_chol = false;
       }
     }
 
@@ -247,15 +313,12 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
 
     std::unique_ptr<double[]> evals(new double[param.cur_dim]);
     std::unique_ptr<Complex, decltype(pinned_deleter)> projm(
-      pinned_allocator(param.ld * param.cur_dim * sizeof(Complex)), pinned_deleter);
-
-    memcpy(projm.get(), param.matProj, param.ld * param.cur_dim * sizeof(Complex));
+      pinned_allocator(param.cur_dim * param.cur_dim * sizeof(Complex)), pinned_deleter);
 
     if (param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB) {
-      Map<MatrixXcd, Unaligned, DynamicStride> projm_(projm.get(), param.cur_dim, param.cur_dim,
-                                                      DynamicStride(param.ld, 1));
+      Map<MatrixXcd, Unaligned> projm_(projm.get(), param.cur_dim, param.cur_dim);
       Map<VectorXd, Unaligned> evals_(evals.get(), param.cur_dim);
-      SelfAdjointEigenSolver<MatrixXcd> es(projm_);
+      SelfAdjointEigenSolver<MatrixXcd> es(unpack_hermitian(param.matProj, param.cur_dim));
       projm_ = es.eigenvectors();
       evals_ = es.eigenvalues();
     } else {
@@ -292,7 +355,7 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
       res.push_back(r);
 
       blas::zero(*r);
-      blas::legacy::caxpy(&projm.get()[idx * param.ld], rv, res); // multiblas
+      blas::legacy::caxpy(&projm.get()[idx * param.cur_dim], rv, res); // multiblas
       blas::copy(buff->Component(idx), *r);
 
       if (do_residual_check) { // if tol=0.0 then disable relative residual norm check
@@ -315,6 +378,20 @@ if( param.eig_global.extlib_type == QUDA_EIGEN_EXTLIB ) {
     // reset current dimension:
     param.cur_dim = idx; // idx never exceeds cur_dim.
     param.tot_dim = idx;
+
+    // the retained vectors are Ritz vectors, so the projection matrix and its factor are now diagonal
+    param.use_chol = true;
+    for (int j = 0; j < idx; j++) {
+      for (int i = 0; i < j; i++) {
+        param.matProj[DeflationParam::packed_idx(i, j)] = 0.0;
+        param.matChol[DeflationParam::packed_idx(i, j)] = 0.0;
+      }
+      param.matProj[DeflationParam::packed_idx(j, j)] = evals[j];
+      if (evals[j] > 0.0)
+        param.matChol[DeflationParam::packed_idx(j, j)] = sqrt(evals[j]);
+      else
+        param.use_chol = false;
+    }
   }
 
 } // namespace quda
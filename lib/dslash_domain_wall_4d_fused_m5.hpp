@@ -15,7 +15,7 @@ namespace quda
 
   template <typename Arg> class DomainWall4DFusedM5 : public Dslash<domainWall4DFusedM5, Arg>
   {
-    using Dslash = Dslash<domainWall4DFusedM5, Arg>;
+    using Dslash = quda::Dslash<domainWall4DFusedM5, Arg>;
     using Dslash::arg;
     using Dslash::aux_base;
     using Dslash::in;
@@ -17,7 +17,7 @@ namespace quda
 
   template <typename Arg> class NdegTwistedClover : public Dslash<nDegTwistedClover, Arg>
     {
-      using Dslash = Dslash<nDegTwistedClover, Arg>;
+      using Dslash = quda::Dslash<nDegTwistedClover, Arg>;
       using Dslash::arg;
       using Dslash::halo;
       using Dslash::in;
@@ -33,6 +33,10 @@ namespace quda
         Dslash(arg, out, in, halo)
       {
         TunableKernel3D::resizeStep(2, 1);
+#ifdef QUDA_TARGET_CPU
+        // the flavor exchange through shared memory needs both flavors in one block
+        errorQuda("Non-degenerate twisted-clover operator is not supported on the CPU target");
+#endif
       }
 
       void apply(const qudaStream_t &stream)
@@ -16,7 +16,7 @@ namespace quda
 {
   template <typename Arg> class NdegTwistedCloverPreconditioned : public Dslash<nDegTwistedCloverPreconditioned, Arg>
     {
-      using Dslash = Dslash<nDegTwistedCloverPreconditioned, Arg>;
+      using Dslash = quda::Dslash<nDegTwistedCloverPreconditioned, Arg>;
       using Dslash::arg;
       using Dslash::halo;
       using Dslash::in;
@@ -32,6 +32,10 @@ namespace quda
         Dslash(arg, out, in, halo)
       {
         TunableKernel3D::resizeStep(2, 1); // this will force flavor to be contained in the block
+#ifdef QUDA_TARGET_CPU
+        // the flavor exchange through shared memory needs both flavors in one block
+        errorQuda("Preconditioned non-degenerate twisted-clover operator is not supported on the CPU target");
+#endif
       }
       
       void apply(const qudaStream_t &stream)
@@ -24,7 +24,7 @@ namespace quda
 
   template <typename Arg> class NdegTwistedMassPreconditioned : public Dslash<nDegTwistedMassPreconditioned, Arg>
   {
-    using Dslash = Dslash<nDegTwistedMassPreconditioned, Arg>;
+    using Dslash = quda::Dslash<nDegTwistedMassPreconditioned, Arg>;
     using Dslash::arg;
     using Dslash::halo;
     using Dslash::in;
@@ -42,6 +42,10 @@ namespace quda
       Dslash(arg, out, in, halo), shared(arg.asymmetric || !arg.dagger)
     {
       if (shared) TunableKernel3D::resizeStep(2, 1); // this will force flavor to be contained in the block
+#ifdef QUDA_TARGET_CPU
+      // the flavor exchange through shared memory needs both flavors in one block
+      if (shared) errorQuda("Preconditioned non-degenerate twisted-mass operator is not supported on the CPU target");
+#endif
     }
 
     void apply(const qudaStream_t &stream)
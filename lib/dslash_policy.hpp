@@ -1753,6 +1753,30 @@ namespace quda
     policies[static_cast<std::size_t>(p)] = QudaDslashPolicy::QUDA_DSLASH_POLICY_DISABLED;
   }
 
+  /**
+     @brief Whether a given policy can be run when kernels execute on
+     the host.  Each host "thread block" is a single thread, so the
+     policies that pack in the first few blocks of the interior
+     kernel, or that rely on the per-direction block assignment of
+     the zero-copy packer, are unavailable.  The remaining policies
+     pack with a separate kernel and so retain the interior/exterior
+     split.
+     @param[in] policy The policy we are querying
+     @return Whether the policy is supported on the host
+   */
+  constexpr bool host_policy(QudaDslashPolicy policy)
+  {
+    switch (policy) {
+    case QudaDslashPolicy::QUDA_DSLASH:
+    case QudaDslashPolicy::QUDA_FUSED_DSLASH:
+    case QudaDslashPolicy::QUDA_GDR_DSLASH:
+    case QudaDslashPolicy::QUDA_FUSED_GDR_DSLASH:
+    case QudaDslashPolicy::QUDA_GDR_RECV_DSLASH:
+    case QudaDslashPolicy::QUDA_FUSED_GDR_RECV_DSLASH: return true;
+    default: return false;
+    }
+  }
+
   template <typename Dslash> class DslashPolicyTune : public Tunable
   {
     Dslash &dslash;
@@ -1822,6 +1846,12 @@ namespace quda
 #endif
             }
 
+#ifdef QUDA_TARGET_CPU
+            if (!host_policy(dslash_policy))
+              errorQuda("Cannot select policy %d on the CPU target since it requires zero-copy or fused packing",
+                        static_cast<int>(dslash_policy));
+#endif
+
             enable_policy(static_cast<QudaDslashPolicy>(policy_));
             first_active_policy = policy_ < first_active_policy ? policy_ : first_active_policy;
             if (policy_list.peek() == ',') policy_list.ignore();
@@ -1841,6 +1871,7 @@ namespace quda
             enable_policy(QudaDslashPolicy::QUDA_FUSED_GDR_RECV_DSLASH);
           }
 
+#ifndef QUDA_TARGET_CPU
           if (comm_zero_copy_enabled()) {
             enable_policy(QudaDslashPolicy::QUDA_ZERO_COPY_PACK_DSLASH);
             enable_policy(QudaDslashPolicy::QUDA_FUSED_ZERO_COPY_PACK_DSLASH);
@@ -1868,6 +1899,7 @@ namespace quda
             enable_policy(QudaDslashPolicy::QUDA_SHMEM_PACKINTRA_DSLASH);
             enable_policy(QudaDslashPolicy::QUDA_SHMEM_PACKFULL_DSLASH);
           }
+#endif
         }
         // construct string specifying which policies have been enabled
         for (int i = 0; i < (int)QudaDslashPolicy::QUDA_DSLASH_POLICY_DISABLED; i++) {
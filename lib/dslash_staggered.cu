@@ -19,7 +19,7 @@ namespace quda
 
   template <typename Arg> class Staggered : public Dslash<staggered, Arg>
   {
-    using Dslash = Dslash<staggered, Arg>;
+    using Dslash = quda::Dslash<staggered, Arg>;
     using Dslash::arg;
 
   public:
@@ -16,7 +16,7 @@ namespace quda
 
   template <typename Arg> class TwistedCloverPreconditioned : public Dslash<twistedCloverPreconditioned, Arg>
   {
-    using Dslash = Dslash<twistedCloverPreconditioned, Arg>;
+    using Dslash = quda::Dslash<twistedCloverPreconditioned, Arg>;
     using Dslash::arg;
     using Dslash::halo;
     using Dslash::in;
@@ -17,7 +17,7 @@ namespace quda
 
   template <typename Arg> class Wilson : public Dslash<wilson, Arg>
   {
-    using Dslash = Dslash<wilson, Arg>;
+    using Dslash = quda::Dslash<wilson, Arg>;
 
   public:
     Wilson(Arg &arg, cvector_ref<ColorSpinorField> &out, cvector_ref<const ColorSpinorField> &in,
@@ -16,7 +16,7 @@ namespace quda
   template <typename Arg>
   class WilsonCloverHasenbuschTwistPCNoClovInv : public Dslash<cloverHasenbuschPreconditioned, Arg>
   {
-    using Dslash = Dslash<cloverHasenbuschPreconditioned, Arg>;
+    using Dslash = quda::Dslash<cloverHasenbuschPreconditioned, Arg>;
     using Dslash::arg;
     using Dslash::halo;
     using Dslash::in;
@@ -160,7 +160,7 @@ namespace quda
   template <typename Arg>
   class WilsonCloverHasenbuschTwistPCClovInv : public Dslash<cloverHasenbuschPreconditioned, Arg>
   {
-    using Dslash = Dslash<cloverHasenbuschPreconditioned, Arg>;
+    using Dslash = quda::Dslash<cloverHasenbuschPreconditioned, Arg>;
     using Dslash::arg;
     using Dslash::halo;
     using Dslash::in;
@@ -0,0 +1,325 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+#include <quda_internal.h>
+#include <eigensolve_quda.h>
+#include <color_spinor_field.h>
+#include <blas_quda.h>
+#include <util_quda.h>
+#include <eigen_helper.h>
+
+namespace quda
+{
+  // Krylov-Schur constructor: the Hessenberg, Q and R storage is shared with IRAM
+  KrylovSchur::KrylovSchur(const DiracMatrix &mat, QudaEigParam *eig_param) : IRAM(mat, eig_param) { }
+
+  // Schur form member functions
+  //---------------------------------------------------------------------------
+  void KrylovSchur::schurDecomposition()
+  {
+    getProfile().TPSTART(QUDA_PROFILE_EIGENQR);
+    // After the first restart the Rayleigh quotient is no longer upper
+    // Hessenberg (the row below the kept block is full), so we use the
+    // general Schur decomposition
+    MatrixXcd H = MatrixXcd::Zero(n_kr, n_kr);
+    for (int i = 0; i < n_kr; i++)
+      for (int j = 0; j < n_kr; j++) H(i, j) = upperHess[i][j];
+
+    Eigen::ComplexSchur<MatrixXcd> schur(H);
+
+    for (int i = 0; i < n_kr; i++) {
+      for (int j = 0; j < n_kr; j++) {
+        upperHess[i][j] = i <= j ? schur.matrixT()(i, j) : 0.0;
+        Qmat[i][j] = schur.matrixU()(i, j);
+      }
+    }
+    getProfile().TPSTOP(QUDA_PROFILE_EIGENQR);
+  }
+
+  void KrylovSchur::schurSwap(int k)
+  {
+    auto &T = upperHess;
+    auto &U = Qmat;
+
+    // Givens rotation G = [c s; -conj(s) c] such that G [f; g] = [r; 0]
+    // where f = T_{k,k+1}, g = T_{k+1,k+1} - T_{k,k} (cf. LAPACK ztrexc)
+    Complex f = T[k][k + 1];
+    Complex g = T[k + 1][k + 1] - T[k][k];
+    double f_abs = abs(f);
+    double g_abs = abs(g);
+    if (g_abs == 0.0) return; // degenerate eigenvalues, nothing to swap
+
+    double c;
+    Complex s;
+    if (f_abs == 0.0) {
+      c = 0.0;
+      s = conj(g) / g_abs;
+    } else {
+      double norm = std::hypot(f_abs, g_abs);
+      c = f_abs / norm;
+      s = (f / f_abs) * conj(g) / norm;
+    }
+
+    // Apply G from the left to rows k, k+1
+    for (int j = k + 2; j < n_kr; j++) {
+      Complex x = T[k][j];
+      Complex y = T[k + 1][j];
+      T[k][j] = c * x + s * y;
+      T[k + 1][j] = c * y - conj(s) * x;
+    }
+
+    // Apply G^dag from the right to columns k, k+1 of T and U
+    for (int i = 0; i < k; i++) {
+      Complex x = T[i][k];
+      Complex y = T[i][k + 1];
+      T[i][k] = c * x + conj(s) * y;
+      T[i][k + 1] = c * y - s * x;
+    }
+
+    for (int i = 0; i < n_kr; i++) {
+      Complex x = U[i][k];
+      Complex y = U[i][k + 1];
+      U[i][k] = c * x + conj(s) * y;
+      U[i][k + 1] = c * y - s * x;
+    }
+
+    std::swap(T[k][k], T[k + 1][k + 1]);
+  }
+
+  void KrylovSchur::schurReorder(const QudaEigSpectrumType spec_type)
+  {
+    getProfile().TPSTART(QUDA_PROFILE_HOST_COMPUTE);
+
+    // Returns true if a is more wanted than b
+    auto wanted = [spec_type](const Complex &a, const Complex &b) -> bool {
+      switch (spec_type) {
+      case QUDA_SPECTRUM_LM_EIG: return abs(a) > abs(b);
+      case QUDA_SPECTRUM_SM_EIG: return abs(a) < abs(b);
+      case QUDA_SPECTRUM_LR_EIG: return a.real() > b.real();
+      case QUDA_SPECTRUM_SR_EIG: return a.real() < b.real();
+      case QUDA_SPECTRUM_LI_EIG: return a.imag() > b.imag();
+      case QUDA_SPECTRUM_SI_EIG: return a.imag() < b.imag();
+      default: errorQuda("Undefined spectrum type %d given", spec_type);
+      }
+      return false;
+    };
+
+    // Selection sort on the diagonal of T: the most wanted remaining
+    // Ritz value is bubbled up to position p with adjacent swaps
+    for (int p = 0; p < n_kr - 1; p++) {
+      int best = p;
+      for (int j = p + 1; j < n_kr; j++)
+        if (wanted(upperHess[j][j], upperHess[best][best])) best = j;
+      for (int j = best - 1; j >= p; j--) schurSwap(j);
+    }
+
+    getProfile().TPSTOP(QUDA_PROFILE_HOST_COMPUTE);
+  }
+
+  void KrylovSchur::triangularEigenvector(std::vector<Complex> &y, int i)
+  {
+    const auto &T = upperHess;
+    const double small = std::numeric_limits<double>::epsilon() * std::max(abs(T[i][i]), 1.0);
+
+    y.assign(n_kr, 0.0);
+    y[i] = 1.0;
+    for (int j = i - 1; j >= 0; j--) {
+      Complex sum = 0.0;
+      for (int l = j + 1; l <= i; l++) sum += T[j][l] * y[l];
+      Complex diff = T[j][j] - T[i][i];
+      // perturb (near) degenerate eigenvalues as LAPACK ztrevc does
+      if (abs(diff) < small) diff = small;
+      y[j] = -sum / diff;
+    }
+
+    double norm = 0.0;
+    for (int j = 0; j <= i; j++) norm += std::norm(y[j]);
+    norm = sqrt(norm);
+    for (int j = 0; j <= i; j++) y[j] /= norm;
+  }
+
+  void KrylovSchur::ritzFromSchur(std::vector<Complex> &evals, const double beta, int n)
+  {
+    getProfile().TPSTART(QUDA_PROFILE_EIGENEV);
+    for (int i = 0; i < n_kr; i++) evals[i] = upperHess[i][i];
+
+    // The residual of the Ritz pair (T_ii, U y_i) is beta * |e_{n_kr}^dag U y_i|
+    std::vector<Complex> y(n_kr);
+    for (int i = 0; i < n; i++) {
+      triangularEigenvector(y, i);
+      Complex last = 0.0;
+      for (int j = 0; j <= i; j++) last += Qmat[n_kr - 1][j] * y[j];
+      residua[i] = beta * abs(last);
+    }
+    getProfile().TPSTOP(QUDA_PROFILE_EIGENEV);
+  }
+
+  void KrylovSchur::ritzVectorsFromSchur(const double beta)
+  {
+    getProfile().TPSTART(QUDA_PROFILE_EIGENEV);
+    MatrixXcd U = MatrixXcd::Zero(n_kr, n_kr);
+    MatrixXcd Y = MatrixXcd::Zero(n_kr, n_kr);
+    std::vector<Complex> y(n_kr);
+    for (int i = 0; i < n_kr; i++) {
+      triangularEigenvector(y, i);
+      for (int j = 0; j < n_kr; j++) {
+        U(j, i) = Qmat[j][i];
+        Y(j, i) = y[j];
+      }
+    }
+
+    MatrixXcd Q = U * Y;
+    for (int i = 0; i < n_kr; i++) {
+      residua[i] = beta * abs(Q(n_kr - 1, i));
+      for (int j = 0; j < n_kr; j++) Qmat[i][j] = Q(i, j);
+    }
+    getProfile().TPSTOP(QUDA_PROFILE_EIGENEV);
+  }
+
+  void KrylovSchur::operator()(std::vector<ColorSpinorField> &kSpace, std::vector<Complex> &evals)
+  {
+    // Override any user input for block size.
+    block_size = 1;
+
+    // Pre-launch checks and preparation
+    //---------------------------------------------------------------------------
+    queryPrec(kSpace[0].Precision());
+    // Check to see if we are loading eigenvectors
+    if (strcmp(eig_param->vec_infile, "") != 0) {
+      logQuda(QUDA_VERBOSE, "Loading evecs from file name %s\n", eig_param->vec_infile);
+      loadFromFile(kSpace, evals);
+      return;
+    }
+
+    // Check for an initial guess. If none present, populate with rands, then
+    // orthonormalise
+    prepareInitialGuess(kSpace);
+
+    // Increase the size of kSpace passed to the function, will be trimmed to
+    // original size before exit.
+    prepareKrylovSpace(kSpace, evals);
+
+    // Apply a matrix op to the residual to place it in the
+    // range of the operator
+    mat(r[0], kSpace[0]);
+
+    // Convergence criteria
+    double epsilon = setEpsilon(kSpace[0].Precision());
+    double epsilon23 = pow(epsilon, 2.0 / 3.0);
+    double beta = 0.0;
+
+    // The row coupling the first new Arnoldi vector to the kept Schur vectors
+    std::vector<Complex> keep_row;
+
+    // Print Eigensolver params
+    printEigensolverSetup();
+    //---------------------------------------------------------------------------
+
+    // Begin Krylov-Schur Eigensolver computation
+    //---------------------------------------------------------------------------
+    getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+
+    // Loop over restart iterations.
+    num_keep = 0;
+    while (restart_iter < max_restarts && !converged) {
+      for (int step = num_keep; step < n_kr; step++) arnoldiStep(kSpace, r, beta, step);
+      iter += n_kr - num_keep;
+
+      // After a restart, the first new vector couples to every kept
+      // Schur vector through the residual: H_{k,i} = beta * U_{n_kr-1,i}
+      for (int i = 0; i < num_keep; i++) upperHess[num_keep][i] = keep_row[i];
+
+      // Ritz values and their errors are updated from the Schur form,
+      // with the wanted Ritz values leading
+      getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+      schurDecomposition();
+      schurReorder(eig_param->spectrum);
+      ritzFromSchur(evals, beta, n_ev);
+      getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+
+      // Convergence test
+      iter_converged = 0;
+      for (int i = 0; i < n_ev; i++) {
+        double rtemp = std::max(epsilon23, abs(evals[i]));
+        if (residua[i] < tol * rtemp) {
+          iter_converged++;
+          logQuda(QUDA_DEBUG_VERBOSE, "residuum[%d] = %e, condition = %e\n", i, residua[i], tol * abs(evals[i]));
+        } else {
+          // Unlikely to find new converged eigenvalues
+          break;
+        }
+      }
+      num_converged = iter_converged;
+
+      logQuda(QUDA_VERBOSE, "%04d converged eigenvalues at iter %d\n", num_converged, restart_iter);
+
+      if (num_converged >= n_conv) {
+
+        getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+        ritzVectorsFromSchur(beta);
+        // Rotate the Krylov space
+        rotateBasis(kSpace, n_kr);
+        // Reorder the Krylov space and Ritz values
+        reorder(kSpace, evals, eig_param->spectrum);
+
+        // Compute the eigen/singular values.
+        getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+        computeEvals(kSpace, evals);
+        if (compute_svd) computeSVD(kSpace, evals);
+        converged = true;
+
+      } else {
+
+        // Keep the converged vectors plus half of the remaining space,
+        // but never fewer than the search space
+        num_keep = std::min(num_converged + (n_kr - num_converged) / 2, n_kr - 12);
+        num_keep = std::min(std::max(num_keep, n_ev), n_kr - 1);
+
+        // Truncate the Krylov-Schur factorization to the leading
+        // num_keep Schur vectors: no shifts need to be applied
+        getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+        rotateBasis(kSpace, num_keep);
+        getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+
+        keep_row.resize(num_keep);
+        for (int i = 0; i < num_keep; i++) keep_row[i] = beta * Qmat[n_kr - 1][i];
+
+        // The new Rayleigh quotient starts from the leading triangular block of T
+        for (int i = 0; i < n_kr; i++)
+          for (int j = 0; j < n_kr; j++)
+            if (i >= num_keep || j >= num_keep) upperHess[i][j] = 0.0;
+
+        if (beta < epsilon) { errorQuda("Krylov-Schur has encountered an invariant subspace..."); }
+      }
+      restart_iter++;
+    }
+
+    getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+
+    // Post computation report
+    //---------------------------------------------------------------------------
+    if (!converged) {
+      if (eig_param->require_convergence) {
+        errorQuda("Krylov-Schur failed to compute the requested %d vectors with a %d search space and %d Krylov space "
+                  "in %d restart steps. Exiting.",
+                  n_conv, n_ev, n_kr, max_restarts);
+      } else {
+        warningQuda("Krylov-Schur failed to compute the requested %d vectors with a %d search space and %d Krylov "
+                    "space in %d restart steps. Continuing with current arnoldi factorisation.",
+                    n_conv, n_ev, n_kr, max_restarts);
+      }
+    } else {
+      logQuda(QUDA_SUMMARIZE,
+              "Krylov-Schur computed the requested %d vectors with a %d search space and %d Krylov space in %d "
+              "restart steps and %d OP*x operations.\n",
+              n_conv, n_ev, n_kr, restart_iter, iter);
+    }
+
+    // Local clean-up
+    cleanUpEigensolver(kSpace, evals);
+  }
+
+} // namespace quda
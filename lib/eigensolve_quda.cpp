@@ -100,6 +100,10 @@ namespace quda
       eig_solver = new IRAM(mat, eig_param);
       break;
     case QUDA_EIG_BLK_IR_ARNOLDI: errorQuda("Block IR Arnoldi not implemented"); break;
+    case QUDA_EIG_KRYLOV_SCHUR:
+      logQuda(QUDA_VERBOSE, "Creating Krylov-Schur eigensolver\n");
+      eig_solver = new KrylovSchur(mat, eig_param);
+      break;
     case QUDA_EIG_TR_LANCZOS:
       logQuda(QUDA_VERBOSE, "Creating TR Lanczos eigensolver\n");
       eig_solver = new TRLM(mat, eig_param);
@@ -176,6 +180,7 @@ namespace quda
         eig_param->a_max = estimateChebyOpMax(kSpace[block_size + 2], kSpace[block_size + 1]);
         logQuda(QUDA_SUMMARIZE, "Chebyshev maximum estimate: %e.\n", eig_param->a_max);
       }
+      if (eig_param->poly_acc_auto) estimateChebyOpWindow(kSpace);
       if (eig_param->a_min >= eig_param->a_max)
         errorQuda("Invalid a_min = %e a_max = %e combination", eig_param->a_min, eig_param->a_max);
     }
@@ -343,6 +348,129 @@ namespace quda
     return result * 1.10;
   }
 
+  std::vector<double> EigenSolver::computeKPMMoments(ColorSpinorField &t0, ColorSpinorField &t1, ColorSpinorField &t2,
+                                                     double lower, double upper, int n_moments, int n_vec)
+  {
+    // map the spectrum onto [-1,1]
+    const double c = (upper + lower) / 2.0;
+    const double e = (upper - lower) / 2.0;
+
+    std::vector<double> mu(n_moments, 0.0);
+    RNG rng(t0, 2345);
+
+    for (int r = 0; r < n_vec; r++) {
+      spinorNoise(t0, rng, QUDA_NOISE_GAUSS);
+      blas::ax(1.0 / sqrt(blas::norm2(t0)), t0);
+
+      // T_1(A') v = (A - c) v / e
+      mat(t1, t0);
+      blas::axpby(-c / e, t0, 1.0 / e, t1);
+      const double mu1 = blas::reDotProduct(t0, t1);
+      mu[0] += 1.0;
+      if (n_moments > 1) mu[1] += mu1;
+
+      // t0 holds T_{k-1}(A') v, t1 holds T_k(A') v
+      for (int k = 1; 2 * k < n_moments; k++) {
+        // T_{k+1}(A') v = 2 A' T_k(A') v - T_{k-1}(A') v
+        mat(t2, t1);
+        blas::axpbypczw(-1.0, t0, -2.0 * c / e, t1, 2.0 / e, t2, t0);
+        std::swap(t0, t1);
+
+        mu[2 * k] += 2.0 * blas::norm2(t0) - 1.0;
+        if (2 * k + 1 < n_moments) mu[2 * k + 1] += 2.0 * blas::reDotProduct(t0, t1) - mu1;
+      }
+    }
+
+    for (auto &m : mu) m /= n_vec;
+    return mu;
+  }
+
+  /**
+     @brief Fraction of the spectrum below x in [-1,1] from Jackson-damped
+     Chebyshev moments, i.e., the integral of the kernel polynomial
+     density of states from -1 to x
+     @param[in] mu Damped moments
+     @param[in] x Point at which to evaluate the cumulative density
+  */
+  static double kpmCumulativeDensity(const std::vector<double> &mu, double x)
+  {
+    const double theta = acos(std::max(-1.0, std::min(1.0, x)));
+    double sum = mu[0] * (M_PI - theta);
+    for (auto k = 1u; k < mu.size(); k++) sum -= 2.0 * mu[k] * sin(k * theta) / k;
+    return sum / M_PI;
+  }
+
+  void EigenSolver::estimateChebyOpWindow(std::vector<ColorSpinorField> &kSpace)
+  {
+    if (eig_param->eig_type == QUDA_EIG_TR_LANCZOS_3D) {
+      warningQuda("Automatic Chebyshev parameters not supported for the 3-d eigensolver");
+      return;
+    }
+    if (eig_param->spectrum != QUDA_SPECTRUM_SR_EIG && eig_param->spectrum != QUDA_SPECTRUM_SM_EIG) {
+      warningQuda("Automatic Chebyshev parameters only supported for the SR and SM spectrum");
+      return;
+    }
+    if (kSpace.size() < static_cast<size_t>(block_size + 3))
+      errorQuda("Krylov space size %lu too small for the spectral density estimate", kSpace.size());
+    if (eig_param->kpm_n_moments < 2 || eig_param->kpm_n_vec < 1)
+      errorQuda("Invalid spectral density parameters n_moments = %d n_vec = %d", eig_param->kpm_n_moments,
+                eig_param->kpm_n_vec);
+
+    // a normal operator is positive semi-definite, otherwise use the spectral radius
+    const double upper = eig_param->a_max;
+    const double lower = eig_param->use_norm_op ? 0.0 : -upper;
+    const int n_moments = eig_param->kpm_n_moments;
+
+    auto mu = computeKPMMoments(kSpace[block_size], kSpace[block_size + 1], kSpace[block_size + 2], lower, upper,
+                                n_moments, eig_param->kpm_n_vec);
+
+    // Jackson kernel to damp the Gibbs oscillations
+    const double q = M_PI / (n_moments + 1);
+    for (int k = 0; k < n_moments; k++)
+      mu[k] *= ((n_moments - k + 1) * cos(q * k) + sin(q * k) / tan(q)) / (n_moments + 1);
+
+    const ColorSpinorField &v = kSpace[0];
+    const double n_dof = static_cast<double>(v.Volume()) * v.Nspin() * v.Ncolor() * comm_size();
+    auto count = [&](double lambda) {
+      return n_dof * kpmCumulativeDensity(mu, (lambda - (upper + lower) / 2.0) / ((upper - lower) / 2.0));
+    };
+
+    // invert the (monotone) eigenvalue count by bisection
+    auto eval_at_count = [&](double target) {
+      double lo = lower, hi = upper;
+      for (int i = 0; i < 64; i++) {
+        double mid = 0.5 * (lo + hi);
+        if (count(mid) < target)
+          lo = mid;
+        else
+          hi = mid;
+      }
+      return 0.5 * (lo + hi);
+    };
+
+    // amplify (n_ev + n_kr) / 2 eigenvalues so they fit in the Krylov space
+    const double a_min = eval_at_count(0.5 * (n_ev + n_kr));
+    const double lambda_conv = eval_at_count(n_conv);
+
+    // Smallest degree for which the Lanczos bound 1 / T_k(1 + 2 gamma) on
+    // the n_conv-th Ritz value falls below tol within k = n_kr steps, where
+    // the filtered gap satisfies acosh(1 + 2 gamma) = deg * acosh(t)
+    constexpr int max_poly_deg = 1000;
+    int poly_deg = max_poly_deg;
+    const double t = ((a_min + upper) / 2.0 - lambda_conv) / ((upper - a_min) / 2.0);
+    if (t > 1.0) poly_deg = std::min(max_poly_deg, static_cast<int>(ceil(acosh(1.0 / tol) / (n_kr * acosh(t)))));
+    poly_deg = std::max(poly_deg, 1);
+
+    logQuda(QUDA_SUMMARIZE, "Spectral density estimate (%d moments, %d vectors): lambda[%d] ~ %e\n", n_moments,
+            eig_param->kpm_n_vec, n_conv, lambda_conv);
+    logQuda(QUDA_SUMMARIZE, "Chebyshev parameters selected: a_min = %e (was %e), poly_deg = %d (was %d)\n", a_min,
+            eig_param->a_min, poly_deg, eig_param->poly_deg);
+
+    eig_param->a_min = a_min;
+    eig_param->poly_deg = poly_deg;
+    eig_param->kpm_eval_n_conv = lambda_conv;
+  }
+
   bool EigenSolver::orthoCheck(std::vector<ColorSpinorField> &vecs, int size)
   {
     bool orthed = true;
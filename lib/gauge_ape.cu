@@ -13,21 +13,24 @@ namespace quda {
     const Float alpha;
     const int dir_ignore;
     const int apeDim;
-    unsigned int minThreads() const { return in.LocalVolumeCB(); }
+    const lat_dim_t depth;
+    unsigned int minThreads() const { return smearRegionVolumeCB(in, depth); }
     unsigned int sharedBytesPerThread() const { return 4 * sizeof(int); } // for thread_array
 
   public:
     // (2,3/4): 2 for parity in the y thread dim, 3 or 4 corresponds to mapping direction to the z thread dim
-    GaugeAPE(GaugeField &out, const GaugeField &in, double alpha, int dir_ignore) :
+    GaugeAPE(GaugeField &out, const GaugeField &in, double alpha, int dir_ignore, const lat_dim_t &depth) :
       TunableKernel3D(in, 2, (dir_ignore == 4) ? 4 : 3),
       out(out),
       in(in),
       alpha(static_cast<Float>(alpha)),
       dir_ignore(dir_ignore),
-      apeDim((dir_ignore == 4) ? 4 : 3)
+      apeDim((dir_ignore == 4) ? 4 : 3),
+      depth(depth)
     {
       strcat(aux, ",dir_ignore=");
       i32toa(aux + strlen(aux), dir_ignore);
+      setSmearDepthString(aux, depth);
       strcat(aux, comm_dim_partitioned_string());
       apply(device::get_default_stream());
     }
@@ -35,10 +38,11 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      constexpr bool enable_host = true;
       if (apeDim == 3) {
-        launch<APE>(tp, stream, GaugeAPEArg<Float, nColor, recon, 3>(out, in, alpha, dir_ignore));
+        launch<APE, enable_host>(tp, stream, GaugeAPEArg<Float, nColor, recon, 3>(out, in, alpha, dir_ignore, depth));
       } else if (apeDim == 4) {
-        launch<APE>(tp, stream, GaugeAPEArg<Float, nColor, recon, 4>(out, in, alpha, dir_ignore));
+        launch<APE, enable_host>(tp, stream, GaugeAPEArg<Float, nColor, recon, 4>(out, in, alpha, dir_ignore, depth));
       }
     }
 
@@ -48,13 +52,13 @@ namespace quda {
     long long flops() const
     {
       auto mat_flops = in.Ncolor() * in.Ncolor() * (8ll * in.Ncolor() - 2ll);
-      return (2 + (apeDim - 1) * 4) * mat_flops * apeDim * in.LocalVolume();
+      return (2 + (apeDim - 1) * 4) * mat_flops * apeDim * 2ll * minThreads();
     }
 
     long long bytes() const // 6 links per dim, 1 in, 1 out.
     {
       return ((1 + (apeDim - 1) * 6) * in.Reconstruct() * in.Precision() +
-              out.Reconstruct() * out.Precision()) * apeDim * in.LocalVolume();
+              out.Reconstruct() * out.Precision()) * apeDim * 2ll * minThreads();
     }
 
   }; // GaugeAPE
@@ -70,9 +74,23 @@ namespace quda {
     copyExtendedGauge(in, out, QUDA_CUDA_FIELD_LOCATION);
     in.exchangeExtendedGhost(in.R(), false);
     getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
-    instantiate<GaugeAPE>(out, in, alpha, dir_ignore);
+    instantiate<GaugeAPE>(out, in, alpha, dir_ignore, lat_dim_t {});
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
     out.exchangeExtendedGhost(out.R(), false);
   }
 
+  void APEStep(GaugeField &out, const GaugeField &in, double alpha, int dir_ignore, const lat_dim_t &depth)
+  {
+    checkPrecision(out, in);
+    checkReconstruct(out, in);
+    checkNative(out, in);
+    checkLocation(out, in);
+
+    if (dir_ignore < 0 || dir_ignore > 3) { dir_ignore = 4; }
+
+    getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+    instantiate<GaugeAPE>(out, in, alpha, dir_ignore, depth);
+    getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+  }
+
 }
@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <gauge_field.h>
+#include <gauge_cache.h>
+
+namespace quda
+{
+
+  namespace gauge_cache
+  {
+
+    struct Entry {
+      Key key;
+      std::vector<GaugeField> fields;
+      std::vector<double> aux;
+      size_t bytes = 0;
+      bool device = true;
+    };
+
+    static std::list<Entry> entries; // most recently used at the front
+    static Stats stats;
+
+    static bool budget_init = false;
+    static size_t device_budget = 0;
+    static size_t host_budget = 0;
+
+    static size_t get_env_budget(const char *name)
+    {
+      char *env = getenv(name);
+      if (!env) return 0;
+      long size = atol(env);
+      if (size < 0) errorQuda("Invalid %s = %s", name, env);
+      return static_cast<size_t>(size) << 20;
+    }
+
+    static void init_budget()
+    {
+      if (budget_init) return;
+      device_budget = get_env_budget("QUDA_GAUGE_CACHE_SIZE");
+      host_budget = get_env_budget("QUDA_GAUGE_CACHE_HOST_SIZE");
+      budget_init = true;
+    }
+
+    bool enabled()
+    {
+      init_budget();
+      return device_budget > 0;
+    }
+
+    /**
+       @brief Return the memory in use by the cache at a given location
+    */
+    static size_t usage(bool device)
+    {
+      size_t bytes = 0;
+      for (auto &e : entries)
+        if (e.device == device) bytes += e.bytes;
+      return bytes;
+    }
+
+    /**
+       @brief Bring the cache within its budgets, first by spilling
+       the least-recently-used device entries to the host, and then by
+       evicting the least-recently-used host entries
+    */
+    static void trim()
+    {
+      size_t device_bytes = usage(true);
+      for (auto it = entries.rbegin(); it != entries.rend() && device_bytes > device_budget; it++) {
+        if (!it->device) continue;
+        device_bytes -= it->bytes;
+        if (it->bytes <= host_budget) {
+          for (auto &f : it->fields) {
+            GaugeFieldParam param(f);
+            param.location = QUDA_CPU_FIELD_LOCATION;
+            param.mem_type = QUDA_MEMORY_HOST;
+            param.create = QUDA_NULL_FIELD_CREATE;
+            GaugeField host(param);
+            host.copy(f);
+            f = std::move(host);
+          }
+          it->device = false;
+          stats.spills++;
+        } else {
+          it->fields.clear();
+          it->bytes = 0;
+          stats.evictions++;
+        }
+      }
+
+      size_t host_bytes = usage(false);
+      for (auto it = entries.rbegin(); it != entries.rend() && host_bytes > host_budget; it++) {
+        if (it->device || it->fields.size() == 0) continue;
+        host_bytes -= it->bytes;
+        it->fields.clear();
+        it->bytes = 0;
+        stats.evictions++;
+      }
+
+      entries.remove_if([](const Entry &e) { return e.fields.size() == 0; });
+    }
+
+    void set_budget(size_t device_bytes, size_t host_bytes)
+    {
+      device_budget = device_bytes;
+      host_budget = host_bytes;
+      budget_init = true;
+      trim();
+    }
+
+    uint64_t checksum(const GaugeField &u)
+    {
+      if (u.GhostExchange() == QUDA_GHOST_EXCHANGE_EXTENDED) errorQuda("Extended fields not supported");
+
+      if (u.Location() == QUDA_CPU_FIELD_LOCATION && u.Precision() >= QUDA_SINGLE_PRECISION
+          && (u.Order() == QUDA_QDP_GAUGE_ORDER || u.Order() == QUDA_MILC_GAUGE_ORDER))
+        return u.checksum();
+
+      // otherwise compute the checksum on a host copy
+      GaugeFieldParam param(u);
+      param.location = QUDA_CPU_FIELD_LOCATION;
+      param.mem_type = QUDA_MEMORY_HOST;
+      param.create = QUDA_NULL_FIELD_CREATE;
+      param.order = QUDA_QDP_GAUGE_ORDER;
+      param.reconstruct = QUDA_RECONSTRUCT_NO;
+      param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+      param.setPrecision(std::max(u.Precision(), QUDA_SINGLE_PRECISION));
+      GaugeField host(param);
+      host.copy(u);
+      return host.checksum();
+    }
+
+    bool lookup(const Key &key, const std::vector<GaugeField *> &out, std::vector<double> *aux)
+    {
+      if (!enabled()) return false;
+
+      auto it = std::find_if(entries.begin(), entries.end(), [&](const Entry &e) { return e.key == key; });
+      if (it == entries.end() || it->fields.size() != out.size()) {
+        stats.misses++;
+        return false;
+      }
+
+      for (auto i = 0u; i < out.size(); i++) {
+        out[i]->copy(it->fields[i]);
+        if (out[i]->GhostExchange() == QUDA_GHOST_EXCHANGE_EXTENDED)
+          out[i]->exchangeExtendedGhost(out[i]->R(), false);
+      }
+      if (aux) *aux = it->aux;
+
+      entries.splice(entries.begin(), entries, it);
+      stats.hits++;
+      logQuda(QUDA_DEBUG_VERBOSE, "Gauge cache hit for %s (checksum %lx, hash %lx)\n", key.kind.c_str(), key.checksum,
+              key.hash);
+      return true;
+    }
+
+    void insert(const Key &key, const std::vector<const GaugeField *> &in, const std::vector<double> &aux)
+    {
+      if (!enabled()) return;
+
+      entries.remove_if([&](const Entry &e) { return e.key == key; });
+
+      Entry entry;
+      entry.key = key;
+      entry.aux = aux;
+      for (auto &f : in) entry.bytes += f->Bytes();
+      if (entry.bytes > device_budget && entry.bytes > host_budget) return; // too big to cache
+
+      for (auto &f : in) {
+        GaugeFieldParam param(*f);
+        param.create = QUDA_NULL_FIELD_CREATE;
+        entry.fields.emplace_back(param);
+        entry.fields.back().copy(*f);
+      }
+      entry.device = entry.fields[0].Location() == QUDA_CUDA_FIELD_LOCATION;
+
+      entries.push_front(std::move(entry));
+      trim();
+    }
+
+    Stats get_stats() { return stats; }
+
+    void destroy()
+    {
+      if (entries.size() > 0)
+        logQuda(QUDA_VERBOSE, "Gauge cache: %lu hits, %lu misses, %lu spills, %lu evictions\n", stats.hits,
+                stats.misses, stats.spills, stats.evictions);
+      entries.clear();
+    }
+
+  } // namespace gauge_cache
+
+} // namespace quda
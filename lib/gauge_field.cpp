@@ -550,20 +550,23 @@ namespace quda {
       void *ghost_[2 * QUDA_MAX_DIM];
       for (auto i = 0; i < geometry; i++) ghost_[i] = ghost[i].data();
 
-      // get the links into contiguous buffers
+      // get the links into contiguous buffers, aggregating the
+      // backwards and forwards links into a single exchange
+      halo::Exchange halo;
       if (link_direction == QUDA_LINK_BACKWARDS || link_direction == QUDA_LINK_BIDIRECTIONAL) {
         extractGaugeGhost(*this, send, true);
-
-        // communicate between nodes
-        exchange(ghost_, send, QUDA_FORWARDS);
+        exchange(halo, ghost_, send, QUDA_FORWARDS);
       }
 
       // repeat if requested and links are bi-directional
       if (link_direction == QUDA_LINK_FORWARDS || link_direction == QUDA_LINK_BIDIRECTIONAL) {
         extractGaugeGhost(*this, send, true, nDim);
-        exchange(ghost_ + nDim, send + nDim, QUDA_FORWARDS);
+        exchange(halo, ghost_ + nDim, send + nDim, QUDA_FORWARDS);
       }
 
+      // communicate between nodes
+      halo.execute();
+
       for (int d = 0; d < geometry; d++) host_free(send[d]);
     }
   }
@@ -747,61 +750,64 @@ namespace quda {
       bufferIndex = 1 - bufferIndex;
       qudaDeviceSynchronize();
     } else {
-      void *send[QUDA_MAX_DIM];
-      void *recv[QUDA_MAX_DIM];
-      size_t bytes[QUDA_MAX_DIM];
-      // store both parities and directions in each
+      exchangeExtendedGhost({this}, R, no_comms_fill);
+    }
+  }
+
+  void GaugeField::exchangeExtendedGhost(const std::vector<GaugeField *> &u, const lat_dim_t &R, bool no_comms_fill)
+  {
+    if (u.size() == 0) return;
+    for (auto &ui : u) {
+      if (ui->Location() != u[0]->Location()) errorQuda("Mixed field locations not supported");
+    }
+
+    if (u[0]->Location() == QUDA_CUDA_FIELD_LOCATION) {
+      for (auto &ui : u) ui->exchangeExtendedGhost(R, no_comms_fill);
+      return;
+    }
+
+    const int nDim = u[0]->Ndim();
+    std::vector<std::array<void *, QUDA_MAX_DIM>> send(u.size());
+    std::vector<std::array<void *, QUDA_MAX_DIM>> recv(u.size());
+    std::vector<std::array<size_t, QUDA_MAX_DIM>> bytes(u.size());
+
+    // store both parities and directions in each
+    for (auto i = 0u; i < u.size(); i++) {
       for (int d = 0; d < nDim; d++) {
         if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d]))) continue;
-        bytes[d] = surface[d] * R[d] * geometry * nInternal * precision;
-        send[d] = safe_malloc(2 * bytes[d]);
-        recv[d] = safe_malloc(2 * bytes[d]);
+        bytes[i][d] = u[i]->surface[d] * R[d] * u[i]->geometry * u[i]->nInternal * u[i]->precision;
+        send[i][d] = safe_malloc(2 * bytes[i][d]);
+        recv[i][d] = safe_malloc(2 * bytes[i][d]);
       }
+    }
 
-      for (int d = 0; d < nDim; d++) {
-        if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d]))) continue;
+    // dimensions must be exchanged in turn since the corners of each
+    // dimension are filled by the exchanges of the preceding ones,
+    // but within each dimension all fields are exchanged at once
+    halo::Exchange halo;
+    for (int d = 0; d < nDim; d++) {
+      if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d]))) continue;
+
+      for (auto i = 0u; i < u.size(); i++) {
         // extract into a contiguous buffer
-        extractExtendedGaugeGhost(*this, d, R, send, true);
-
-        if (comm_dim_partitioned(d)) {
-          // do the exchange
-          MsgHandle *mh_recv_back;
-          MsgHandle *mh_recv_fwd;
-          MsgHandle *mh_send_fwd;
-          MsgHandle *mh_send_back;
-
-          mh_recv_back = comm_declare_receive_relative(recv[d], d, -1, bytes[d]);
-          mh_recv_fwd = comm_declare_receive_relative(((char *)recv[d]) + bytes[d], d, +1, bytes[d]);
-          mh_send_back = comm_declare_send_relative(send[d], d, -1, bytes[d]);
-          mh_send_fwd = comm_declare_send_relative(((char *)send[d]) + bytes[d], d, +1, bytes[d]);
-
-          comm_start(mh_recv_back);
-          comm_start(mh_recv_fwd);
-          comm_start(mh_send_fwd);
-          comm_start(mh_send_back);
-
-          comm_wait(mh_send_fwd);
-          comm_wait(mh_send_back);
-          comm_wait(mh_recv_back);
-          comm_wait(mh_recv_fwd);
-
-          comm_free(mh_send_fwd);
-          comm_free(mh_send_back);
-          comm_free(mh_recv_back);
-          comm_free(mh_recv_fwd);
-        } else {
-          memcpy(static_cast<char *>(recv[d]) + bytes[d], send[d], bytes[d]);
-          memcpy(recv[d], static_cast<char *>(send[d]) + bytes[d], bytes[d]);
-        }
+        extractExtendedGaugeGhost(*u[i], d, R, send[i].data(), true);
 
-        // inject back into the gauge field
-        extractExtendedGaugeGhost(*this, d, R, recv, false);
+        char *send_d = static_cast<char *>(send[i][d]);
+        char *recv_d = static_cast<char *>(recv[i][d]);
+        halo.add_bidirectional(d, send_d, send_d + bytes[i][d], recv_d, recv_d + bytes[i][d], bytes[i][d]);
       }
 
+      halo.execute();
+
+      // inject back into the gauge fields
+      for (auto i = 0u; i < u.size(); i++) extractExtendedGaugeGhost(*u[i], d, R, recv[i].data(), false);
+    }
+
+    for (auto i = 0u; i < u.size(); i++) {
       for (int d = 0; d < nDim; d++) {
         if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d]))) continue;
-        host_free(send[d]);
-        host_free(recv[d]);
+        host_free(send[i][d]);
+        host_free(recv[i][d]);
       }
     }
   }
@@ -815,11 +821,15 @@ namespace quda {
 
   void GaugeField::exchange(void **ghost_link, void **link_sendbuf, QudaDirection dir) const
   {
-    MsgHandle *mh_send[4];
-    MsgHandle *mh_recv[4];
-    size_t bytes[4];
+    halo::Exchange halo;
+    exchange(halo, ghost_link, link_sendbuf, dir);
+    halo.execute();
+  }
 
-    for (int i=0; i<nDimComms; i++) bytes[i] = 2*nFace*surfaceCB[i]*nInternal*precision;
+  void GaugeField::exchange(halo::Exchange &halo, void **ghost_link, void **link_sendbuf, QudaDirection dir) const
+  {
+    if (Location() != QUDA_CPU_FIELD_LOCATION) errorQuda("Not supported");
+    if (dir != QUDA_FORWARDS && dir != QUDA_BACKWARDS) errorQuda("Unsuported dir=%d", dir);
 
     // in general (standard ghost exchange) we always do the exchange
     // even if a dimension isn't partitioned.  However, this breaks
@@ -828,51 +838,10 @@ namespace quda {
     // should probably be cleaned up.
     bool no_comms_fill = (dir == QUDA_BACKWARDS) ? false : true;
 
-    void *send[4];
-    void *receive[4];
-    if (Location() == QUDA_CPU_FIELD_LOCATION) {
-      for (int i=0; i<nDimComms; i++) {
-	if (comm_dim_partitioned(i)) {
-	  send[i] = link_sendbuf[i];
-	  receive[i] = ghost_link[i];
-	} else {
-	  if (no_comms_fill) memcpy(ghost_link[i], link_sendbuf[i], bytes[i]);
-	}
-      }
-    } else {
-      errorQuda("Not supported");
-    }
-
-    for (int i=0; i<nDimComms; i++) {
-      if (!comm_dim_partitioned(i)) continue;
-      if (dir == QUDA_FORWARDS) {
-	mh_send[i] = comm_declare_send_relative(send[i], i, +1, bytes[i]);
-	mh_recv[i] = comm_declare_receive_relative(receive[i], i, -1, bytes[i]);
-      } else if (dir == QUDA_BACKWARDS) {
-	mh_send[i] = comm_declare_send_relative(send[i], i, -1, bytes[i]);
-	mh_recv[i] = comm_declare_receive_relative(receive[i], i, +1, bytes[i]);
-      } else {
-	errorQuda("Unsuported dir=%d", dir);
-      }
-
-    }
-
-    for (int i=0; i<nDimComms; i++) {
-      if (!comm_dim_partitioned(i)) continue;
-      comm_start(mh_send[i]);
-      comm_start(mh_recv[i]);
-    }
-
-    for (int i=0; i<nDimComms; i++) {
-      if (!comm_dim_partitioned(i)) continue;
-      comm_wait(mh_send[i]);
-      comm_wait(mh_recv[i]);
-    }
-
-    for (int i=0; i<nDimComms; i++) {
-      if (!comm_dim_partitioned(i)) continue;
-      comm_free(mh_send[i]);
-      comm_free(mh_recv[i]);
+    for (int i = 0; i < nDimComms; i++) {
+      if (!comm_dim_partitioned(i) && !no_comms_fill) continue;
+      size_t bytes = 2 * nFace * surfaceCB[i] * nInternal * precision;
+      halo.add(i, dir == QUDA_FORWARDS ? 1 : 0, link_sendbuf[i], ghost_link[i], bytes);
     }
   }
 
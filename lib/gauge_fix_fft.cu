@@ -7,6 +7,7 @@
 #include <gauge_tools.h>
 
 #include <FFT_Plans.h>
+#include <FFT_Plans_host.h>
 #include <instantiate.h>
 
 #include <tunable_nd.h>
@@ -22,13 +23,21 @@ namespace quda {
     complex<Float> *tmp0;
     complex<Float> *tmp1;
     int dir;
+    int n_batch;
     unsigned int minThreads() const { return data.Volume(); }
 
   public:
-    GaugeFixFFTRotate(GaugeField &data) :
+    GaugeFixFFTRotate(GaugeField &data, int n_batch) :
       TunableKernel1D(data),
       data(data),
-      dir(0) {}
+      dir(0),
+      n_batch(n_batch)
+    {
+      if (n_batch > 1) {
+        strcat(aux, ",n_batch=");
+        i32toa(aux + strlen(aux), n_batch);
+      }
+    }
 
     void setDirection(int dir_, complex<Float> *data_in, complex<Float> *data_out)
     {
@@ -39,16 +48,17 @@ namespace quda {
 
     void apply(const qudaStream_t &stream)
     {
+      constexpr bool enable_host = true;
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       switch (dir) {
-      case 0: launch<FFTrotate>(tp, stream, Arg<0>(data, tmp0, tmp1)); break;
-      case 1: launch<FFTrotate>(tp, stream, Arg<1>(data, tmp0, tmp1)); break;
+      case 0: launch<FFTrotate, enable_host>(tp, stream, Arg<0>(data, tmp0, tmp1, n_batch)); break;
+      case 1: launch<FFTrotate, enable_host>(tp, stream, Arg<1>(data, tmp0, tmp1, n_batch)); break;
       default: errorQuda("Error in GaugeFixFFTRotate option");
       }
     }
 
     long long flops() const { return 0; }
-    long long bytes() const { return 4 * sizeof(Float) * data.Volume(); }
+    long long bytes() const { return 4 * sizeof(Float) * data.Volume() * n_batch; }
   };
 
   template <typename Arg>
@@ -64,8 +74,9 @@ namespace quda {
 
     void apply(const qudaStream_t &stream)
     {
+      constexpr bool enable_host = true;
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<FixQualityFFT>(arg.result, tp, stream, arg);
+      launch<FixQualityFFT, enable_host>(arg.result, tp, stream, arg);
 
       arg.result[0] /= static_cast<double>(3 * Arg::gauge_dir * meta.Volume());
       arg.result[1] /= static_cast<double>(3 * meta.Volume());
@@ -118,15 +129,16 @@ namespace quda {
 
     void apply(const qudaStream_t &stream)
     {
+      constexpr bool enable_host = true;
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       switch (type) {
-      case KERNEL_SET_INVPSQ: launch<set_invpsq>(tp, stream, arg); break;
-      case KERNEL_NORMALIZE: launch<mult_norm_2d>(tp, stream, arg); break;
-      case KERNEL_GX: launch<GX>(tp, stream, arg); break;
+      case KERNEL_SET_INVPSQ: launch<set_invpsq, enable_host>(tp, stream, arg); break;
+      case KERNEL_NORMALIZE: launch<mult_norm_2d, enable_host>(tp, stream, arg); break;
+      case KERNEL_GX: launch<GX, enable_host>(tp, stream, arg); break;
 #ifdef GAUGEFIXING_DONT_USE_GX
-      case KERNEL_UEO: launch<U_EO_NEW>(tp, stream, arg); break;
+      case KERNEL_UEO: launch<U_EO_NEW, enable_host>(tp, stream, arg); break;
 #else
-      case KERNEL_UEO: launch<U_EO>(tp, stream, arg); break;
+      case KERNEL_UEO: launch<U_EO, enable_host>(tp, stream, arg); break;
 #endif //GAUGEFIXING_DONT_USE_GX
       default: errorQuda("Unexpected kernel type %d", type);
       }
@@ -154,7 +166,7 @@ namespace quda {
     {
       switch (type) {
       case KERNEL_SET_INVPSQ: return 2 * field.Volume();
-      case KERNEL_NORMALIZE: return 2 * field.Volume();
+      case KERNEL_NORMALIZE: return 2 * field.Volume() * arg.n_batch;
       case KERNEL_GX: return (arg.elems == 6 ? 208 : 166) * field.Volume();
 #ifdef GAUGEFIXING_DONT_USE_GX
       case KERNEL_UEO: return 2414 * field.Volume();
@@ -169,7 +181,7 @@ namespace quda {
     {
       switch (type) {
       case KERNEL_SET_INVPSQ: return sizeof(typename Arg::Float) * field.Volume();
-      case KERNEL_NORMALIZE: return 3 * sizeof(typename Arg::Float) * field.Volume();
+      case KERNEL_NORMALIZE: return (1 + 2 * arg.n_batch) * sizeof(typename Arg::Float) * field.Volume();
       case KERNEL_GX: return 4 * arg.elems * field.Precision() * field.Volume();
 #ifdef GAUGEFIXING_DONT_USE_GX
       case KERNEL_UEO: return field.Bytes() + (5 * 12 * sizeof(typename Arg::Float)) * field.Volume();
@@ -198,16 +210,40 @@ namespace quda {
       printfQuda("\tPrint convergence results at every %d steps\n", verbose_interval);
     }
     
+    // on the host all six components of Delta are transformed together in a single batch
+    const bool host = data.Location() == QUDA_CPU_FIELD_LOCATION;
+    const int n_batch = host ? 6 : 1;
+
     unsigned int delta_pad = data.X()[0] * data.X()[1] * data.X()[2] * data.X()[3];
     int4 size = make_int4(data.X()[0], data.X()[1], data.X()[2], data.X()[3]);
     FFTPlanHandle plan_xy;
     FFTPlanHandle plan_zt;
+    FFTHostPlanHandle host_plan_xy;
+    FFTHostPlanHandle host_plan_zt;
+
+    GaugeFixArg<Float, recon> arg(data, alpha0, n_batch);
+    if (host) {
+      SetPlanFFT2DMany(host_plan_zt, size, 0, data.Precision(), n_batch); // for space and time ZT
+      SetPlanFFT2DMany(host_plan_xy, size, 1, data.Precision(), n_batch); // with space only XY
+    } else {
+      SetPlanFFT2DMany(plan_zt, size, 0, data.Precision()); // for space and time ZT
+      SetPlanFFT2DMany(plan_xy, size, 1, data.Precision()); // with space only XY
+    }
 
-    GaugeFixArg<Float, recon> arg(data, alpha0);
-    SetPlanFFT2DMany(plan_zt, size, 0, data.Precision()); // for space and time ZT
-    SetPlanFFT2DMany(plan_xy, size, 1, data.Precision()); // with space only XY
-
-    GaugeFixFFTRotate<Float> GFRotate(data);
+    auto fft_xy = [&](complex<Float> *in, complex<Float> *out, int direction) {
+      if (host)
+        ApplyFFT(host_plan_xy, in, out, direction);
+      else
+        ApplyFFT(plan_xy, in, out, direction);
+    };
+    auto fft_zt = [&](complex<Float> *in, complex<Float> *out, int direction) {
+      if (host)
+        ApplyFFT(host_plan_zt, in, out, direction);
+      else
+        ApplyFFT(plan_zt, in, out, direction);
+    };
+
+    GaugeFixFFTRotate<Float> GFRotate(data, n_batch);
 
     GaugeFixerFFT<decltype(arg)> gfix(arg, data);
     gfix.set_type(KERNEL_SET_INVPSQ);
@@ -222,18 +258,19 @@ namespace quda {
     double diff = 0.0;
     int iter = 0;
     for (iter = 0; iter < Nsteps; iter++) {
-      for (int k = 0; k < 6; k++) {
+      for (int k = 0; k < 6; k += n_batch) {
         //------------------------------------------------------------------------
         // Set a pointer do the element k in lattice volume
         // each element is stored with stride lattice volume
         // it uses gx as temporary array!!!!!!
+        // on the host all elements are done at once
         //------------------------------------------------------------------------
         complex<Float> *_array = arg.delta + k * delta_pad;
         //////  2D FFT + 2D FFT
         //------------------------------------------------------------------------
         // Perform FFT on xy plane
         //------------------------------------------------------------------------
-        ApplyFFT(plan_xy, _array, arg.gx, FFT_FORWARD);
+        fft_xy(_array, arg.gx, FFT_FORWARD);
         //------------------------------------------------------------------------
         // Rotate hypercube, xyzt -> ztxy
         //------------------------------------------------------------------------
@@ -242,7 +279,7 @@ namespace quda {
         //------------------------------------------------------------------------
         // Perform FFT on zt plane
         //------------------------------------------------------------------------
-        ApplyFFT(plan_zt, _array, arg.gx, FFT_FORWARD);
+        fft_zt(_array, arg.gx, FFT_FORWARD);
         //------------------------------------------------------------------------
         // Normalize FFT and apply pmax^2/p^2
         //------------------------------------------------------------------------
@@ -251,7 +288,7 @@ namespace quda {
         //------------------------------------------------------------------------
         // Perform IFFT on zt plane
         //------------------------------------------------------------------------
-        ApplyFFT(plan_zt, arg.gx, _array, FFT_INVERSE);
+        fft_zt(arg.gx, _array, FFT_INVERSE);
         //------------------------------------------------------------------------
         // Rotate hypercube, ztxy -> xyzt
         //------------------------------------------------------------------------
@@ -260,7 +297,7 @@ namespace quda {
         //------------------------------------------------------------------------
         // Perform IFFT on xy plane
         //------------------------------------------------------------------------
-        ApplyFFT(plan_xy, arg.gx, _array, FFT_INVERSE);
+        fft_xy(arg.gx, _array, FFT_INVERSE);
       }
 
 #ifndef GAUGEFIXING_DONT_USE_GX
@@ -313,8 +350,8 @@ namespace quda {
     setUnitarizeLinksConstants(unitarize_eps, max_error,
                                reunit_allow_svd, reunit_svd_only,
                                svd_rel_error, svd_abs_error);
-    int *num_failures_h = static_cast<int*>(mapped_malloc(sizeof(int)));
-    int *num_failures_d = static_cast<int*>(get_mapped_device_pointer(num_failures_h));
+    int *num_failures_h = static_cast<int *>(host ? safe_malloc(sizeof(int)) : mapped_malloc(sizeof(int)));
+    int *num_failures_d = host ? num_failures_h : static_cast<int *>(get_mapped_device_pointer(num_failures_h));
 
     *num_failures_h = 0;
     unitarizeLinks(data, data, num_failures_d);
@@ -322,8 +359,13 @@ namespace quda {
     // end reunitarize
 
     arg.free();
-    FFTDestroyPlan(plan_zt);
-    FFTDestroyPlan(plan_xy);
+    if (host) {
+      FFTDestroyPlan(host_plan_zt);
+      FFTDestroyPlan(host_plan_xy);
+    } else {
+      FFTDestroyPlan(plan_zt);
+      FFTDestroyPlan(plan_xy);
+    }
     profileInternalGaugeFixFFT.TPSTOP(QUDA_PROFILE_COMPUTE);
 
     double secs = profileInternalGaugeFixFFT.Last(QUDA_PROFILE_COMPUTE);
@@ -333,10 +375,11 @@ namespace quda {
     double gflops = gfix.flops() + gfixquality.flops();
     double gbytes = gfix.bytes() + gfixquality.bytes();
     gfix.set_type(KERNEL_NORMALIZE);
-    double flop = gfix.flops() * recon / 2;
-    double byte = gfix.bytes() * recon / 2;
-    flop += (GFRotate.flops() + fftflop) * (recon / 2) * 2;
-    byte += GFRotate.bytes() * (recon / 2) * 4;     //includes FFT reads, assuming 1 read and 1 write per site
+    double n_fft = (recon / 2) / static_cast<double>(n_batch); // number of batched FFT sequences per step
+    double flop = gfix.flops() * n_fft;
+    double byte = gfix.bytes() * n_fft;
+    flop += (GFRotate.flops() + fftflop * n_batch) * n_fft * 2;
+    byte += GFRotate.bytes() * n_fft * 4;     //includes FFT reads, assuming 1 read and 1 write per site
 #ifndef GAUGEFIXING_DONT_USE_GX
     gfix.set_type(KERNEL_GX);
     flop += gfix.flops();
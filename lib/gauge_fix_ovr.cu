@@ -6,6 +6,7 @@
 #include <instantiate.h>
 #include <tunable_reduction.h>
 #include <tunable_nd.h>
+#include <timer.h>
 #include <kernels/gauge_fix_ovr.cuh>
 
 namespace quda {
@@ -30,7 +31,8 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<BorderPointsCompute>(tp, stream, BorderIdArg(u, borderpoints));
+      constexpr bool enable_host = true;
+      launch<BorderPointsCompute, enable_host>(tp, stream, BorderIdArg(u, borderpoints));
     }
 
     long long bytes() const { return 2 * nlinksfaces * sizeof(int); }
@@ -57,7 +59,10 @@ namespace quda {
   }
 
   /**
-   * @brief Tunable object for the gauge fixing kernel
+   * @brief Tunable object for the gauge fixing kernel.  On the host
+   * each point is updated by a single thread, with the interior points
+   * traversed in 4-d tiles to improve the reuse of the links shared
+   * between neighboring points.
    */
   template<typename Float, QudaReconstructType recon, int gauge_dir>
   class GaugeFix : TunableKernel2D {
@@ -67,19 +72,43 @@ namespace quda {
     int parity;
     unsigned long threads;
     bool halo;
+    lat_dim_t tile;
 
     virtual int blockStep() const { return 32; }
     virtual int blockMin() const { return 32; }
 
+    /**
+       @brief Whether the kernel executes on the host: either the
+       field is a host field, or the target is the CPU, where the
+       threads of a block cannot cooperate on a point
+    */
+    static bool host(const GaugeField &u)
+    {
+#ifdef QUDA_TARGET_CPU
+      return true;
+#else
+      return u.Location() == QUDA_CPU_FIELD_LOCATION;
+#endif
+    }
+
+    /**
+       @brief The number of threads that cooperate on each point: on
+       the device mu must be contained in the block, with types 0, 1,
+       2 having mu = 8 and 3, 4, 5 having mu = 4, while on the host
+       each point is updated by a single thread
+    */
+    int vectorLength(int type) const { return host(u) ? 1 : (type < 3 ? 8 : 4); }
+
     bool advanceAux(TuneParam &param) const
     {
+      // the host kernel has no atomic types to tune over
+      if (host(u)) return false;
       param.aux.x = (param.aux.x + 1) % 6;
       if (!device::shared_memory_atomic_supported()) { // 1, 4 use shared memory atomics
 	if(param.aux.x == 1 || param.aux.x == 4) param.aux.x++;
       }
-      // mu must be contained in the block, types 0, 1, 2 have mu = 8 and 3, 4, 5 have mu = 4
-      TunableKernel2D::resizeVector(param.aux.x < 3 ? 8 : 4);
-      TunableKernel2D::resizeStep(param.aux.x < 3 ? 8 : 4);
+      TunableKernel2D::resizeVector(vectorLength(param.aux.x));
+      TunableKernel2D::resizeStep(vectorLength(param.aux.x));
       TunableKernel2D::initTuneParam(param);
       return param.aux.x == 0 ? false : true;
     }
@@ -99,8 +128,8 @@ namespace quda {
     unsigned int minThreads() const { return threads; }
 
   public:
-    GaugeFix(GaugeField &u, double relax_boost, int *borderpoints[2], bool halo, int threads) :
-      TunableKernel2D(u, 8),
+    GaugeFix(GaugeField &u, double relax_boost, int *borderpoints[2], bool halo, int threads, int tile_extent) :
+      TunableKernel2D(u, host(u) ? 1 : 8),
       u(u),
       relax_boost(relax_boost),
       borderpoints{borderpoints[0], borderpoints[1]},
@@ -111,11 +140,26 @@ namespace quda {
         this->threads = 1;
         for (int dir = 0; dir < 4; dir++) {
           auto border = comm_dim_partitioned(dir) ? u.R()[dir] + 1 : 0;
-          this->threads *= u.X()[dir] - border * 2;
+          int X = u.X()[dir] - border * 2;
+          this->threads *= X;
+
+          // largest tile extent up to tile_extent that divides the region, which must be even in x
+          tile[dir] = X;
+          for (int t = std::min(tile_extent, X); t > 0; t--) {
+            if (X % t == 0 && (dir > 0 || t % 2 == 0)) {
+              tile[dir] = t;
+              break;
+            }
+          }
         }
         this->threads /= 2;
 
         if (this->threads == 0) errorQuda("Local volume is too small");
+        if (host(u)) {
+          std::string tile_str = ",tile=" + std::to_string(tile[0]) + "x" + std::to_string(tile[1]) + "x"
+            + std::to_string(tile[2]) + "x" + std::to_string(tile[3]);
+          strcat(aux, tile_str.c_str());
+        }
       } else {
         this->threads = threads;
       }
@@ -125,10 +169,17 @@ namespace quda {
     void setParity(const int par) { parity = par; }
 
     template <bool halo_, int type_> using Arg = GaugeFixArg<Float, recon, gauge_dir, halo_, type_>;
+    template <bool halo_> using SiteArg = GaugeFixSiteArg<Float, recon, gauge_dir, halo_>;
 
     void apply(const qudaStream_t &stream){
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      if (!halo) {
+      if (host(u)) {
+        constexpr bool enable_host = true;
+        if (!halo)
+          launch<computeFixSite, enable_host>(tp, stream, SiteArg<false>(u, relax_boost, parity, borderpoints, threads, tile));
+        else
+          launch<computeFixSite, enable_host>(tp, stream, SiteArg<true>(u, relax_boost, parity, borderpoints, threads, tile));
+      } else if (!halo) {
         switch (tp.aux.x) {
         case 0: launch<computeFix>(tp, stream, Arg<false, 0>(u, relax_boost, parity, borderpoints, threads)); break;
         case 1: launch<computeFix>(tp, stream, Arg<false, 1>(u, relax_boost, parity, borderpoints, threads)); break;
@@ -154,8 +205,8 @@ namespace quda {
     void initTuneParam(TuneParam &param) const
     {
       param.aux.x = 0;
-      TunableKernel2D::resizeVector(param.aux.x < 3 ? 8 : 4);
-      TunableKernel2D::resizeStep(param.aux.x < 3 ? 8 : 4);
+      TunableKernel2D::resizeVector(vectorLength(param.aux.x));
+      TunableKernel2D::resizeStep(vectorLength(param.aux.x));
       TunableKernel2D::initTuneParam(param);
     }
 
@@ -190,7 +241,8 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<FixQualityOVR>(arg.result, tp, stream, arg);
+      constexpr bool enable_host = true;
+      launch<FixQualityOVR, enable_host>(arg.result, tp, stream, arg);
 
       arg.result[0] /= static_cast<double>(3 * Arg::gauge_dir * 2 * arg.threads.x * comm_size());
       arg.result[1] /= static_cast<double>(3 * 2 * arg.threads.x * comm_size());
@@ -224,20 +276,22 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       auto tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<Packer>(tp, stream, GaugeFixPackArg<Float, recon, pack, top>(u, array, parity, dim));
+      constexpr bool enable_host = true;
+      launch<Packer, enable_host>(tp, stream, GaugeFixPackArg<Float, recon, pack, top>(u, array, parity, dim));
     }
   };
 
   template <typename Float, QudaReconstructType recon, int gauge_dir>
   void gaugeFixingOVR(GaugeField &data,const int Nsteps, const int verbose_interval,
                       const double relax_boost, const double tolerance,
-                      const int reunit_interval, const int stopWtheta)
+                      const int reunit_interval, const int stopWtheta, const int quality_interval, const int tile)
   {
     TimeProfile profileInternalGaugeFixOVR("InternalGaugeFixQudaOVR", false);
 
     profileInternalGaugeFixOVR.TPSTART(QUDA_PROFILE_COMPUTE);
     double flop = 0;
     double byte = 0;
+    const bool host = data.Location() == QUDA_CPU_FIELD_LOCATION;
 
     if (getVerbosity() >= QUDA_SUMMARIZE) {
       printfQuda("\tOverrelaxation boost parameter: %e\n", relax_boost);
@@ -246,6 +300,8 @@ namespace quda {
       printfQuda("\tMaximum number of iterations: %d\n", Nsteps);
       printfQuda("\tReunitarize at every %d steps\n", reunit_interval);
       printfQuda("\tPrint convergence results at every %d steps\n", verbose_interval);
+      printfQuda("\tCompute gauge fixing quality at every %d steps\n", quality_interval);
+      if (host) printfQuda("\tExecuting on the host with tile extent %d\n", tile);
     }
     
     const double unitarize_eps = 1e-14;
@@ -259,7 +315,7 @@ namespace quda {
                                svd_rel_error, svd_abs_error);
 
     int *num_failures_h = static_cast<int*>(mapped_malloc(sizeof(int)));
-    int *num_failures_d = static_cast<int*>(get_mapped_device_pointer(num_failures_h));
+    int *num_failures_d = host ? num_failures_h : static_cast<int *>(get_mapped_device_pointer(num_failures_h));
 
     GaugeFixQualityOVRArg<Float, recon, gauge_dir> argQ(data);
     GaugeFixQuality<decltype(argQ)> GaugeFixQuality(argQ, data);
@@ -286,10 +342,6 @@ namespace quda {
         if (!commDimPartitioned(d)) continue;
         offset[d] = data.LocalSurfaceCB(d) * recon;
         bytes[d] =  sizeof(Float) * offset[d];
-        send_d[d] = device_malloc(bytes[d]);
-        recv_d[d] = device_malloc(bytes[d]);
-        sendg_d[d] = device_malloc(bytes[d]);
-        recvg_d[d] = device_malloc(bytes[d]);
         hostbuffer_h[d] = (void*)pinned_malloc(4 * bytes[d]);
       }
       for (int d = 0; d < 4; d++) {
@@ -303,6 +355,14 @@ namespace quda {
         mh_send_back[d] = comm_declare_send_relative(sendg[d], d, -1, bytes[d]);
         mh_send_fwd[d]  = comm_declare_send_relative(send[d], d, +1, bytes[d]);
       }
+      for (int d = 0; d < 4; d++) {
+        if (!commDimPartitioned(d)) continue;
+        // on the host we pack and unpack directly from the message buffers
+        send_d[d] = host ? send[d] : device_malloc(bytes[d]);
+        recv_d[d] = host ? recv[d] : device_malloc(bytes[d]);
+        sendg_d[d] = host ? sendg[d] : device_malloc(bytes[d]);
+        recvg_d[d] = host ? recvg[d] : device_malloc(bytes[d]);
+      }
     }
 
     int *borderpoints[2];
@@ -310,8 +370,12 @@ namespace quda {
     int threads = 0;
     for (int dir = 0; dir < 4; dir++) if (comm_dim_partitioned(dir)) nlinksfaces += 2 * data.LocalSurfaceCB(dir);
     for (int i = 0; i < 2 && nlinksfaces; i++) { //even and odd ids
-      borderpoints[i] = static_cast<int*>(managed_malloc(nlinksfaces * sizeof(int)));
-      qudaMemset(borderpoints[i], 0, nlinksfaces * sizeof(int));
+      borderpoints[i] = static_cast<int *>(host ? safe_malloc(nlinksfaces * sizeof(int)) :
+                                                  managed_malloc(nlinksfaces * sizeof(int)));
+      if (host)
+        memset(borderpoints[i], 0, nlinksfaces * sizeof(int));
+      else
+        qudaMemset(borderpoints[i], 0, nlinksfaces * sizeof(int));
     }
     if (comm_partitioned()) PreCalculateLatticeIndices(data, threads, borderpoints);
 
@@ -326,10 +390,14 @@ namespace quda {
 
     if (*num_failures_h > 0) errorQuda("Error in the unitarization (%d errors)\n", *num_failures_h);
 
-    GaugeFix<Float, recon, gauge_dir> gfixIntPoints(data, relax_boost, borderpoints, false, -1);
-    GaugeFix<Float, recon, gauge_dir> gfixBorderPoints(data, relax_boost, borderpoints, true, threads);
+    GaugeFix<Float, recon, gauge_dir> gfixIntPoints(data, relax_boost, borderpoints, false, -1, tile);
+    GaugeFix<Float, recon, gauge_dir> gfixBorderPoints(data, relax_boost, borderpoints, true, threads, tile);
+
+    host_timer_t sweep_timer;
+    sweep_timer.start();
 
     int iter = 0;
+    bool measured = true; // whether the quality has been computed for the current field
     for (iter = 0; iter < Nsteps; iter++) {
       for (int p = 0; p < 2; p++) {
         if (comm_partitioned()) {
@@ -355,7 +423,7 @@ namespace quda {
           GaugeFixPacker<Float, recon, true, false>
             (data, reinterpret_cast<complex<Float>*>(sendg_d[d]), 1 - p, d, device::get_stream(4 + d));
         }
-        for (int d = 0; d < 4; d++) {
+        for (int d = 0; d < 4 && !host; d++) {
           if (!commDimPartitioned(d)) continue;
           qudaMemcpyAsync(send[d], send_d[d], bytes[d], qudaMemcpyDeviceToHost, device::get_stream(d));
           qudaMemcpyAsync(sendg[d], sendg_d[d], bytes[d], qudaMemcpyDeviceToHost, device::get_stream(4 + d));
@@ -377,12 +445,12 @@ namespace quda {
         for (int d = 0; d < 4; d++) {
           if (!commDimPartitioned(d)) continue;
           comm_wait(mh_recv_back[d]);
-          qudaMemcpyAsync(recv_d[d], recv[d], bytes[d], qudaMemcpyHostToDevice, device::get_stream(d));
+          if (!host) qudaMemcpyAsync(recv_d[d], recv[d], bytes[d], qudaMemcpyHostToDevice, device::get_stream(d));
         }
         for (int d = 0; d < 4; d++) {
           if (!commDimPartitioned(d)) continue;
           comm_wait(mh_recv_fwd[d]);
-          qudaMemcpyAsync(recvg_d[d], recvg[d], bytes[d], qudaMemcpyHostToDevice, device::get_stream(4 + d));
+          if (!host) qudaMemcpyAsync(recvg_d[d], recvg[d], bytes[d], qudaMemcpyHostToDevice, device::get_stream(4 + d));
         }
 
         for (int d = 0; d < 4; d++) {
@@ -404,6 +472,7 @@ namespace quda {
         }
         qudaStreamSynchronize(device::get_default_stream());
       }
+      measured = false;
 
       if ((iter % reunit_interval) == (reunit_interval - 1)) {
         *num_failures_h = 0;
@@ -412,13 +481,20 @@ namespace quda {
         flop += 4588.0 * data.Volume();
         byte += 2 * data.Bytes();
       }
+
+      // the quality is only computed every quality_interval steps, and when it is to be printed
+      bool print = (iter % verbose_interval) == (verbose_interval - 1) && getVerbosity() >= QUDA_SUMMARIZE;
+      if ((iter % quality_interval) != (quality_interval - 1) && !print) continue;
+
       GaugeFixQuality.apply(device::get_default_stream());
       flop += (double)GaugeFixQuality.flops();
       byte += (double)GaugeFixQuality.bytes();
+      measured = true;
 
+      // the change in the action is since the last time the quality was computed
       double action = argQ.getAction();
       double diff = abs(action0 - action);
-      if ((iter % verbose_interval) == (verbose_interval - 1) && getVerbosity() >= QUDA_SUMMARIZE)
+      if (print)
         printfQuda("Step: %d\tAction: %.16e\ttheta: %.16e\tDelta: %.16e\n", iter + 1, argQ.getAction(), argQ.getTheta(), diff);
       if (stopWtheta) {
         if (argQ.getTheta() < tolerance) break;
@@ -428,6 +504,10 @@ namespace quda {
       action0 = action;
     }
 
+    if (!host) qudaDeviceSynchronize();
+    sweep_timer.stop();
+    int sweeps = std::min(iter + 1, Nsteps);
+
     if ((iter % reunit_interval) != 0 )  {
       *num_failures_h = 0;
       unitarizeLinks(data, data, num_failures_d);
@@ -436,7 +516,7 @@ namespace quda {
       byte += 2 * data.Bytes();
     }
 
-    if ((iter % verbose_interval) != 0 ) {
+    if (!measured) {
       GaugeFixQuality.apply(device::get_default_stream());
       flop += (double)GaugeFixQuality.flops();
       byte += (double)GaugeFixQuality.bytes();
@@ -445,7 +525,12 @@ namespace quda {
       if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Step: %d\tAction: %.16e\ttheta: %.16e\tDelta: %.16e\n", iter + 1, argQ.getAction(), argQ.getTheta(), diff);
     }
 
-    for (int i = 0; i < 2 && nlinksfaces; i++) managed_free(borderpoints[i]);
+    for (int i = 0; i < 2 && nlinksfaces; i++) {
+      if (host)
+        host_free(borderpoints[i]);
+      else
+        managed_free(borderpoints[i]);
+    }
     host_free(num_failures_h);
 
     if ( comm_partitioned() ) {
@@ -456,10 +541,12 @@ namespace quda {
           comm_free(mh_send_back[d]);
           comm_free(mh_recv_back[d]);
           comm_free(mh_recv_fwd[d]);
-          device_free(send_d[d]);
-          device_free(recv_d[d]);
-          device_free(sendg_d[d]);
-          device_free(recvg_d[d]);
+          if (!host) {
+            device_free(send_d[d]);
+            device_free(recv_d[d]);
+            device_free(sendg_d[d]);
+            device_free(recvg_d[d]);
+          }
           host_free(hostbuffer_h[d]);
         }
       }
@@ -471,19 +558,23 @@ namespace quda {
       double gflops = (flop * 1e-9) / (secs);
       double gbytes = byte / (secs * 1e9);
       printfQuda("Time: %6.6f s, Gflop/s = %6.1f, GB/s = %6.1f\n", secs, gflops * comm_size(), gbytes * comm_size());
+      printfQuda("Sweeps: %d, sweeps/s = %6.2f\n", sweeps, sweeps / sweep_timer.last());
     }
   }
 
   template <typename Float, int nColor, QudaReconstructType recon> struct GaugeFixingOVR {
   GaugeFixingOVR(GaugeField& data, const int gauge_dir, const int Nsteps, const int verbose_interval,
-                 const double relax_boost, const double tolerance, const int reunit_interval, const int stopWtheta)
+                 const double relax_boost, const double tolerance, const int reunit_interval, const int stopWtheta,
+                 const int quality_interval, const int tile)
     {
       if (gauge_dir == 4) {
 	if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Starting Landau gauge fixing...\n");
-        gaugeFixingOVR<Float, recon, 4>(data, Nsteps, verbose_interval, relax_boost, tolerance, reunit_interval, stopWtheta);
+        gaugeFixingOVR<Float, recon, 4>(data, Nsteps, verbose_interval, relax_boost, tolerance, reunit_interval, stopWtheta,
+                                        quality_interval, tile);
       } else if (gauge_dir == 3) {
 	if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Starting Coulomb gauge fixing...\n");
-        gaugeFixingOVR<Float, recon, 3>(data, Nsteps, verbose_interval, relax_boost, tolerance, reunit_interval, stopWtheta);
+        gaugeFixingOVR<Float, recon, 3>(data, Nsteps, verbose_interval, relax_boost, tolerance, reunit_interval, stopWtheta,
+                                        quality_interval, tile);
       } else {
         errorQuda("Unexpected gauge_dir = %d", gauge_dir);
       }
@@ -500,12 +591,17 @@ namespace quda {
    * @param[in] tolerance, torelance value to stop the method, if this value is zero then the method stops when iteration reachs the maximum number of steps defined by Nsteps
    * @param[in] reunit_interval, reunitarize gauge field when iteration count is a multiple of this
    * @param[in] stopWtheta, 0 for MILC criterion and 1 to use the theta value
+   * @param[in] quality_interval, compute the gauge fixing quality and check for convergence when iteration count is a multiple of this
+   * @param[in] tile, extent of the 4-d tiles in which the interior points are updated on the host
    */
   void gaugeFixingOVR(GaugeField& data, const int gauge_dir, const int Nsteps, const int verbose_interval, const double relax_boost,
-                      const double tolerance, const int reunit_interval, const int stopWtheta)
+                      const double tolerance, const int reunit_interval, const int stopWtheta, const int quality_interval,
+                      const int tile)
   {
+    if (quality_interval <= 0) errorQuda("Invalid quality_interval = %d", quality_interval);
     getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
-    instantiate<GaugeFixingOVR>(data, gauge_dir, Nsteps, verbose_interval, relax_boost, tolerance, reunit_interval, stopWtheta);
+    instantiate<GaugeFixingOVR>(data, gauge_dir, Nsteps, verbose_interval, relax_boost, tolerance, reunit_interval,
+                                stopWtheta, quality_interval, tile);
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
   }
 
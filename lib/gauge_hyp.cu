@@ -16,12 +16,14 @@ namespace quda
     const int level;
     const int dir_ignore;
     const int hypDim;
-    unsigned int minThreads() const { return in.LocalVolumeCB(); }
+    const lat_dim_t depth;
+    unsigned int minThreads() const { return smearRegionVolumeCB(in, depth); }
     unsigned int sharedBytesPerThread() const { return 4 * sizeof(int); } // for thread_array
 
   public:
     // (2,3/4): 2 for parity in the y thread dim, 3 or 4 corresponds to mapping direction to the z thread dim
-    GaugeHYP(GaugeField &out, GaugeField *tmp[4], const GaugeField &in, double alpha, int level, int dir_ignore) :
+    GaugeHYP(GaugeField &out, GaugeField *tmp[4], const GaugeField &in, double alpha, int level, int dir_ignore,
+             const lat_dim_t &depth) :
       TunableKernel3D(in, 2, (dir_ignore == 4) ? 4 : 3),
       out(out),
       tmp {tmp[0], tmp[1], tmp[2], tmp[3]},
@@ -29,12 +31,14 @@ namespace quda
       alpha(static_cast<Float>(alpha)),
       level(level),
       dir_ignore(dir_ignore),
-      hypDim((dir_ignore == 4) ? 4 : 3)
+      hypDim((dir_ignore == 4) ? 4 : 3),
+      depth(depth)
     {
       strcat(aux, ",level=");
       i32toa(aux + strlen(aux), level);
       strcat(aux, ",dir_ignore=");
       i32toa(aux + strlen(aux), dir_ignore);
+      setSmearDepthString(aux, depth);
       strcat(aux, comm_dim_partitioned_string());
       apply(device::get_default_stream());
     }
@@ -42,19 +46,25 @@ namespace quda
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      constexpr bool enable_host = true;
       if (hypDim == 4) {
         if (level == 1) {
-          launch<HYP>(tp, stream, GaugeHYPArg<Float, nColor, recon, 1, 4>(out, tmp, in, alpha, dir_ignore));
+          launch<HYP, enable_host>(tp, stream,
+                                   GaugeHYPArg<Float, nColor, recon, 1, 4>(out, tmp, in, alpha, dir_ignore, depth));
         } else if (level == 2) {
-          launch<HYP>(tp, stream, GaugeHYPArg<Float, nColor, recon, 2, 4>(out, tmp, in, alpha, dir_ignore));
+          launch<HYP, enable_host>(tp, stream,
+                                   GaugeHYPArg<Float, nColor, recon, 2, 4>(out, tmp, in, alpha, dir_ignore, depth));
         } else if (level == 3) {
-          launch<HYP>(tp, stream, GaugeHYPArg<Float, nColor, recon, 3, 4>(out, tmp, in, alpha, dir_ignore));
+          launch<HYP, enable_host>(tp, stream,
+                                   GaugeHYPArg<Float, nColor, recon, 3, 4>(out, tmp, in, alpha, dir_ignore, depth));
         }
       } else if (hypDim == 3) {
         if (level == 1) {
-          launch<HYP3D>(tp, stream, GaugeHYPArg<Float, nColor, recon, 1, 3>(out, tmp, in, alpha, dir_ignore));
+          launch<HYP3D, enable_host>(tp, stream,
+                                     GaugeHYPArg<Float, nColor, recon, 1, 3>(out, tmp, in, alpha, dir_ignore, depth));
         } else if (level == 2) {
-          launch<HYP3D>(tp, stream, GaugeHYPArg<Float, nColor, recon, 2, 3>(out, tmp, in, alpha, dir_ignore));
+          launch<HYP3D, enable_host>(tp, stream,
+                                     GaugeHYPArg<Float, nColor, recon, 2, 3>(out, tmp, in, alpha, dir_ignore, depth));
         }
       }
     }
@@ -67,11 +77,11 @@ namespace quda
       long long flops = 0;
       auto mat_flops = in.Ncolor() * in.Ncolor() * (8ll * in.Ncolor() - 2ll);
       if ((hypDim == 4 && level == 1) || (hypDim == 3 && level == 1)) {
-        flops += ((hypDim - 1) * 2 + (hypDim - 1) * 4) * mat_flops * hypDim * in.LocalVolume();
+        flops += ((hypDim - 1) * 2 + (hypDim - 1) * 4) * mat_flops * hypDim * 2ll * minThreads();
       } else if (hypDim == 4 && level == 2) {
-        flops += ((hypDim - 1) * 2 + (hypDim - 1) * (hypDim - 2) * 4) * mat_flops * hypDim * in.LocalVolume();
+        flops += ((hypDim - 1) * 2 + (hypDim - 1) * (hypDim - 2) * 4) * mat_flops * hypDim * 2ll * minThreads();
       } else if ((hypDim == 4 && level == 3) || (hypDim == 3 && level == 2)) {
-        flops += (2 + (hypDim - 1) * 4) * mat_flops * hypDim * in.LocalVolume();
+        flops += (2 + (hypDim - 1) * 4) * mat_flops * hypDim * 2ll * minThreads();
       }
       return flops;
     }
@@ -82,16 +92,16 @@ namespace quda
       if ((hypDim == 4 && level == 1) || (hypDim == 3 && level == 1)) { // 6 links per dim, 1 in, hypDim-1 tmp
         bytes += (in.Reconstruct() * in.Precision() + (hypDim - 1) * 6 * in.Reconstruct() * in.Precision()
                   + (hypDim - 1) * tmp[0]->Reconstruct() * tmp[0]->Precision())
-          * hypDim * in.LocalVolume();
+          * hypDim * 2ll * minThreads();
       } else if (hypDim == 4 && level == 2) { // 6 links per dim, 1 in, hypDim-1 tmp
         bytes += (in.Reconstruct() * in.Precision()
                   + (hypDim - 1) * (hypDim - 2) * 6 * tmp[0]->Reconstruct() * tmp[0]->Precision()
                   + (hypDim - 1) * tmp[0]->Reconstruct() * tmp[0]->Precision())
-          * hypDim * in.LocalVolume();
+          * hypDim * 2ll * minThreads();
       } else if ((hypDim == 4 && level == 3) || (hypDim == 3 && level == 2)) { // 6 links per dim, 1 in, 1 out
         bytes += (in.Reconstruct() * in.Precision() + (hypDim - 1) * 6 * tmp[0]->Reconstruct() * tmp[0]->Precision()
                   + out.Reconstruct() * out.Precision())
-          * hypDim * in.LocalVolume();
+          * hypDim * 2ll * minThreads();
       }
       return bytes;
     }
@@ -124,20 +134,18 @@ namespace quda
     if (dir_ignore == 4) {
       copyExtendedGauge(in, out, QUDA_CUDA_FIELD_LOCATION);
       in.exchangeExtendedGhost(in.R(), false);
-      instantiate<GaugeHYP>(out, tmp, in, alpha3, 1, dir_ignore);
-      tmp[0]->exchangeExtendedGhost(tmp[0]->R(), false);
-      tmp[1]->exchangeExtendedGhost(tmp[1]->R(), false);
-      instantiate<GaugeHYP>(out, tmp, in, alpha2, 2, dir_ignore);
-      tmp[2]->exchangeExtendedGhost(tmp[2]->R(), false);
-      tmp[3]->exchangeExtendedGhost(tmp[3]->R(), false);
-      instantiate<GaugeHYP>(out, tmp, in, alpha1, 3, dir_ignore);
+      instantiate<GaugeHYP>(out, tmp, in, alpha3, 1, dir_ignore, lat_dim_t {});
+      GaugeField::exchangeExtendedGhost({tmp[0], tmp[1]}, tmp[0]->R(), false);
+      instantiate<GaugeHYP>(out, tmp, in, alpha2, 2, dir_ignore, lat_dim_t {});
+      GaugeField::exchangeExtendedGhost({tmp[2], tmp[3]}, tmp[2]->R(), false);
+      instantiate<GaugeHYP>(out, tmp, in, alpha1, 3, dir_ignore, lat_dim_t {});
       out.exchangeExtendedGhost(out.R(), false);
     } else {
       copyExtendedGauge(in, out, QUDA_CUDA_FIELD_LOCATION);
       in.exchangeExtendedGhost(in.R(), false);
-      instantiate<GaugeHYP>(out, tmp, in, alpha3, 1, dir_ignore);
+      instantiate<GaugeHYP>(out, tmp, in, alpha3, 1, dir_ignore, lat_dim_t {});
       tmp[0]->exchangeExtendedGhost(tmp[0]->R(), false);
-      instantiate<GaugeHYP>(out, tmp, in, alpha2, 2, dir_ignore);
+      instantiate<GaugeHYP>(out, tmp, in, alpha2, 2, dir_ignore, lat_dim_t {});
       out.exchangeExtendedGhost(out.R(), false);
     }
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
@@ -145,4 +153,34 @@ namespace quda
     for (int i = 0; i < 4; i++) delete tmp[i];
   }
 
+  void HYPStep(GaugeField &out, GaugeField *tmp[4], const GaugeField &in, double alpha1, double alpha2, double alpha3,
+               int dir_ignore, const lat_dim_t &depth)
+  {
+    checkPrecision(out, in);
+    checkReconstruct(out, in);
+    checkNative(out, in);
+    checkLocation(out, in);
+
+    if (dir_ignore < 0 || dir_ignore > 3) { dir_ignore = 4; }
+
+    // each level is computed on one more layer of the halo than the level that consumes it
+    const int n_level = dir_ignore == 4 ? 3 : 2;
+    auto level_depth = [&](int level) {
+      lat_dim_t d;
+      for (int i = 0; i < 4; i++) d[i] = depth[i] + (in.R()[i] > 0 ? n_level - level : 0);
+      return d;
+    };
+
+    getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+    if (dir_ignore == 4) {
+      instantiate<GaugeHYP>(out, tmp, in, alpha3, 1, dir_ignore, level_depth(1));
+      instantiate<GaugeHYP>(out, tmp, in, alpha2, 2, dir_ignore, level_depth(2));
+      instantiate<GaugeHYP>(out, tmp, in, alpha1, 3, dir_ignore, level_depth(3));
+    } else {
+      instantiate<GaugeHYP>(out, tmp, in, alpha3, 1, dir_ignore, level_depth(1));
+      instantiate<GaugeHYP>(out, tmp, in, alpha2, 2, dir_ignore, level_depth(2));
+    }
+    getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+  }
+
 } // namespace quda
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <quda_internal.h>
 #include <gauge_field.h>
 #include <random_quda.h>
+#include <random_counter.h>
 #include <instantiate.h>
 #include <tunable_nd.h>
 #include <kernels/gauge_noise.cuh>
@@ -8,22 +9,35 @@
 
 namespace quda {
 
-  template <typename real, int nColor>
+  template <typename real, int nColor, typename Gen>
   class GaugeNoise : TunableKernel2D
   {
     GaugeField &U;
-    RNG &rng;
+    Gen &rng;
     QudaNoiseType type;
+    static constexpr bool counter = std::is_same_v<Gen, CounterRNG>;
     unsigned int minThreads() const { return U.VolumeCB(); }
 
+    template <QudaNoiseType noise> void launch(TuneParam &tp, const qudaStream_t &stream)
+    {
+      if constexpr (counter) {
+        constexpr bool enable_host = true;
+        TunableKernel2D::launch<NoiseGauge, enable_host>(tp, stream,
+                                                         GaugeNoiseArg<real, nColor, noise, CounterRNGState>(U, rng));
+      } else {
+        TunableKernel2D::launch<NoiseGauge>(tp, stream, GaugeNoiseArg<real, nColor, noise>(U, rng.State()));
+      }
+    }
+
   public:
-    GaugeNoise(GaugeField &U, RNG &rng, QudaNoiseType type) :
+    GaugeNoise(GaugeField &U, Gen &rng, QudaNoiseType type) :
       TunableKernel2D(U, 2),
       U(U),
       rng(rng),
       type(type)
     {
       strcat(aux, type == QUDA_NOISE_GAUSS ? ",gauss" : ",uniform");
+      if (counter) strcat(aux, ",counter");
       if (type == QUDA_NOISE_GAUSS) {
         logQuda(QUDA_SUMMARIZE, "Creating Gaussian distributed field\n");
       } else {
@@ -36,24 +50,23 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (type == QUDA_NOISE_UNIFORM)
-        launch<NoiseGauge>(tp, stream, GaugeNoiseArg<real, nColor, QUDA_NOISE_UNIFORM>(U, rng.State()));
+        launch<QUDA_NOISE_UNIFORM>(tp, stream);
       else
-        launch<NoiseGauge>(tp, stream, GaugeNoiseArg<real, nColor, QUDA_NOISE_GAUSS>(U, rng.State()));
-        
+        launch<QUDA_NOISE_GAUSS>(tp, stream);
     }
 
     long long bytes() const { return U.Bytes(); }
-    void preTune() { rng.backup(); }
-    void postTune() { rng.restore(); }
+    void preTune() { if constexpr (!counter) rng.backup(); }
+    void postTune() { if constexpr (!counter) rng.restore(); }
   };
 
-  template <typename real, int nColor, int...N>
-  void gaugeNoise(GaugeField &U, RNG &rng, QudaNoiseType type, IntList<nColor, N...>)
+  template <typename real, int nColor, int...N, typename Gen>
+  void gaugeNoise(GaugeField &U, Gen &rng, QudaNoiseType type, IntList<nColor, N...>)
   {
     if ((U.Ncolor() == 3 && U.Ncolor() == nColor) ||
         (U.Ncolor() > 3 && (U.Ncolor() / 2 == nColor))) {
-      if constexpr (nColor == 3) GaugeNoise<real, nColor>(U, rng, type);
-      else GaugeNoise<real, 2 * nColor>(U, rng, type);
+      if constexpr (nColor == 3) GaugeNoise<real, nColor, Gen>(U, rng, type);
+      else GaugeNoise<real, 2 * nColor, Gen>(U, rng, type);
     } else {
       if constexpr (sizeof...(N) > 0) {
         gaugeNoise<real>(U, rng, type, IntList<N...>());
@@ -63,8 +76,10 @@ namespace quda {
     }
   }
     
-  void gaugeNoise(GaugeField &U_, RNG &rng, QudaNoiseType type)
+  template <typename Gen> void gauge_noise(GaugeField &U_, Gen &rng, QudaNoiseType type)
   {
+    // host fields are generated on the host with the counter-based generator
+    constexpr bool counter = std::is_same_v<Gen, CounterRNG>;
     GaugeFieldParam param(U_);
     GaugeField *U = nullptr;
     bool copy_back = false;
@@ -74,7 +89,7 @@ namespace quda {
       param.setPrecision(prec, true);
       if (param.order != QUDA_FLOAT2_GAUGE_ORDER) errorQuda("Unexpected order %d", param.order);
       param.create = QUDA_NULL_FIELD_CREATE;
-      param.location = QUDA_CUDA_FIELD_LOCATION;
+      if (!counter) param.location = QUDA_CUDA_FIELD_LOCATION;
       U = GaugeField::Create(param);
       copy_back = true;
     } else {
@@ -105,10 +120,23 @@ namespace quda {
     }
   }
 
-  void gaugeNoise(GaugeField &U, unsigned long long seed, QudaNoiseType type)
+  void gaugeNoise(GaugeField &U, RNG &rng, QudaNoiseType type) { gauge_noise(U, rng, type); }
+
+  void gaugeNoise(GaugeField &U, CounterRNG &rng, QudaNoiseType type)
+  {
+    gauge_noise(U, rng, type);
+    rng.advance();
+  }
+
+  void gaugeNoise(GaugeField &U, unsigned long long seed, QudaNoiseType type, bool counter)
   {
-    RNG randstates(U, seed);
-    gaugeNoise(U, randstates, type);
+    if (counter) {
+      CounterRNG rng(seed);
+      gaugeNoise(U, rng, type);
+    } else {
+      RNG randstates(U, seed);
+      gaugeNoise(U, randstates, type);
+    }
   }
-  
+
 }
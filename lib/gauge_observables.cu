@@ -0,0 +1,75 @@
+#include <gauge_field.h>
+#include <instantiate.h>
+#include <tunable_reduction.h>
+#include <kernels/gauge_observables.cuh>
+
+namespace quda
+{
+
+  template <typename Float, int nColor, QudaReconstructType recon> class GaugeObservablesFused : TunableReduction2D
+  {
+    const GaugeField &u;
+    double *plaq;
+    double *energy;
+    double &qcharge;
+    void *qdensity;
+
+  public:
+    GaugeObservablesFused(const GaugeField &u, double plaq[3], double energy[3], double &qcharge, void *qdensity) :
+      TunableReduction2D(u), u(u), plaq(plaq), energy(energy), qcharge(qcharge), qdensity(qdensity)
+    {
+      if (!u.isNative()) errorQuda("Fused gauge observables only supported on native ordered fields");
+      if (qdensity && u.Precision() < QUDA_SINGLE_PRECISION)
+        errorQuda("Charge density not supported for precision %d", u.Precision());
+      if (qdensity) strcat(aux, ",density");
+      apply(device::get_default_stream());
+    }
+
+    template <bool compute_density = false> using Arg = GaugeObservablesArg<Float, nColor, recon, compute_density>;
+
+    void apply(const qudaStream_t &stream)
+    {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      constexpr bool enable_host = true;
+
+      typename Arg<>::reduce_t result {};
+      if (!qdensity) {
+        Arg<false> arg(u);
+        launch<GaugeObservables, enable_host>(result, tp, stream, arg);
+      } else {
+        Arg<true> arg(u, static_cast<Float *>(qdensity));
+        launch<GaugeObservables, enable_host>(result, tp, stream, arg);
+      }
+
+      auto volume = static_cast<double>(u.LocalVolume()) * comm_size();
+      for (int i = 0; i < 2; i++) plaq[i + 1] = result[i] / (9. * volume);
+      plaq[0] = 0.5 * (plaq[1] + plaq[2]);
+      for (int i = 0; i < 2; i++) energy[i + 1] = result[i + 2] / volume;
+      energy[0] = energy[1] + energy[2];
+      qcharge = result[4];
+    }
+
+    long long flops() const
+    {
+      auto Nc = u.Ncolor();
+      auto mm_flops = 8 * Nc * Nc * (Nc - 2);
+      auto traceless_flops = (Nc * Nc + Nc + 1);
+      auto energy_flops = 6 * (mm_flops + traceless_flops + Nc);
+      auto q_flops = 3 * mm_flops + 2 * Nc + 2;
+      return u.LocalVolume() * ((2430 + 36 + Nc) * 6 + energy_flops + q_flops);
+    }
+
+    long long bytes() const
+    {
+      return (16 * u.Reconstruct() * 6 + (qdensity ? 1 : 0)) * u.LocalVolume() * u.Precision();
+    }
+  };
+
+  void gaugeObservablesFused(const GaugeField &u, double plaq[3], double energy[3], double &qcharge, void *qdensity)
+  {
+    getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+    instantiate<GaugeObservablesFused, ReconstructGauge>(u, plaq, energy, qcharge, qdensity);
+    getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+  }
+
+} // namespace quda
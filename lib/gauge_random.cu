@@ -1,6 +1,7 @@
 #include <quda_internal.h>
 #include <gauge_field.h>
 #include <random_quda.h>
+#include <random_counter.h>
 #include <instantiate.h>
 #include <tunable_nd.h>
 #include <kernels/gauge_random.cuh>
@@ -8,17 +9,30 @@
 
 namespace quda {
 
-  template <typename Float, int nColor, QudaReconstructType recon>
+  template <typename Float, int nColor, QudaReconstructType recon, typename Gen>
   class GaugeGauss : TunableKernel2D
   {
     GaugeField &U;
-    RNG &rng;
+    Gen &rng;
     Float sigma;
     bool group;
+    static constexpr bool counter = std::is_same_v<Gen, CounterRNG>;
     unsigned int minThreads() const { return U.VolumeCB(); }
 
+    template <bool is_group> void launch(TuneParam &tp, const qudaStream_t &stream)
+    {
+      if constexpr (counter) {
+        constexpr bool enable_host = true;
+        TunableKernel2D::launch<GaussGauge, enable_host>(
+          tp, stream, GaugeGaussArg<Float, nColor, recon, is_group, CounterRNGState>(U, rng, sigma));
+      } else {
+        TunableKernel2D::launch<GaussGauge>(tp, stream,
+                                            GaugeGaussArg<Float, nColor, recon, is_group>(U, rng.State(), sigma));
+      }
+    }
+
   public:
-    GaugeGauss(GaugeField &U, RNG &rng, double sigma) :
+    GaugeGauss(GaugeField &U, Gen &rng, double sigma) :
       TunableKernel2D(U, 2),
       U(U),
       rng(rng),
@@ -31,6 +45,7 @@ namespace quda {
         logQuda(QUDA_SUMMARIZE, "Creating Gaussian distributed Lie algebra field\n");
       }
       strcat(aux, group ? ",lie_group" : "lie_algebra");
+      if (counter) strcat(aux, ",counter");
       apply(device::get_default_stream());
     }
 
@@ -38,26 +53,32 @@ namespace quda {
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (group) {
-        launch<GaussGauge>(tp, stream, GaugeGaussArg<Float, nColor, recon, true>(U, rng.State(), sigma));
+        launch<true>(tp, stream);
       } else {
-        launch<GaussGauge>(tp, stream, GaugeGaussArg<Float, nColor, recon, false>(U, rng.State(), sigma));
+        launch<false>(tp, stream);
       }
     }
 
     long long bytes() const { return U.Bytes(); }
 
-    void preTune() { rng.backup(); }
-    void postTune() { rng.restore(); }
+    void preTune() { if constexpr (!counter) rng.backup(); }
+    void postTune() { if constexpr (!counter) rng.restore(); }
   };
 
-  void gaugeGauss(GaugeField &U, RNG &rng, double sigma)
+  template <typename Float, int nColor, QudaReconstructType recon>
+  using GaugeGaussMRG = GaugeGauss<Float, nColor, recon, RNG>;
+  template <typename Float, int nColor, QudaReconstructType recon>
+  using GaugeGaussCounter = GaugeGauss<Float, nColor, recon, CounterRNG>;
+
+  template <template <typename, int, QudaReconstructType> class Gauss, typename Gen>
+  void gauge_gauss(GaugeField &U, Gen &rng, double sigma)
   {
     if (!U.isNative()) errorQuda("Order %d with %d reconstruct not supported", U.Order(), U.Reconstruct());
     if (U.LinkType() != QUDA_SU3_LINKS && U.LinkType() != QUDA_MOMENTUM_LINKS)
       errorQuda("Unexpected link type %d", U.LinkType());
 
     getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
-    instantiate<GaugeGauss, ReconstructFull>(U, rng, sigma);
+    instantiate<Gauss, ReconstructFull>(U, rng, sigma);
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
 
     // ensure multi-gpu consistency if required
@@ -70,13 +91,26 @@ namespace quda {
     getProfile().TPSTOP(QUDA_PROFILE_COMMS);
   }
 
-  void gaugeGauss(GaugeField &U, unsigned long long seed, double sigma)
+  void gaugeGauss(GaugeField &U, RNG &rng, double sigma) { gauge_gauss<GaugeGaussMRG>(U, rng, sigma); }
+
+  void gaugeGauss(GaugeField &U, CounterRNG &rng, double sigma)
   {
-    getProfile().TPSTART(QUDA_PROFILE_COMMS);
-    RNG randstates(U, seed);
-    getProfile().TPSTOP(QUDA_PROFILE_COMMS);
+    gauge_gauss<GaugeGaussCounter>(U, rng, sigma);
+    rng.advance();
+  }
+
+  void gaugeGauss(GaugeField &U, unsigned long long seed, double sigma, bool counter)
+  {
+    if (counter) {
+      CounterRNG rng(seed);
+      gaugeGauss(U, rng, sigma);
+    } else {
+      getProfile().TPSTART(QUDA_PROFILE_COMMS);
+      RNG randstates(U, seed);
+      getProfile().TPSTOP(QUDA_PROFILE_COMMS);
 
-    gaugeGauss(U, randstates, sigma);
+      gaugeGauss(U, randstates, sigma);
+    }
   }
 
 }
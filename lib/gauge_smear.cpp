@@ -0,0 +1,92 @@
+#include <memory>
+#include <gauge_field.h>
+#include <gauge_tools.h>
+#include <timer.h>
+
+namespace quda
+{
+
+  int gaugeSmearRadius(QudaGaugeSmearType smear_type, int dir_ignore)
+  {
+    bool smear_4d = dir_ignore < 0 || dir_ignore > 3;
+    switch (smear_type) {
+    case QUDA_GAUGE_SMEAR_APE:
+    case QUDA_GAUGE_SMEAR_STOUT: return 1;
+    case QUDA_GAUGE_SMEAR_OVRIMP_STOUT: return 2; // rectangles
+    case QUDA_GAUGE_SMEAR_HYP: return smear_4d ? 3 : 2; // one layer per level
+    default: errorQuda("Unsupported gauge smear type %d", smear_type);
+    }
+    return 0;
+  }
+
+  void gaugeSmear(GaugeField &u, GaugeField &tmp, const QudaGaugeSmearParam &param, int n_steps, int dir_ignore)
+  {
+    if (n_steps <= 0) return;
+    checkPrecision(u, tmp);
+    checkLocation(u, tmp);
+    for (int d = 0; d < 4; d++)
+      if (u.R()[d] != tmp.R()[d]) errorQuda("Mismatched extended regions %d != %d", u.R()[d], tmp.R()[d]);
+
+    // the number of steps we can apply between halo exchanges
+    const int radius = gaugeSmearRadius(param.smear_type, dir_ignore);
+    int steps_per_exchange = n_steps;
+    for (int d = 0; d < 4; d++)
+      if (u.R()[d] > 0) steps_per_exchange = std::min(steps_per_exchange, u.R()[d] / radius);
+    if (steps_per_exchange == 0)
+      errorQuda("Extended region (%d,%d,%d,%d) too small for gauge smear type %d", u.R()[0], u.R()[1], u.R()[2],
+                u.R()[3], param.smear_type);
+
+    // HYP decorated link fields are allocated once and reused for each step
+    std::vector<std::unique_ptr<GaugeField>> hyp_tmp;
+    GaugeField *hyp[4] = {};
+    if (param.smear_type == QUDA_GAUGE_SMEAR_HYP) {
+      GaugeFieldParam gParam(u);
+      gParam.geometry = QUDA_TENSOR_GEOMETRY;
+      hyp_tmp.push_back(std::make_unique<GaugeField>(gParam));
+      // for 3-d smearing only the first field is used
+      if (dir_ignore >= 0 && dir_ignore <= 3) gParam.create = QUDA_REFERENCE_FIELD_CREATE;
+      for (int i = 1; i < 4; i++) hyp_tmp.push_back(std::make_unique<GaugeField>(gParam));
+      for (int i = 0; i < 4; i++) hyp[i] = hyp_tmp[i].get();
+    }
+
+    size_t bytes = u.Bytes() + tmp.Bytes();
+    for (auto &h : hyp_tmp) bytes += h->Bytes();
+
+    host_timer_t timer;
+    timer.start();
+
+    GaugeField *in = &u;
+    GaugeField *out = &tmp;
+    for (int i = 0; i < n_steps; i++) {
+      int step = i % steps_per_exchange;
+      if (step == 0) in->exchangeExtendedGhost(in->R(), true);
+
+      // after each step the valid part of the halo shrinks by the stencil radius
+      lat_dim_t depth;
+      for (int d = 0; d < 4; d++) depth[d] = u.R()[d] > 0 ? u.R()[d] - (step + 1) * radius : 0;
+
+      switch (param.smear_type) {
+      case QUDA_GAUGE_SMEAR_APE: APEStep(*out, *in, param.alpha, dir_ignore, depth); break;
+      case QUDA_GAUGE_SMEAR_STOUT: STOUTStep(*out, *in, param.rho, dir_ignore, depth); break;
+      case QUDA_GAUGE_SMEAR_OVRIMP_STOUT:
+        OvrImpSTOUTStep(*out, *in, param.rho, param.epsilon, dir_ignore, depth);
+        break;
+      case QUDA_GAUGE_SMEAR_HYP:
+        HYPStep(*out, hyp, *in, param.alpha1, param.alpha2, param.alpha3, dir_ignore, depth);
+        break;
+      default: errorQuda("Unsupported gauge smear type %d", param.smear_type);
+      }
+      std::swap(in, out);
+    }
+
+    // the result is in tmp if we applied an odd number of steps
+    if (in != &u) std::swap(u, tmp);
+
+    if (u.Location() == QUDA_CUDA_FIELD_LOCATION) qudaDeviceSynchronize();
+    timer.stop();
+
+    logQuda(QUDA_VERBOSE, "%d steps with %d steps per halo exchange: %e s per step, %.2f MiB working memory\n",
+            n_steps, steps_per_exchange, timer.last() / n_steps, bytes / static_cast<double>(1 << 20));
+  }
+
+} // namespace quda
@@ -14,7 +14,8 @@ namespace quda {
     const Float epsilon;
     const int dir_ignore;
     const int stoutDim;
-    unsigned int minThreads() const { return in.LocalVolumeCB(); }
+    const lat_dim_t depth;
+    unsigned int minThreads() const { return smearRegionVolumeCB(in, depth); }
 
     unsigned int maxSharedBytesPerBlock() const { return maxDynamicSharedBytesPerBlock(); }
     unsigned int sharedBytesPerThread() const
@@ -26,7 +27,8 @@ namespace quda {
 
   public:
     // (2,3/4): 2 for parity in the y thread dim, 3 or 4 corresponds to mapping direction to the z thread dim
-    GaugeSTOUT(GaugeField &out, const GaugeField &in, bool improved, double rho, double epsilon, int dir_ignore) :
+    GaugeSTOUT(GaugeField &out, const GaugeField &in, bool improved, double rho, double epsilon, int dir_ignore,
+               const lat_dim_t &depth) :
       TunableKernel3D(in, 2, (dir_ignore == 4) ? 4 : 3),
       out(out),
       in(in),
@@ -34,11 +36,13 @@ namespace quda {
       rho(static_cast<Float>(rho)),
       epsilon(static_cast<Float>(epsilon)),
       dir_ignore(dir_ignore),
-      stoutDim((dir_ignore == 4) ? 4 : 3)
+      stoutDim((dir_ignore == 4) ? 4 : 3),
+      depth(depth)
     {
       if (improved) strcat(aux, ",improved");
       strcat(aux, ",dir_ignore=");
       i32toa(aux + strlen(aux), dir_ignore);
+      setSmearDepthString(aux, depth);
       strcat(aux, comm_dim_partitioned_string());
       apply(device::get_default_stream());
     }
@@ -46,18 +50,21 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      constexpr bool enable_host = true;
       if (!improved) {
         if (stoutDim == 3) {
-          launch<STOUT>(tp, stream, STOUTArg<Float, nColor, recon, 3>(out, in, rho, 0.0, dir_ignore));
+          launch<STOUT, enable_host>(tp, stream, STOUTArg<Float, nColor, recon, 3>(out, in, rho, 0.0, dir_ignore, depth));
         } else if (stoutDim == 4) {
-          launch<STOUT>(tp, stream, STOUTArg<Float, nColor, recon, 4>(out, in, rho, 0.0, dir_ignore));
+          launch<STOUT, enable_host>(tp, stream, STOUTArg<Float, nColor, recon, 4>(out, in, rho, 0.0, dir_ignore, depth));
         }
       } else if (improved) {
         tp.set_max_shared_bytes = true;
         if (stoutDim == 3) {
-          launch<OvrImpSTOUT>(tp, stream, STOUTArg<Float, nColor, recon, 3>(out, in, rho, epsilon, dir_ignore));
+          launch<OvrImpSTOUT, enable_host>(tp, stream,
+                                           STOUTArg<Float, nColor, recon, 3>(out, in, rho, epsilon, dir_ignore, depth));
         } else if (stoutDim == 4) {
-          launch<OvrImpSTOUT>(tp, stream, STOUTArg<Float, nColor, recon, 4>(out, in, rho, epsilon, dir_ignore));
+          launch<OvrImpSTOUT, enable_host>(tp, stream,
+                                           STOUTArg<Float, nColor, recon, 4>(out, in, rho, epsilon, dir_ignore, depth));
         }
       }
     }
@@ -74,13 +81,14 @@ namespace quda {
     long long flops() const // just counts matrix multiplication
     {
       auto mat_flops = in.Ncolor() * in.Ncolor() * (8ll * in.Ncolor() - 2ll);
-      return (2 + (stoutDim - 1) * (improved ? 28 : 4)) * mat_flops * stoutDim * in.LocalVolume();
+      return (2 + (stoutDim - 1) * (improved ? 28 : 4)) * mat_flops * stoutDim * 2ll * minThreads();
     }
 
     long long bytes() const // 6 links per dim, 1 in, 1 out.
     {
       return ((1 + (stoutDim - 1) * (improved ? 24 : 6)) * in.Reconstruct() * in.Precision() +
-              out.Reconstruct() * out.Precision()) * stoutDim * in.LocalVolume();    }
+              out.Reconstruct() * out.Precision()) * stoutDim * 2ll * minThreads();
+    }
   };
 
   void STOUTStep(GaugeField &out, GaugeField &in, double rho, int dir_ignore)
@@ -94,7 +102,7 @@ namespace quda {
     copyExtendedGauge(in, out, QUDA_CUDA_FIELD_LOCATION);
     in.exchangeExtendedGhost(in.R(), false);
     getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
-    instantiate<GaugeSTOUT>(out, in, false, rho, 0.0, dir_ignore);
+    instantiate<GaugeSTOUT>(out, in, false, rho, 0.0, dir_ignore, lat_dim_t {});
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
     out.exchangeExtendedGhost(out.R(), false);
   }
@@ -110,9 +118,38 @@ namespace quda {
     copyExtendedGauge(in, out, QUDA_CUDA_FIELD_LOCATION);
     in.exchangeExtendedGhost(in.R(), false);
     getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
-    instantiate<GaugeSTOUT>(out, in, true, rho, epsilon, dir_ignore);
+    instantiate<GaugeSTOUT>(out, in, true, rho, epsilon, dir_ignore, lat_dim_t {});
     getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
     out.exchangeExtendedGhost(out.R(), false);
   }
 
+  void STOUTStep(GaugeField &out, const GaugeField &in, double rho, int dir_ignore, const lat_dim_t &depth)
+  {
+    checkPrecision(out, in);
+    checkReconstruct(out, in);
+    checkNative(out, in);
+    checkLocation(out, in);
+
+    if (dir_ignore < 0 || dir_ignore > 3) { dir_ignore = 4; }
+
+    getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+    instantiate<GaugeSTOUT>(out, in, false, rho, 0.0, dir_ignore, depth);
+    getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+  }
+
+  void OvrImpSTOUTStep(GaugeField &out, const GaugeField &in, double rho, double epsilon, int dir_ignore,
+                       const lat_dim_t &depth)
+  {
+    checkPrecision(out, in);
+    checkReconstruct(out, in);
+    checkNative(out, in);
+    checkLocation(out, in);
+
+    if (dir_ignore < 0 || dir_ignore > 3) { dir_ignore = 4; }
+
+    getProfile().TPSTART(QUDA_PROFILE_COMPUTE);
+    instantiate<GaugeSTOUT>(out, in, true, rho, epsilon, dir_ignore, depth);
+    getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
+  }
+
 }
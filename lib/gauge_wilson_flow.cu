@@ -13,6 +13,7 @@ namespace quda {
     GaugeField &out;
     GaugeField &temp;
     const GaugeField &in;
+    GaugeField *embedded;
     const real epsilon;
     const QudaGaugeSmearType wflow_type;
     const QudaWFlowStepType step_type;
@@ -33,11 +34,12 @@ namespace quda {
 
   public:
     GaugeWFlowStep(GaugeField &out, GaugeField &temp, const GaugeField &in, const double epsilon,
-                   const QudaGaugeSmearType wflow_type, const QudaWFlowStepType step_type) :
+                   const QudaGaugeSmearType wflow_type, const QudaWFlowStepType step_type, GaugeField *embedded) :
       TunableKernel3D(in, 2, wflow_dim),
       out(out),
       temp(temp),
       in(in),
+      embedded(embedded),
       epsilon(epsilon),
       wflow_type(wflow_type),
       step_type(step_type)
@@ -55,6 +57,7 @@ namespace quda {
       case WFLOW_STEP_VT: strcat(aux, "_VT"); break;
       default : errorQuda("Unknown Wilson Flow step type %d", step_type);
       }
+      if (embedded) strcat(aux, ",embedded");
 
       apply(device::get_default_stream());
       getProfile().TPSTOP(QUDA_PROFILE_COMPUTE);
@@ -66,18 +69,22 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      constexpr bool enable_host = true;
 
       switch (wflow_type) {
       case QUDA_GAUGE_SMEAR_WILSON_FLOW:
         switch (step_type) {
         case WFLOW_STEP_W1:
-          launch<WFlow>(tp, stream, Arg<QUDA_GAUGE_SMEAR_WILSON_FLOW, WFLOW_STEP_W1>(out, temp, in, epsilon));
+          launch<WFlow, enable_host>(
+            tp, stream, Arg<QUDA_GAUGE_SMEAR_WILSON_FLOW, WFLOW_STEP_W1>(out, temp, in, epsilon, embedded));
           break;
         case WFLOW_STEP_W2:
-          launch<WFlow>(tp, stream, Arg<QUDA_GAUGE_SMEAR_WILSON_FLOW, WFLOW_STEP_W2>(out, temp, in, epsilon));
+          launch<WFlow, enable_host>(
+            tp, stream, Arg<QUDA_GAUGE_SMEAR_WILSON_FLOW, WFLOW_STEP_W2>(out, temp, in, epsilon, embedded));
           break;
         case WFLOW_STEP_VT:
-          launch<WFlow>(tp, stream, Arg<QUDA_GAUGE_SMEAR_WILSON_FLOW, WFLOW_STEP_VT>(out, temp, in, epsilon));
+          launch<WFlow, enable_host>(
+            tp, stream, Arg<QUDA_GAUGE_SMEAR_WILSON_FLOW, WFLOW_STEP_VT>(out, temp, in, epsilon, embedded));
           break;
         }
         break;
@@ -85,13 +92,16 @@ namespace quda {
         tp.set_max_shared_bytes = true;
         switch (step_type) {
         case WFLOW_STEP_W1:
-          launch<WFlow>(tp, stream, Arg<QUDA_GAUGE_SMEAR_SYMANZIK_FLOW, WFLOW_STEP_W1>(out, temp, in, epsilon));
+          launch<WFlow, enable_host>(
+            tp, stream, Arg<QUDA_GAUGE_SMEAR_SYMANZIK_FLOW, WFLOW_STEP_W1>(out, temp, in, epsilon, embedded));
           break;
         case WFLOW_STEP_W2:
-          launch<WFlow>(tp, stream, Arg<QUDA_GAUGE_SMEAR_SYMANZIK_FLOW, WFLOW_STEP_W2>(out, temp, in, epsilon));
+          launch<WFlow, enable_host>(
+            tp, stream, Arg<QUDA_GAUGE_SMEAR_SYMANZIK_FLOW, WFLOW_STEP_W2>(out, temp, in, epsilon, embedded));
           break;
         case WFLOW_STEP_VT:
-          launch<WFlow>(tp, stream, Arg<QUDA_GAUGE_SMEAR_SYMANZIK_FLOW, WFLOW_STEP_VT>(out, temp, in, epsilon));
+          launch<WFlow, enable_host>(
+            tp, stream, Arg<QUDA_GAUGE_SMEAR_SYMANZIK_FLOW, WFLOW_STEP_VT>(out, temp, in, epsilon, embedded));
           break;
         }
         break;
@@ -99,8 +109,19 @@ namespace quda {
       }
     }
 
-    void preTune() { out.backup(); temp.backup(); }
-    void postTune() { out.restore(); temp.restore(); }
+    void preTune()
+    {
+      out.backup();
+      temp.backup();
+      if (embedded) embedded->backup();
+    }
+
+    void postTune()
+    {
+      out.restore();
+      temp.restore();
+      if (embedded) embedded->restore();
+    }
 
     long long flops() const
     {
@@ -125,7 +146,9 @@ namespace quda {
       default : errorQuda("Unknown Wilson Flow type");
       }
       auto temp_io = step_type == WFLOW_STEP_W2 ? 2 : step_type == WFLOW_STEP_VT ? 1 : 0;
-      return ((1 + (wflow_dim - 1) * links) * in.Bytes() + out.Bytes() + temp_io * temp.Bytes());
+      auto embedded_io = !embedded ? 0 : step_type == WFLOW_STEP_W2 ? 1 : step_type == WFLOW_STEP_VT ? 2 : 0;
+      return ((1 + (wflow_dim - 1) * links) * in.Bytes() + out.Bytes() + temp_io * temp.Bytes()
+              + embedded_io * temp.Bytes());
     }
   }; // GaugeWFlowStep
 
@@ -134,22 +157,50 @@ namespace quda {
     checkPrecision(out, temp, in);
     checkReconstruct(out, in);
     checkNative(out, in);
+    checkLocation(out, temp, in);
     if (temp.Reconstruct() != QUDA_RECONSTRUCT_NO) errorQuda("Temporary vector must not use reconstruct");
     if (!(smear_type == QUDA_GAUGE_SMEAR_WILSON_FLOW || smear_type == QUDA_GAUGE_SMEAR_SYMANZIK_FLOW))
       errorQuda("Gauge smear type %d not supported for flow kernels", smear_type);
     
     // Set each step type as an arg parameter, update halos if needed
     // Step W1
-    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, WFLOW_STEP_W1);
+    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, WFLOW_STEP_W1, nullptr);
     out.exchangeExtendedGhost(out.R(), false);
 
     // Step W2
-    instantiate<GaugeWFlowStep>(in, temp, out, epsilon, smear_type, WFLOW_STEP_W2);
+    instantiate<GaugeWFlowStep>(in, temp, out, epsilon, smear_type, WFLOW_STEP_W2, nullptr);
     in.exchangeExtendedGhost(in.R(), false);
 
     // Step Vt
-    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, WFLOW_STEP_VT);
+    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, WFLOW_STEP_VT, nullptr);
+    out.exchangeExtendedGhost(out.R(), false);
+  }
+
+  double WFlowStep(GaugeField &out, GaugeField &temp, GaugeField &embedded, GaugeField &in, const double epsilon,
+                   const QudaGaugeSmearType smear_type)
+  {
+    checkPrecision(out, temp, embedded, in);
+    checkReconstruct(out, in);
+    checkNative(out, in);
+    checkLocation(out, temp, embedded, in);
+    if (temp.Reconstruct() != QUDA_RECONSTRUCT_NO || embedded.Reconstruct() != QUDA_RECONSTRUCT_NO)
+      errorQuda("Temporary vectors must not use reconstruct");
+    if (!(smear_type == QUDA_GAUGE_SMEAR_WILSON_FLOW || smear_type == QUDA_GAUGE_SMEAR_SYMANZIK_FLOW))
+      errorQuda("Gauge smear type %d not supported for flow kernels", smear_type);
+
+    // Step W1
+    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, WFLOW_STEP_W1, nullptr);
     out.exchangeExtendedGhost(out.R(), false);
+
+    // Step W2, also forming the embedded second-order solution
+    instantiate<GaugeWFlowStep>(in, temp, out, epsilon, smear_type, WFLOW_STEP_W2, &embedded);
+    in.exchangeExtendedGhost(in.R(), false);
+
+    // Step Vt, replacing the embedded solution with the difference to the third-order solution
+    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, WFLOW_STEP_VT, &embedded);
+    out.exchangeExtendedGhost(out.R(), false);
+
+    return embedded.abs_max();
   }
 
   void GFlowStep(GaugeField &out, GaugeField &temp, GaugeField &in, const double epsilon,
@@ -162,7 +213,7 @@ namespace quda {
     if (!(smear_type == QUDA_GAUGE_SMEAR_WILSON_FLOW || smear_type == QUDA_GAUGE_SMEAR_SYMANZIK_FLOW))
       errorQuda("Gauge smear type %d not supported for flow kernels", smear_type);
 
-    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, step_type);
+    instantiate<GaugeWFlowStep>(out, temp, in, epsilon, smear_type, step_type, nullptr);
     out.exchangeExtendedGhost(out.R(), false);
   }
 }
@@ -0,0 +1,253 @@
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <halo_exchange.h>
+
+namespace quda
+{
+
+  namespace halo
+  {
+
+    /**
+       Tag used for the aggregated messages.  All messages to a given
+       neighbor are aggregated and completed within a single exchange,
+       so a single tag suffices.  This lies outside the range of tags
+       used by the relative (displaced) message handles.
+    */
+    constexpr int halo_tag = 1 << 20;
+
+    /**
+       @brief An aggregated message to or from a given rank, made up
+       of a set of segments at given offsets in the message
+    */
+    struct Message {
+      int rank = -1;
+      size_t offset = 0; // offset of the message in the plan buffer
+      size_t bytes = 0;
+      std::vector<std::pair<int, size_t>> segment; // (segment index, offset in message)
+      MsgHandle *mh = nullptr;
+    };
+
+    /**
+       @brief The plan for a given exchange: the messages are laid
+       out contiguously in a single send and a single receive buffer,
+       such that they can be exchanged either with point-to-point
+       messages or with a single neighborhood collective.
+    */
+    struct Plan {
+      Backend backend;
+      std::vector<Message> send;
+      std::vector<Message> recv;
+      char *send_buffer = nullptr;
+      char *recv_buffer = nullptr;
+      NeighborHandle *nh = nullptr;
+    };
+
+    static std::map<std::vector<size_t>, Plan> plans;
+    static Stats stats;
+
+    static bool backend_init = false;
+    static Backend backend = Backend::P2P;
+
+    Backend get_backend()
+    {
+      if (!backend_init) {
+        char *enable_neighbor_env = getenv("QUDA_ENABLE_NEIGHBOR_COLLECTIVES");
+        if (enable_neighbor_env && strcmp(enable_neighbor_env, "1") == 0) backend = Backend::NEIGHBOR;
+        backend_init = true;
+      }
+      return backend;
+    }
+
+    void set_backend(Backend backend_)
+    {
+      backend = backend_;
+      backend_init = true;
+    }
+
+    /**
+       @brief Generate the key that uniquely identifies the layout of
+       an exchange: the backend and process grid followed by the
+       dimension, direction, size and neighbors of each segment.
+    */
+    static std::vector<size_t> get_key(const std::vector<Segment> &segments)
+    {
+      std::vector<size_t> key;
+      key.reserve(5 + 5 * segments.size());
+      key.push_back(static_cast<size_t>(get_backend()));
+      for (int d = 0; d < 4; d++) key.push_back(comm_dim(d));
+      for (auto &s : segments) {
+        key.push_back(s.dim);
+        key.push_back(s.dir);
+        key.push_back(s.bytes);
+        key.push_back(comm_neighbor_rank(s.dir, s.dim));
+        key.push_back(comm_neighbor_rank(1 - s.dir, s.dim));
+      }
+      return key;
+    }
+
+    /**
+       @brief Create the plan for a given exchange.  Segments are sent
+       to the neighbor in direction dir and received from the neighbor
+       in direction 1 - dir.  Within each message the segments are
+       ordered by their index, so the sender's and receiver's layouts
+       match since all processes register the same segments.
+    */
+    static Plan create_plan(const std::vector<Segment> &segments)
+    {
+      std::map<int, Message> send;
+      std::map<int, Message> recv;
+
+      for (int i = 0; i < static_cast<int>(segments.size()); i++) {
+        auto &s = segments[i];
+        auto &ms = send[comm_neighbor_rank(s.dir, s.dim)];
+        ms.segment.push_back({i, ms.bytes});
+        ms.bytes += s.bytes;
+
+        auto &mr = recv[comm_neighbor_rank(1 - s.dir, s.dim)];
+        mr.segment.push_back({i, mr.bytes});
+        mr.bytes += s.bytes;
+      }
+
+      Plan plan;
+      plan.backend = get_backend();
+
+      size_t send_bytes = 0;
+      for (auto &[rank, m] : send) {
+        m.rank = rank;
+        m.offset = send_bytes;
+        send_bytes += m.bytes;
+        plan.send.push_back(m);
+      }
+
+      size_t recv_bytes = 0;
+      for (auto &[rank, m] : recv) {
+        m.rank = rank;
+        m.offset = recv_bytes;
+        recv_bytes += m.bytes;
+        plan.recv.push_back(m);
+      }
+
+      plan.send_buffer = static_cast<char *>(safe_malloc(send_bytes));
+      plan.recv_buffer = static_cast<char *>(safe_malloc(recv_bytes));
+
+      switch (plan.backend) {
+      case Backend::P2P:
+        for (auto &m : plan.recv)
+          m.mh = comm_declare_recv_rank(plan.recv_buffer + m.offset, m.rank, halo_tag, m.bytes);
+        for (auto &m : plan.send)
+          m.mh = comm_declare_send_rank(plan.send_buffer + m.offset, m.rank, halo_tag, m.bytes);
+        break;
+      case Backend::NEIGHBOR: {
+        std::vector<CommNeighbor> dst;
+        for (auto &m : plan.send) dst.push_back({m.rank, m.offset, m.bytes});
+        std::vector<CommNeighbor> src;
+        for (auto &m : plan.recv) src.push_back({m.rank, m.offset, m.bytes});
+        plan.nh = comm_declare_neighbor_alltoallv(plan.send_buffer, dst, plan.recv_buffer, src);
+        break;
+      }
+      default: errorQuda("Unknown halo exchange backend %d", static_cast<int>(plan.backend));
+      }
+
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Created %s halo exchange plan with %lu segments in %lu send and %lu receive messages\n",
+                   plan.backend == Backend::NEIGHBOR ? "neighbor collective" : "point-to-point", segments.size(),
+                   plan.send.size(), plan.recv.size());
+
+      return plan;
+    }
+
+    void Exchange::add(int dim, int dir, void *send, void *recv, size_t bytes)
+    {
+      if (dim < 0 || dim >= 4) errorQuda("Invalid dimension %d", dim);
+      if (dir != 0 && dir != 1) errorQuda("Invalid direction %d", dir);
+      if (bytes == 0) return;
+      segments.push_back({dim, dir, send, recv, bytes});
+    }
+
+    void Exchange::add_bidirectional(int dim, void *send_back, void *send_fwd, void *recv_back, void *recv_fwd,
+                                     size_t bytes)
+    {
+      add(dim, 1, send_fwd, recv_back, bytes);
+      add(dim, 0, send_back, recv_fwd, bytes);
+    }
+
+    void Exchange::execute()
+    {
+      std::vector<Segment> comms;
+      for (auto &s : segments) {
+        // with a single process in a (forcibly) partitioned dimension
+        // both neighbors are this process, so the exchange is a local
+        // copy; this also avoids requiring self messages from the
+        // communicator, which the single communicator does not support
+        if (comm_dim_partitioned(s.dim) && comm_dim(s.dim) > 1)
+          comms.push_back(s);
+        else
+          memcpy(s.recv, s.send, s.bytes);
+      }
+      segments.clear();
+
+      if (comms.size() == 0) return;
+
+      auto key = get_key(comms);
+      auto it = plans.find(key);
+      if (it == plans.end()) {
+        it = plans.emplace(key, create_plan(comms)).first;
+        stats.plans++;
+      }
+      auto &plan = it->second;
+
+      for (auto &m : plan.send) {
+        for (auto &[i, offset] : m.segment)
+          memcpy(plan.send_buffer + m.offset + offset, comms[i].send, comms[i].bytes);
+        stats.bytes += m.bytes;
+      }
+
+      if (plan.backend == Backend::NEIGHBOR) {
+        comm_neighbor_alltoallv(plan.nh);
+      } else {
+        for (auto &m : plan.recv) comm_start(m.mh);
+        for (auto &m : plan.send) comm_start(m.mh);
+        for (auto &m : plan.recv) comm_wait(m.mh);
+        for (auto &m : plan.send) comm_wait(m.mh);
+      }
+
+      for (auto &m : plan.recv) {
+        for (auto &[i, offset] : m.segment)
+          memcpy(comms[i].recv, plan.recv_buffer + m.offset + offset, comms[i].bytes);
+      }
+
+      stats.exchanges++;
+      stats.segments += comms.size();
+      stats.messages += plan.send.size();
+    }
+
+    const Stats &get_stats() { return stats; }
+
+    void print_stats()
+    {
+      if (stats.exchanges == 0) return;
+      printfQuda("\n   %20s: %lu exchanges using %lu plans, %lu messages sent for %lu segments, %lu bytes sent\n",
+                 "Halo exchange", stats.exchanges, stats.plans, stats.messages, stats.segments, stats.bytes);
+    }
+
+    void destroy()
+    {
+      for (auto &[key, plan] : plans) {
+        for (auto m : {&plan.send, &plan.recv}) {
+          for (auto &msg : *m)
+            if (msg.mh) comm_free(msg.mh);
+        }
+        if (plan.nh) comm_free(plan.nh);
+        host_free(plan.send_buffer);
+        host_free(plan.recv_buffer);
+      }
+      plans.clear();
+    }
+
+  } // namespace halo
+
+} // namespace quda
@@ -35,6 +35,8 @@
 #include <gauge_backup.h>
 #include <clover_backup.h>
 #include <split_grid.h>
+#include <halo_exchange.h>
+#include <gauge_cache.h>
 
 #include <ks_force_quda.h>
 #include <ks_qsmear.h>
@@ -415,6 +417,24 @@ void initCommsGridQuda(int nDim, const int *dims, QudaCommsMap func, void *fdata
   comms_initialized = true;
 }
 
+void initCommsGridTopologyQuda(int nDim, const int *dims, const int *X)
+{
+  if (nDim != 4) errorQuda("Number of communication grid dimensions must be 4");
+
+#if QMP_COMMS
+  // QMP's logical topology is a fixed permutation of the dimensions, so it cannot match the chosen mapping
+  if (QMP_logical_topology_is_declared())
+    errorQuda("Topology-aware rank mapping is incompatible with a declared QMP logical topology");
+#endif
+
+  // the map is only used while the default communicator is created
+  TopologyMap map;
+  for (int i = 0; i < nDim; i++) map.lattice[i] = X[i];
+  map.site_bytes = 12 * sizeof(float); // single-precision Wilson half spinor
+
+  initCommsGridQuda(nDim, dims, comm_topology_rank_from_coords, &map);
+}
+
 
 static void init_default_comms()
 {
@@ -1368,6 +1388,8 @@ void endQuda(void)
     LatticeField::freeGhostBuffer();
     ColorSpinorField::freeGhostBuffer();
     FieldTmp<ColorSpinorField>::destroy();
+    halo::destroy();
+    gauge_cache::destroy();
 
     blas_lapack::generic::destroy();
     blas_lapack::native::destroy();
@@ -1435,6 +1457,7 @@ void endQuda(void)
 
     profileInit2End.Print();
     TimeProfile::PrintGlobal();
+    halo::print_stats();
 
     printLaunchTimer();
     printAPIProfile();
@@ -3760,17 +3783,22 @@ void computeKSLinkQuda(void *fatlink, void *longlink, void *ulink, void *inlink,
   gParam.gauge = inlink;
   GaugeField cpuInLink(gParam); // create the host sitelink
 
+  const bool cache = gauge_cache::enabled();
+  gauge_cache::Key key;
+  if (cache) {
+    gauge_cache::Hash hash;
+    hash.add(path_coeff, 6);
+    hash(param->cuda_prec)(param->reconstruct)(param->staggered_phase_type)(param->staggered_phase_applied);
+    hash(fatlink != nullptr)(longlink != nullptr)(ulink != nullptr);
+    key = {"ks_link", gauge_cache::checksum(cpuInLink), hash.value()};
+  }
+
   // create the device fields
   gParam.location = QUDA_CUDA_FIELD_LOCATION;
   gParam.reconstruct = param->reconstruct;
   gParam.setPrecision(param->cuda_prec, true);
   gParam.create = QUDA_NULL_FIELD_CREATE;
-  GaugeField *cudaInLink = new GaugeField(gParam);
-
-  cudaInLink->copy(cpuInLink);
-  GaugeField *cudaInLinkEx = createExtendedGauge(*cudaInLink, R, profileFatLink);
-
-  delete cudaInLink;
+  GaugeFieldParam gParamIn(gParam);
 
   gParam.create = QUDA_ZERO_FIELD_CREATE;
   gParam.link_type = QUDA_GENERAL_LINKS;
@@ -3778,15 +3806,9 @@ void computeKSLinkQuda(void *fatlink, void *longlink, void *ulink, void *inlink,
   gParam.setPrecision(param->cuda_prec, true);
   gParam.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
 
-  if (longlink) {
-    GaugeField longLink(gParam);
-    longKSLink(longLink, *cudaInLinkEx, path_coeff);
-    cpuLongLink.copy(longLink);
-  }
-
   GaugeField fatLink(gParam);
-  fatKSLink(fatLink, *cudaInLinkEx, path_coeff);
-  if (fatlink) cpuFatLink.copy(fatLink);
+  GaugeField longLink = longlink ? GaugeField(gParam) : GaugeField();
+  GaugeField unitarizedLink = ulink ? GaugeField(gParam) : GaugeField();
 
   if (ulink) {
     const double unitarize_eps = 1e-14;
@@ -3797,29 +3819,49 @@ void computeKSLinkQuda(void *fatlink, void *longlink, void *ulink, void *inlink,
     const double svd_abs_error = 1e-6;
     quda::setUnitarizeLinksConstants(unitarize_eps, max_error, reunit_allow_svd, reunit_svd_only, svd_rel_error,
                                      svd_abs_error);
+  }
 
-    GaugeField unitarizedLink(gParam);
+  std::vector<GaugeField *> links = {&fatLink};
+  if (longlink) links.push_back(&longLink);
+  if (ulink) links.push_back(&unitarizedLink);
 
-    *num_failures_h = 0;
-    quda::unitarizeLinks(unitarizedLink, fatLink, num_failures_d); // unitarize on the gpu
-    if (*num_failures_h > 0)
-      errorQuda("Error in unitarization component of the hisq fattening: %d failures", *num_failures_h);
+  if (!cache || !gauge_cache::lookup(key, links)) {
+    GaugeField *cudaInLink = new GaugeField(gParamIn);
 
-    // project onto SU(3) if using the Chroma convention
-    if (param->staggered_phase_type == QUDA_STAGGERED_PHASE_CHROMA) {
+    cudaInLink->copy(cpuInLink);
+    GaugeField *cudaInLinkEx = createExtendedGauge(*cudaInLink, R, profileFatLink);
+
+    delete cudaInLink;
+
+    if (longlink) longKSLink(longLink, *cudaInLinkEx, path_coeff);
+    fatKSLink(fatLink, *cudaInLinkEx, path_coeff);
+
+    if (ulink) {
       *num_failures_h = 0;
-      const double tol = unitarizedLink.toleranceSU3();
-      if (unitarizedLink.StaggeredPhaseApplied()) unitarizedLink.removeStaggeredPhase();
-      projectSU3(unitarizedLink, tol, num_failures_d);
-      if (!unitarizedLink.StaggeredPhaseApplied() && param->staggered_phase_applied)
-        unitarizedLink.applyStaggeredPhase();
-      if (*num_failures_h > 0) errorQuda("Error in the SU(3) unitarization: %d failures\n", *num_failures_h);
+      quda::unitarizeLinks(unitarizedLink, fatLink, num_failures_d); // unitarize on the gpu
+      if (*num_failures_h > 0)
+        errorQuda("Error in unitarization component of the hisq fattening: %d failures", *num_failures_h);
+
+      // project onto SU(3) if using the Chroma convention
+      if (param->staggered_phase_type == QUDA_STAGGERED_PHASE_CHROMA) {
+        *num_failures_h = 0;
+        const double tol = unitarizedLink.toleranceSU3();
+        if (unitarizedLink.StaggeredPhaseApplied()) unitarizedLink.removeStaggeredPhase();
+        projectSU3(unitarizedLink, tol, num_failures_d);
+        if (!unitarizedLink.StaggeredPhaseApplied() && param->staggered_phase_applied)
+          unitarizedLink.applyStaggeredPhase();
+        if (*num_failures_h > 0) errorQuda("Error in the SU(3) unitarization: %d failures\n", *num_failures_h);
+      }
     }
 
-    cpuUnitarizedLink.copy(unitarizedLink);
+    delete cudaInLinkEx;
+
+    if (cache) gauge_cache::insert(key, std::vector<const GaugeField *>(links.begin(), links.end()));
   }
 
-  delete cudaInLinkEx;
+  if (longlink) cpuLongLink.copy(longLink);
+  if (fatlink) cpuFatLink.copy(fatLink);
+  if (ulink) cpuUnitarizedLink.copy(unitarizedLink);
 }
 
 void computeTwoLinkQuda(void *twolink, void *inlink, QudaGaugeParam *param)
@@ -3831,23 +3873,20 @@ void computeTwoLinkQuda(void *twolink, void *inlink, QudaGaugeParam *param)
   gParam.gauge = twolink;
   GaugeField cpuTwoLink(gParam); // create the host twolink
 
-  GaugeField *cudaInLinkEx = nullptr;
-
-  if (inlink) {
-    gParam.link_type = param->type;
-    gParam.gauge     = inlink;
-    GaugeField cpuInLink(gParam); // create the host sitelink
-
-    // create the device fields
-    gParam.reconstruct = param->reconstruct;
-    gParam.setPrecision(param->cuda_prec, true);
-    gParam.create = QUDA_NULL_FIELD_CREATE;
-    GaugeField cudaInLink(gParam);
-
-    cudaInLink.copy(cpuInLink);
-    cudaInLinkEx = createExtendedGauge(cudaInLink, R, profileGaussianSmear);
-  } else {
-    cudaInLinkEx = createExtendedGauge(*gaugePrecise, R, profileGaussianSmear);
+  gParam.link_type = param->type;
+  gParam.gauge = inlink;
+  GaugeField cpuInLink = inlink ? GaugeField(gParam) : GaugeField(); // create the host sitelink
+
+  const bool cache = gauge_cache::enabled();
+  gauge_cache::Key key;
+  if (cache) {
+    gauge_cache::Hash hash;
+    hash(param->cuda_prec)(inlink != nullptr);
+    if (inlink)
+      hash(param->reconstruct);
+    else
+      hash(gaugePrecise->Precision())(gaugePrecise->Reconstruct());
+    key = {"two_link", gauge_cache::checksum(inlink ? cpuInLink : *gaugePrecise), hash.value()};
   }
 
   GaugeFieldParam gsParam(*gaugePrecise);
@@ -3863,13 +3902,32 @@ void computeTwoLinkQuda(void *twolink, void *inlink, QudaGaugeParam *param)
   freeUniqueGaugeQuda(QUDA_SMEARED_LINKS);
   gaugeSmeared = new GaugeField(gsParam);
 
-  computeTwoLink(*gaugeSmeared, *cudaInLinkEx);
+  if (!cache || !gauge_cache::lookup(key, {gaugeSmeared})) {
+    GaugeField *cudaInLinkEx = nullptr;
+
+    if (inlink) {
+      // create the device fields
+      gParam.reconstruct = param->reconstruct;
+      gParam.setPrecision(param->cuda_prec, true);
+      gParam.create = QUDA_NULL_FIELD_CREATE;
+      GaugeField cudaInLink(gParam);
+
+      cudaInLink.copy(cpuInLink);
+      cudaInLinkEx = createExtendedGauge(cudaInLink, R, profileGaussianSmear);
+    } else {
+      cudaInLinkEx = createExtendedGauge(*gaugePrecise, R, profileGaussianSmear);
+    }
+
+    computeTwoLink(*gaugeSmeared, *cudaInLinkEx);
+    delete cudaInLinkEx;
+
+    if (cache) gauge_cache::insert(key, {gaugeSmeared});
+  }
   gaugeSmeared->exchangeGhost();
 
   cpuTwoLink.copy(*gaugeSmeared);
 
   freeUniqueGaugeQuda(QUDA_SMEARED_LINKS);
-  delete cudaInLinkEx;
 }
 
 int computeGaugeForceQuda(void* mom, void* siteLink,  int*** input_path_buf, int* path_length,
@@ -4946,11 +5004,13 @@ void copyExtendedResidentGaugeQuda(void *resident_gauge)
   static_cast<GaugeField *>(resident_gauge)->copy(*extendedGaugeResident);
 }
 
-void performWuppertalnStep(void *h_out, void *h_in, QudaInvertParam *inv_param, unsigned int n_steps, double alpha)
+void performWuppertalnStepMultiSrc(void **h_out, void **h_in, int n_src, QudaInvertParam *inv_param,
+                                   unsigned int n_steps, double alpha)
 {
   auto profile = pushProfile(profileWuppertal);
   pushVerbosity(inv_param->verbosity);
   if (gaugePrecise == nullptr) errorQuda("Gauge field must be loaded");
+  if (n_src < 1) errorQuda("Invalid number of sources %d", n_src);
 
   if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printQudaInvertParam(inv_param);
 
@@ -4968,17 +5028,25 @@ void performWuppertalnStep(void *h_out, void *h_in, QudaInvertParam *inv_param,
     precise = gaugePrecise;
   }
 
-  ColorSpinorParam cpuParam(h_in, *inv_param, precise->X(), false, inv_param->input_location);
-  ColorSpinorField in_h(cpuParam);
-
+  ColorSpinorParam cpuParam(h_in[0], *inv_param, precise->X(), false, inv_param->input_location);
   ColorSpinorParam cudaParam(cpuParam, *inv_param, QUDA_CUDA_FIELD_LOCATION);
-  ColorSpinorField in(cudaParam);
-  in = in_h;
 
-  logQuda(QUDA_DEBUG_VERBOSE, "In CPU %e CUDA %e\n", blas::norm2(in_h), blas::norm2(in));
+  std::vector<ColorSpinorField> in_h(n_src), out_h(n_src);
+  for (int i = 0; i < n_src; i++) {
+    cpuParam.v = h_in[i];
+    in_h[i] = ColorSpinorField(cpuParam);
+  }
+  cpuParam.location = inv_param->output_location;
+  for (int i = 0; i < n_src; i++) {
+    cpuParam.v = h_out[i];
+    out_h[i] = ColorSpinorField(cpuParam);
+  }
 
+  // the sources are smeared in tiles, with each application of the
+  // Laplace operator applied to the whole tile at once
+  const int tile = std::min(n_src, static_cast<int>(get_max_multi_rhs()));
   cudaParam.create = QUDA_NULL_FIELD_CREATE;
-  ColorSpinorField out(cudaParam);
+  std::vector<ColorSpinorField> in(tile, cudaParam), out(tile, cudaParam);
   int parity = 0;
 
   // Computes out(x) = 1/(1+6*alpha)*(in(x) + alpha*\sum_mu (U_{-\mu}(x)in(x+mu) + U^\dagger_mu(x-mu)in(x-mu)))
@@ -4992,25 +5060,33 @@ void performWuppertalnStep(void *h_out, void *h_in, QudaInvertParam *inv_param,
     if (i == 3) comm_dim[i] = 0;
   }
 
-  for (unsigned int i = 0; i < n_steps; i++) {
-    if (i) in = out;
-    ApplyLaplace(out, in, *precise, 3, a, b, in, parity, comm_dim, profileWuppertal);
-    logQuda(QUDA_DEBUG_VERBOSE, "Step %d, vector norm %e\n", i, blas::norm2(out));
-  }
+  for (int j = 0; j < n_src; j += tile) {
+    auto tile_j = std::min(tile, n_src - j); // handle remainder here
+    for (auto k = 0; k < tile_j; k++) in[k] = in_h[j + k];
+    logQuda(QUDA_DEBUG_VERBOSE, "In CPU %e CUDA %e\n", blas::norm2(in_h[j]), blas::norm2(in[0]));
 
-  cpuParam.v = h_out;
-  cpuParam.location = inv_param->output_location;
-  ColorSpinorField out_h(cpuParam);
-  out_h = out;
+    for (unsigned int i = 0; i < n_steps; i++) {
+      if (i) std::swap(in, out);
+      ApplyLaplace({out.begin(), out.begin() + tile_j}, {in.begin(), in.begin() + tile_j}, *precise, 3, a, b,
+                   {in.begin(), in.begin() + tile_j}, parity, comm_dim, profileWuppertal);
+      logQuda(QUDA_DEBUG_VERBOSE, "Step %d, vector norm %e\n", i, blas::norm2(out[0]));
+    }
 
-  logQuda(QUDA_DEBUG_VERBOSE, "Out CPU %e CUDA %e\n", blas::norm2(out_h), blas::norm2(out));
+    for (auto k = 0; k < tile_j; k++) out_h[j + k] = out[k];
+    logQuda(QUDA_DEBUG_VERBOSE, "Out CPU %e CUDA %e\n", blas::norm2(out_h[j]), blas::norm2(out[0]));
+  }
 
   if (gaugeSmeared != nullptr) delete precise;
 
   popVerbosity();
 }
 
-void performTwoLinkGaussianSmearNStep(void *h_in, QudaQuarkSmearParam *smear_param)
+void performWuppertalnStep(void *h_out, void *h_in, QudaInvertParam *inv_param, unsigned int n_steps, double alpha)
+{
+  performWuppertalnStepMultiSrc(&h_out, &h_in, 1, inv_param, n_steps, alpha);
+}
+
+void performTwoLinkGaussianSmearNStepMultiSrc(void **h_in, int n_src, QudaQuarkSmearParam *smear_param)
 {
   if (smear_param->n_steps == 0) return;
   auto profile = pushProfile(profileGaussianSmear, smear_param);
@@ -5018,6 +5094,7 @@ void performTwoLinkGaussianSmearNStep(void *h_in, QudaQuarkSmearParam *smear_par
   QudaInvertParam *inv_param = smear_param->inv_param;
 
   if (gaugePrecise == nullptr) errorQuda("Gauge field must be loaded");
+  if (n_src < 1) errorQuda("Invalid number of sources %d", n_src);
 
   if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printQudaInvertParam(inv_param);
   checkInvertParam(inv_param);
@@ -5055,18 +5132,24 @@ void performTwoLinkGaussianSmearNStep(void *h_in, QudaQuarkSmearParam *smear_par
 
   inv_param->dslash_type = QUDA_ASQTAD_DSLASH;
 
-  ColorSpinorParam cpuParam(h_in, *inv_param, X, QUDA_MAT_SOLUTION, QUDA_CPU_FIELD_LOCATION);
+  ColorSpinorParam cpuParam(h_in[0], *inv_param, X, QUDA_MAT_SOLUTION, QUDA_CPU_FIELD_LOCATION);
   cpuParam.nSpin = 1;
-  // QUDA style pointer for host data.
-  ColorSpinorField in_h(cpuParam);
+  // QUDA style pointers for host data.
+  std::vector<ColorSpinorField> in_h(n_src);
+  for (int i = 0; i < n_src; i++) {
+    cpuParam.v = h_in[i];
+    in_h[i] = ColorSpinorField(cpuParam);
+  }
 
-  // Device side data.
+  // Device side data, smeared in tiles with each application of the
+  // smearing operator applied to the whole tile at once
+  const int tile = std::min(n_src, static_cast<int>(get_max_multi_rhs()));
   ColorSpinorParam cudaParam(cpuParam);
   cudaParam.location = QUDA_CUDA_FIELD_LOCATION;
   cudaParam.create   = QUDA_ZERO_FIELD_CREATE;
   cudaParam.setPrecision(inv_param->cuda_prec, inv_param->cuda_prec, true);
-  ColorSpinorField in(cudaParam);
-  ColorSpinorField out(cudaParam);
+  std::vector<ColorSpinorField> in(tile, cudaParam);
+  std::vector<ColorSpinorField> out(tile, cudaParam);
 
   // Create the smearing operator
   //------------------------------------------------------
@@ -5096,34 +5179,115 @@ void performTwoLinkGaussianSmearNStep(void *h_in, QudaQuarkSmearParam *smear_par
   Dirac &dirac = *d;
   DiracM qsmear_op(dirac);
 
-  // Copy host data to device
-  in = in_h;
-
   const double ftmp    = -(smear_param->width*smear_param->width)/(4.0*smear_param->n_steps*4.0);  /* Extra 4 to compensate for stride 2 */
   // Scale up the source to prevent underflow
-  profileGaussianSmear.TPSTART(QUDA_PROFILE_COMPUTE);
-
   const double msq = 1. / ftmp;
   const double a       = inv_param->laplace3D * 2.0 + msq;
   const QudaParity  parity   = QUDA_INVALID_PARITY;
-  for (int i = 0; i < smear_param->n_steps; i++) {
-    if (i > 0) std::swap(in, out);
 
-    qsmear_op.Expose()->SmearOp(out, in, a, 0.0, smear_param->t0, parity);
-    logQuda(QUDA_DEBUG_VERBOSE, "Step %d, vector norm %e\n", i, blas::norm2(out));
-    blas::axpby(a * ftmp, in, -ftmp, out);
-  }
+  for (int j = 0; j < n_src; j += tile) {
+    auto tile_j = std::min(tile, n_src - j); // handle remainder here
+
+    // Copy host data to device
+    for (auto k = 0; k < tile_j; k++) in[k] = in_h[j + k];
+
+    profileGaussianSmear.TPSTART(QUDA_PROFILE_COMPUTE);
+
+    for (int i = 0; i < smear_param->n_steps; i++) {
+      if (i > 0) std::swap(in, out);
+      vector_ref<ColorSpinorField> in_j {in.begin(), in.begin() + tile_j};
+      vector_ref<ColorSpinorField> out_j {out.begin(), out.begin() + tile_j};
 
-  profileGaussianSmear.TPSTOP(QUDA_PROFILE_COMPUTE);
+      qsmear_op.Expose()->SmearOp(out_j, in_j, a, 0.0, smear_param->t0, parity);
+      logQuda(QUDA_DEBUG_VERBOSE, "Step %d, vector norm %e\n", i, blas::norm2(out[0]));
+      blas::axpby(a * ftmp, in_j, -ftmp, out_j);
+    }
+
+    profileGaussianSmear.TPSTOP(QUDA_PROFILE_COMPUTE);
 
-  // Copy device data to host.
-  in_h = out;
+    // Copy device data to host.
+    for (auto k = 0; k < tile_j; k++) in_h[j + k] = out[k];
+  }
 
   delete d;
 
   if (smear_param->delete_2link != 0) { freeUniqueGaugeQuda(QUDA_SMEARED_LINKS); }
 }
 
+void performTwoLinkGaussianSmearNStep(void *h_in, QudaQuarkSmearParam *smear_param)
+{
+  performTwoLinkGaussianSmearNStepMultiSrc(&h_in, 1, smear_param);
+}
+
+/**
+   @brief Whether the observables measured during smearing or flow
+   are all scalars, and so can be stored with a cached result
+   @param[in] obs_param The observables
+   @param[in] n_meas The number of measurements
+*/
+static bool cacheableObservables(const QudaGaugeObservableParam *obs_param, int n_meas)
+{
+  for (int i = 0; i < n_meas; i++)
+    if (obs_param[i].compute_gauge_loop_trace || obs_param[i].compute_qcharge_density) return false;
+  return true;
+}
+
+/**
+   @brief Compute the cache key for smearing or flowing the resident
+   gauge field, from the checksum of the gauge field together with
+   the smearing parameters and the observables requested, since a
+   projection onto SU(3) for measurement changes the result
+   @param[in] kind The derivation
+   @param[in] smear_param The smearing parameters
+   @param[in] obs_param The observables
+   @param[in] n_meas The number of measurements
+*/
+static gauge_cache::Key smearCacheKey(const char *kind, const QudaGaugeSmearParam *smear_param,
+                                      const QudaGaugeObservableParam *obs_param, int n_meas)
+{
+  gauge_cache::Hash hash;
+  hash(smear_param->smear_type)(smear_param->n_steps)(smear_param->meas_interval)(smear_param->epsilon);
+  hash(smear_param->alpha)(smear_param->rho)(smear_param->alpha1)(smear_param->alpha2)(smear_param->alpha3);
+  hash(smear_param->t0)(smear_param->dir_ignore)(smear_param->tol)(smear_param->n_meas_t);
+  if (smear_param->n_meas_t > 0 && smear_param->meas_t) hash.add(smear_param->meas_t, smear_param->n_meas_t);
+  hash(gaugeSmeared->R())(gaugePrecise->Precision())(gaugePrecise->Reconstruct());
+  for (int i = 0; i < n_meas; i++) {
+    hash(obs_param[i].su_project)(obs_param[i].compute_plaquette)(obs_param[i].compute_polyakov_loop);
+    hash(obs_param[i].compute_qcharge)(obs_param[i].remove_staggered_phase);
+  }
+  return {kind, gauge_cache::checksum(*gaugePrecise), hash.value()};
+}
+
+/**
+   @brief Pack the scalar observables for storage in the cache
+*/
+static std::vector<double> packObservables(const QudaGaugeObservableParam *obs_param, int n_meas)
+{
+  std::vector<double> aux;
+  for (int i = 0; i < n_meas; i++) {
+    aux.insert(aux.end(), obs_param[i].plaquette, obs_param[i].plaquette + 3);
+    aux.insert(aux.end(), obs_param[i].energy, obs_param[i].energy + 3);
+    aux.insert(aux.end(), obs_param[i].ploop, obs_param[i].ploop + 2);
+    aux.push_back(obs_param[i].qcharge);
+  }
+  return aux;
+}
+
+/**
+   @brief Unpack the scalar observables stored in the cache
+*/
+static void unpackObservables(QudaGaugeObservableParam *obs_param, int n_meas, const std::vector<double> &aux)
+{
+  auto it = aux.begin();
+  for (int i = 0; i < n_meas; i++) {
+    std::copy(it, it + 3, obs_param[i].plaquette);
+    std::copy(it + 3, it + 6, obs_param[i].energy);
+    std::copy(it + 6, it + 8, obs_param[i].ploop);
+    obs_param[i].qcharge = *(it + 8);
+    it += 9;
+  }
+}
+
 void performGaugeSmearQuda(QudaGaugeSmearParam *smear_param, QudaGaugeObservableParam *obs_param)
 {
   auto profile = pushProfile(profileGaugeSmear);
@@ -5131,18 +5295,6 @@ void performGaugeSmearQuda(QudaGaugeSmearParam *smear_param, QudaGaugeObservable
   checkGaugeSmearParam(smear_param);
 
   if (gaugePrecise == nullptr) errorQuda("Precise gauge field must be loaded");
-  freeUniqueGaugeQuda(QUDA_SMEARED_LINKS);
-  gaugeSmeared = createExtendedGauge(*gaugePrecise, R, profileGaugeSmear);
-
-  GaugeFieldParam gParam(*gaugeSmeared);
-  gParam.location = QUDA_CUDA_FIELD_LOCATION;
-  GaugeField tmp(gParam);
-
-  int measurement_n = 0; // The nth measurement to take
-  gaugeObservablesQuda(&obs_param[measurement_n]);
-  logQuda(QUDA_SUMMARIZE, "step %03d plaquette (mean %.16e, spatial %.16e temporal %.16e) Q charge = %.16e\n", 0,
-          obs_param[measurement_n].plaquette[0], obs_param[measurement_n].plaquette[1],
-          obs_param[measurement_n].plaquette[2], obs_param[measurement_n].qcharge);
 
   // set default dir_ignore = 3 for APE and STOUT for compatibility
   int dir_ignore = smear_param->dir_ignore;
@@ -5151,31 +5303,185 @@ void performGaugeSmearQuda(QudaGaugeSmearParam *smear_param, QudaGaugeObservable
     dir_ignore = 3;
   }
 
-  for (unsigned int i = 0; i < smear_param->n_steps; i++) {
-    switch (smear_param->smear_type) {
-    case QUDA_GAUGE_SMEAR_APE: APEStep(*gaugeSmeared, tmp, smear_param->alpha, dir_ignore); break;
-    case QUDA_GAUGE_SMEAR_STOUT: STOUTStep(*gaugeSmeared, tmp, smear_param->rho, dir_ignore); break;
-    case QUDA_GAUGE_SMEAR_OVRIMP_STOUT:
-      OvrImpSTOUTStep(*gaugeSmeared, tmp, smear_param->rho, smear_param->epsilon, dir_ignore);
-      break;
-    case QUDA_GAUGE_SMEAR_HYP:
-      HYPStep(*gaugeSmeared, tmp, smear_param->alpha1, smear_param->alpha2, smear_param->alpha3, dir_ignore);
-      break;
-    default: errorQuda("Unknown gauge smear type %d", smear_param->smear_type);
+  // with steps_per_exchange set, widen the extended region so that
+  // each halo exchange is followed by steps_per_exchange steps
+  lat_dim_t R_smear = R;
+  if (smear_param->steps_per_exchange > 0) {
+    int radius = gaugeSmearRadius(smear_param->smear_type, dir_ignore);
+    for (int d = 0; d < 4; d++) R_smear[d] = R[d] > 0 ? smear_param->steps_per_exchange * radius : 0;
+  }
+
+  freeUniqueGaugeQuda(QUDA_SMEARED_LINKS);
+  gaugeSmeared = createExtendedGauge(*gaugePrecise, R_smear, profileGaugeSmear);
+
+  const int n_meas = smear_param->n_steps / smear_param->meas_interval + 1;
+  const bool cache = gauge_cache::enabled() && cacheableObservables(obs_param, n_meas);
+  gauge_cache::Key key;
+  if (cache) {
+    key = smearCacheKey("smear", smear_param, obs_param, n_meas);
+    std::vector<double> aux;
+    if (gauge_cache::lookup(key, {gaugeSmeared}, &aux)) {
+      unpackObservables(obs_param, n_meas, aux);
+      logQuda(QUDA_VERBOSE, "Using cached smeared gauge field\n");
+      popOutputPrefix();
+      return;
     }
+  }
 
-    if ((i + 1) % smear_param->meas_interval == 0) {
-      measurement_n++;
-      gaugeObservablesQuda(&obs_param[measurement_n]);
-      logQuda(QUDA_SUMMARIZE, "step %03d plaquette (mean %.16e, spatial %.16e temporal %.16e) Q charge = %.16e\n",
-              i + 1, obs_param[measurement_n].plaquette[0], obs_param[measurement_n].plaquette[1],
-              obs_param[measurement_n].plaquette[2], obs_param[measurement_n].qcharge);
+  int measurement_n = 0; // The nth measurement to take
+  auto measure = [&](unsigned int step) {
+    gaugeObservablesQuda(&obs_param[measurement_n]);
+    logQuda(QUDA_SUMMARIZE, "step %03d plaquette (mean %.16e, spatial %.16e temporal %.16e) Q charge = %.16e\n", step,
+            obs_param[measurement_n].plaquette[0], obs_param[measurement_n].plaquette[1],
+            obs_param[measurement_n].plaquette[2], obs_param[measurement_n].qcharge);
+  };
+  measure(0);
+
+  if (smear_param->steps_per_exchange > 0) {
+    // gaugeSmear ping-pongs between gaugeSmeared and tmp, leaving the result in gaugeSmeared
+    GaugeFieldParam gParam(*gaugeSmeared);
+    GaugeField tmp(gParam);
+
+    for (unsigned int i = 0; i < smear_param->n_steps;) {
+      unsigned int n = std::min(smear_param->meas_interval - i % smear_param->meas_interval, smear_param->n_steps - i);
+      gaugeSmear(*gaugeSmeared, tmp, *smear_param, n, dir_ignore);
+      i += n;
+
+      // gaugeSmear leaves the halo stale, and exchanges it itself
+      // before the next chunk, so only refresh it for a measurement
+      // or the final result
+      bool meas = i % smear_param->meas_interval == 0;
+      if (meas || i == smear_param->n_steps) gaugeSmeared->exchangeExtendedGhost(gaugeSmeared->R(), false);
+      if (meas) {
+        measurement_n++;
+        measure(i);
+      }
+    }
+  } else {
+    GaugeFieldParam gParam(*gaugeSmeared);
+    gParam.location = QUDA_CUDA_FIELD_LOCATION;
+    GaugeField tmp(gParam);
+
+    for (unsigned int i = 0; i < smear_param->n_steps; i++) {
+      switch (smear_param->smear_type) {
+      case QUDA_GAUGE_SMEAR_APE: APEStep(*gaugeSmeared, tmp, smear_param->alpha, dir_ignore); break;
+      case QUDA_GAUGE_SMEAR_STOUT: STOUTStep(*gaugeSmeared, tmp, smear_param->rho, dir_ignore); break;
+      case QUDA_GAUGE_SMEAR_OVRIMP_STOUT:
+        OvrImpSTOUTStep(*gaugeSmeared, tmp, smear_param->rho, smear_param->epsilon, dir_ignore);
+        break;
+      case QUDA_GAUGE_SMEAR_HYP:
+        HYPStep(*gaugeSmeared, tmp, smear_param->alpha1, smear_param->alpha2, smear_param->alpha3, dir_ignore);
+        break;
+      default: errorQuda("Unknown gauge smear type %d", smear_param->smear_type);
+      }
+
+      if ((i + 1) % smear_param->meas_interval == 0) {
+        measurement_n++;
+        measure(i + 1);
+      }
     }
   }
 
+  if (cache) gauge_cache::insert(key, {gaugeSmeared}, packObservables(obs_param, n_meas));
+
   popOutputPrefix();
 }
 
+/**
+   @brief Integrate the Wilson/Symanzik flow with an adaptive step
+   size.  Each step uses the three-stage integrator of
+   https://arxiv.org/abs/1006.4518v3, with the local error estimated
+   from the embedded second-order integrator that shares its first two
+   stages (https://arxiv.org/abs/1301.4388).  Steps whose error exceeds
+   the tolerance are rejected and retried with a smaller step, and the
+   step size is chosen to land exactly on each measurement time.  A
+   non-finite error estimate, too many consecutive rejections, or a
+   step that shrinks below 1e-10 of the initial step are fatal.
+   @param[in,out] in The field we are flowing, on exit the flowed field
+   @param[in] out Temporary extended field
+   @param[in] temp Temporary field
+   @param[in] smear_param The flow parameters
+   @param[out] obs_param The observables at t0 followed by each measurement time
+*/
+static void adaptiveWFlow(GaugeField &in, GaugeField &out, GaugeField &temp, QudaGaugeSmearParam *smear_param,
+                          QudaGaugeObservableParam *obs_param)
+{
+  // step-size controller parameters for a third-order method
+  constexpr double safety = 0.95;
+  constexpr double min_scale = 0.2;
+  constexpr double max_scale = 5.0;
+  // give up rather than shrink the step size indefinitely
+  constexpr int max_consecutive_reject = 32;
+  const double min_epsilon = 1e-10 * smear_param->epsilon;
+
+  if (smear_param->epsilon <= 0.0) errorQuda("Adaptive flow requires a positive initial step size %e", smear_param->epsilon);
+
+  std::vector<double> meas_t;
+  if (smear_param->n_meas_t > 0) {
+    if (!smear_param->meas_t) errorQuda("Measurement times not set");
+    for (auto i = 0u; i < smear_param->n_meas_t; i++) {
+      if (smear_param->meas_t[i] <= (i == 0 ? smear_param->t0 : smear_param->meas_t[i - 1]))
+        errorQuda("Measurement times must be increasing and greater than t0");
+      meas_t.push_back(smear_param->meas_t[i]);
+    }
+  } else {
+    if (smear_param->meas_interval == 0) errorQuda("Invalid measurement interval");
+    for (auto i = smear_param->meas_interval; i <= smear_param->n_steps; i += smear_param->meas_interval)
+      meas_t.push_back(smear_param->t0 + i * smear_param->epsilon);
+  }
+
+  GaugeFieldParam param(temp);
+  GaugeField embedded(param); // the embedded solution and then the local error
+  GaugeFieldParam paramEx(in);
+  GaugeField backup(paramEx); // the input field in case a step is rejected
+
+  double t = smear_param->t0;
+  double epsilon = smear_param->epsilon;
+  int n_accept = 0;
+  int n_reject = 0;
+  int n_consecutive_reject = 0;
+
+  for (auto m = 0u; m < meas_t.size(); m++) {
+    while (t < meas_t[m]) {
+      bool last = epsilon >= meas_t[m] - t;
+      double h = last ? meas_t[m] - t : epsilon;
+
+      // the W2 stage overwrites the input, so keep it in case the step is rejected
+      backup.copy(in);
+      double err = WFlowStep(out, temp, embedded, in, h, smear_param->smear_type);
+      if (!std::isfinite(err)) errorQuda("Non-finite local error estimate %e at t = %e with step %e", err, t, h);
+      double scale = err > 0.0 ? std::clamp(safety * std::cbrt(smear_param->tol / err), min_scale, max_scale) : max_scale;
+
+      logQuda(QUDA_DEBUG_VERBOSE, "t = %e step = %e error = %e %s\n", t, h, err,
+              err <= smear_param->tol ? "accepted" : "rejected");
+
+      if (err <= smear_param->tol) {
+        t = last ? meas_t[m] : t + h;
+        std::swap(in, out); // accepted output becomes input for next step
+        // a step shortened to land on a measurement time is no guide to the step size
+        epsilon = last ? std::max(epsilon, h * scale) : h * scale;
+        n_accept++;
+        n_consecutive_reject = 0;
+      } else {
+        in.copy(backup);
+        in.exchangeExtendedGhost(in.R(), false);
+        epsilon = h * scale;
+        n_reject++;
+        if (++n_consecutive_reject > max_consecutive_reject || epsilon < min_epsilon)
+          errorQuda("Adaptive flow failed to meet tolerance %e at t = %e after %d rejected steps (step = %e)",
+                    smear_param->tol, t, n_consecutive_reject, epsilon);
+      }
+    }
+
+    gaugeObservables(in, obs_param[m + 1]);
+    logQuda(QUDA_SUMMARIZE, "%le %.16e %+.16e %+.16e %+.16e %+.16e\n", t, obs_param[m + 1].plaquette[0],
+            obs_param[m + 1].energy[0], obs_param[m + 1].energy[1], obs_param[m + 1].energy[2],
+            obs_param[m + 1].qcharge);
+  }
+
+  logQuda(QUDA_VERBOSE, "Adaptive flow to t = %e took %d accepted and %d rejected steps\n", t, n_accept, n_reject);
+}
+
 void performWFlowQuda(QudaGaugeSmearParam *smear_param, QudaGaugeObservableParam *obs_param)
 {
   auto profile = pushProfile(profileWFlow);
@@ -5190,6 +5496,24 @@ void performWFlowQuda(QudaGaugeSmearParam *smear_param, QudaGaugeObservableParam
     gaugeSmeared = createExtendedGauge(*gaugePrecise, R, profileWFlow);
   }
 
+  // a restarted flow starts from gaugeSmeared, so only cache flows of the resident field
+  const int n_meas
+    = (smear_param->tol > 0.0 && smear_param->n_meas_t > 0 ? smear_param->n_meas_t :
+                                                              smear_param->n_steps / smear_param->meas_interval)
+    + 1;
+  const bool cache = gauge_cache::enabled() && !smear_param->restart && cacheableObservables(obs_param, n_meas);
+  gauge_cache::Key key;
+  if (cache) {
+    key = smearCacheKey("wflow", smear_param, obs_param, n_meas);
+    std::vector<double> aux;
+    if (gauge_cache::lookup(key, {gaugeSmeared}, &aux)) {
+      unpackObservables(obs_param, n_meas, aux);
+      logQuda(QUDA_VERBOSE, "Using cached flowed gauge field\n");
+      popOutputPrefix();
+      return;
+    }
+  }
+
   GaugeFieldParam gParamEx(*gaugeSmeared);
   GaugeField gaugeAux(gParamEx);
 
@@ -5208,6 +5532,14 @@ void performWFlowQuda(QudaGaugeSmearParam *smear_param, QudaGaugeObservableParam
   logQuda(QUDA_SUMMARIZE, "%le %.16e %+.16e %+.16e %+.16e %+.16e\n", smear_param->t0, obs_param[0].plaquette[0],
           obs_param[0].energy[0], obs_param[0].energy[1], obs_param[0].energy[2], obs_param[0].qcharge);
 
+  if (smear_param->tol > 0.0) {
+    adaptiveWFlow(in, out, gaugeTemp, smear_param, obs_param);
+    // the flowed field is left in gaugeSmeared so WFlow can be restarted
+    if (cache) gauge_cache::insert(key, {gaugeSmeared}, packObservables(obs_param, n_meas));
+    popOutputPrefix();
+    return;
+  }
+
   for (unsigned int i = 0; i < smear_param->n_steps; i++) {
     // Perform W1, W2, and Vt Wilson Flow steps as defined in
     // https://arxiv.org/abs/1006.4518v3
@@ -5226,6 +5558,8 @@ void performWFlowQuda(QudaGaugeSmearParam *smear_param, QudaGaugeObservableParam
   copyExtendedGauge(*gaugeSmeared, out, QUDA_CUDA_FIELD_LOCATION);
   gaugeSmeared->exchangeExtendedGhost( gaugeSmeared->R() );
 
+  if (cache) gauge_cache::insert(key, {gaugeSmeared}, packObservables(obs_param, n_meas));
+
   popOutputPrefix();
 }
 
@@ -5561,6 +5895,79 @@ void contractFTQuda(void **prop_array_flavor_1, void **prop_array_flavor_2, void
   profileContractFT.TPSTOP(QUDA_PROFILE_COMPUTE);
 }
 
+void contractFTMultiQuda(void **prop_array_flavor_1, int n_prop_1, void **prop_array_flavor_2, int n_prop_2,
+                         void *result, const QudaContractType cType, void *cs_param_ptr, const int *X,
+                         const int *const source_position, const int n_mom, const int *const mom_modes,
+                         const QudaFFTSymmType *const fft_type, const int n_gamma, const double *gamma,
+                         QudaFieldLocation location)
+{
+  auto profile = pushProfile(profileContractFT);
+
+  // create ColorSpinorFields from void** and parameter
+  auto cs_param = (ColorSpinorParam *)cs_param_ptr;
+  const int nSpin = cs_param->nSpin;
+  cs_param->location = QUDA_CPU_FIELD_LOCATION;
+  cs_param->create = QUDA_REFERENCE_FIELD_CREATE;
+  for (int d = 0; d < 4; d++)
+    if (cs_param->x[d] != X[d]) errorQuda("Field dimension %d = %d does not match X = %d", d, cs_param->x[d], X[d]);
+  if (n_gamma > 0 && !gamma) errorQuda("n_gamma = %d gamma matrices requested but none given", n_gamma);
+
+  // wrap CPU host side pointers
+  std::vector<ColorSpinorField> h_prop1, h_prop2;
+  h_prop1.reserve(n_prop_1);
+  h_prop2.reserve(n_prop_2);
+  for (int i = 0; i < n_prop_1; i++) {
+    cs_param->v = prop_array_flavor_1[i];
+    h_prop1.push_back(ColorSpinorField(*cs_param));
+  }
+  for (int i = 0; i < n_prop_2; i++) {
+    cs_param->v = prop_array_flavor_2[i];
+    h_prop2.push_back(ColorSpinorField(*cs_param));
+  }
+
+  // native-order fields at the execution location
+  ColorSpinorParam param(*cs_param);
+  param.create = QUDA_NULL_FIELD_CREATE;
+  param.location = location;
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS; // not relevant for staggered
+  param.setPrecision(cs_param->Precision(), cs_param->Precision(), true);
+
+  std::vector<ColorSpinorField> prop1, prop2;
+  prop1.reserve(n_prop_1);
+  prop2.reserve(n_prop_2);
+  for (int i = 0; i < n_prop_1; i++) {
+    prop1.push_back(ColorSpinorField(param));
+    prop1[i] = h_prop1[i];
+  }
+  for (int i = 0; i < n_prop_2; i++) {
+    prop2.push_back(ColorSpinorField(param));
+    prop2[i] = h_prop2[i];
+  }
+
+  std::vector<Complex> open;
+  contractFTMultiQuda(open, prop1, prop2, cType, source_position, n_mom, mom_modes, fft_type);
+
+  // project the open spin matrices onto the requested gamma structures
+  const size_t nSpinSq = nSpin * nSpin;
+  auto h_result = static_cast<double *>(result);
+  for (size_t k = 0; k < open.size() / nSpinSq; k++) {
+    if (n_gamma == 0) {
+      for (size_t s = 0; s < nSpinSq; s++) {
+        h_result[2 * (k * nSpinSq + s) + 0] = open[k * nSpinSq + s].real();
+        h_result[2 * (k * nSpinSq + s) + 1] = open[k * nSpinSq + s].imag();
+      }
+    } else {
+      for (int g = 0; g < n_gamma; g++) {
+        Complex sum = 0.0;
+        for (size_t s = 0; s < nSpinSq; s++)
+          sum += Complex(gamma[2 * (g * nSpinSq + s) + 0], gamma[2 * (g * nSpinSq + s) + 1]) * open[k * nSpinSq + s];
+        h_result[2 * (k * n_gamma + g) + 0] = sum.real();
+        h_result[2 * (k * n_gamma + g) + 1] = sum.imag();
+      }
+    }
+  }
+}
+
 void contractQuda(const void *hp_x, const void *hp_y, void *h_result, const QudaContractType cType,
                   QudaInvertParam *param, const int *X)
 {
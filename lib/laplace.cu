@@ -21,7 +21,7 @@ namespace quda
 
   template <typename Arg> class Laplace : public Dslash<laplace, Arg>
   {
-    using Dslash = Dslash<laplace, Arg>;
+    using Dslash = quda::Dslash<laplace, Arg>;
     using Dslash::arg;
     using Dslash::halo;
     using Dslash::in;
@@ -146,7 +146,32 @@ namespace quda {
             tp.block.x /= tp.aux.x; // restore block size
           }
         } else {
-          errorQuda("Only implemented for GPU fields");
+          if (checkOrder(x[0], y[0], z[0], w[0]) != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+            errorQuda("CPU Blas functions expect AoS field order");
+
+          using host_store_t = typename host_type_mapper<store_t>::type;
+          using host_y_store_t = typename host_type_mapper<y_store_t>::type;
+          using host_real_t = typename mapper<host_y_store_t>::type;
+          Functor<host_real_t> f_(NXZ, NYW);
+
+          // redefine site_unroll with host_store types to ensure we have correct N/Ny/M values
+          constexpr bool site_unroll = !std::is_same<host_store_t, host_y_store_t>::value || isFixed<host_store_t>::value;
+          constexpr int N = n_vector<host_store_t, false, nSpin, site_unroll>();
+          constexpr int Ny = n_vector<host_y_store_t, false, nSpin, site_unroll>();
+          constexpr int M = N; // if site unrolling then M=N will be 24/6, e.g., full AoS
+          const int length = x[0].Length() / (nParity * M);
+
+          using Arg = MultiBlasArg<1, host_real_t, M, NXZ, host_store_t, N, host_y_store_t, Ny, decltype(f_)>;
+          Arg arg(x, y, z, w, f_, NYW, length);
+          constexpr bool multi_1d = Arg::Functor::multi_1d;
+          if (a.size()) { set_param<multi_1d>(arg, 'a', a); }
+          if (b.size()) { set_param<multi_1d>(arg, 'b', b); }
+          if (c.size()) { set_param<multi_1d>(arg, 'c', c); }
+
+          // the host functor processes a tile of NYW vectors per y index
+          constexpr int tile = MultiBlasHost_<Arg>::tile;
+          arg.threads.y = (NYW + tile - 1) / tile;
+          Kernel3D_host<MultiBlasHost_>(arg);
         }
       }
 
@@ -208,6 +233,11 @@ namespace quda {
         }
       }
 
+      bool advanceTuneParam(TuneParam &param) const override
+      {
+        return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
+      }
+
       bool advanceAux(TuneParam &param) const override
       {
         if (enable_warp_split()) {
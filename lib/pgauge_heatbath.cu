@@ -41,10 +41,23 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      if (heatbath) {
-        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, true>(U, beta, rng.State(), mu, parity));
+      if (U.Location() == QUDA_CPU_FIELD_LOCATION) {
+        // each site draws from its own host MRG32k3a stream
+        constexpr bool enable_host = true;
+        using State = HostRNGState;
+        if (heatbath) {
+          launch<HB, enable_host>(tp, stream,
+                                  MonteArg<Float, nColor, recon, true, State>(U, beta, rng.HostState(), mu, parity));
+        } else {
+          launch<HB, enable_host>(tp, stream,
+                                  MonteArg<Float, nColor, recon, false, State>(U, beta, nullptr, mu, parity));
+        }
       } else {
-        launch<HB>(tp, stream, MonteArg<Float, nColor, recon, false>(U, beta, rng.State(), mu, parity));
+        if (heatbath) {
+          launch<HB>(tp, stream, MonteArg<Float, nColor, recon, true>(U, beta, rng.State(), mu, parity));
+        } else {
+          launch<HB>(tp, stream, MonteArg<Float, nColor, recon, false>(U, beta, rng.State(), mu, parity));
+        }
       }
     }
 
@@ -151,6 +164,10 @@ namespace quda {
    */
   void Monte(GaugeField& data, RNG &rngstate, double Beta, int nhb, int nover)
   {
+    if (data.Location() != rngstate.Location())
+      errorQuda("Gauge field location %d does not match RNG location %d", data.Location(), rngstate.Location());
+    if (data.Location() == QUDA_CPU_FIELD_LOCATION && comm_partitioned())
+      errorQuda("Host heatbath not supported with partitioned communication");
     instantiate<MonteAlg>(data, rngstate, (float)Beta, nhb, nover);
   }
 
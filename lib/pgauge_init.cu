@@ -24,8 +24,9 @@ namespace quda {
 
     void apply(const qudaStream_t &stream)
     {
+      constexpr bool enable_host = true;
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<ColdStart>(tp, stream, InitGaugeColdArg<Float, nColor, recon>(U));
+      launch<ColdStart, enable_host>(tp, stream, InitGaugeColdArg<Float, nColor, recon>(U));
     }
 
     long long flops() const { return 0; }
@@ -52,7 +53,13 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch<HotStart>(tp, stream, InitGaugeHotArg<Float, nColors, recon>(U, rng.State()));
+      if (U.Location() == QUDA_CPU_FIELD_LOCATION) {
+        constexpr bool enable_host = true;
+        launch<HotStart, enable_host>(tp, stream,
+                                      InitGaugeHotArg<Float, nColors, recon, HostRNGState>(U, rng.HostState()));
+      } else {
+        launch<HotStart>(tp, stream, InitGaugeHotArg<Float, nColors, recon>(U, rng.State()));
+      }
     }
 
     void preTune() { rng.backup(); }
@@ -82,6 +89,8 @@ namespace quda {
    */
   void InitGaugeField(GaugeField& data, RNG &rngstate)
   {
+    if (data.Location() != rngstate.Location())
+      errorQuda("Gauge field location %d does not match RNG location %d", data.Location(), rngstate.Location());
     instantiate<InitGaugeHot>(data, rngstate);
   }
 
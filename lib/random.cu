@@ -1,3 +1,4 @@
+#include <cstring>
 #include <util_quda.h>
 #include <random_quda.h>
 #include <malloc_quda.h>
@@ -27,18 +28,32 @@ namespace quda {
     void apply(const qudaStream_t &stream)
     {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
-      launch_device<init_random>(tp, stream, rngArg(rng.State(), seed, meta));
+      if (rng.Location() == QUDA_CPU_FIELD_LOCATION) {
+        constexpr bool enable_host = true;
+        launch<init_random, enable_host>(tp, stream, rngArg<HostRNGState>(rng.HostState(), seed, meta));
+      } else {
+        launch_device<init_random>(tp, stream, rngArg<RNGState>(rng.State(), seed, meta));
+      }
     }
 
     long long flops() const { return 0; }
     long long bytes() const { return 0; }
   };
 
-  RNG::RNG(const LatticeField &meta, unsigned long long seedin) :
+  RNG::RNG(const LatticeField &meta, unsigned long long seedin, QudaFieldLocation location) :
     size(meta.LocalVolume()),
-    state((RNGState *)device_malloc(size * sizeof(RNGState)), [](RNGState *ptr){ device_free(ptr); } ),
+    location(location),
     seed(seedin)
   {
+    if (location == QUDA_CPU_FIELD_LOCATION) {
+      if (meta.Location() != QUDA_CPU_FIELD_LOCATION) errorQuda("Host RNG states require a host field");
+      host_state = std::shared_ptr<HostRNGState>(static_cast<HostRNGState *>(safe_malloc(Bytes())),
+                                                 [](HostRNGState *ptr) { host_free(ptr); });
+    } else {
+      state = std::shared_ptr<RNGState>(static_cast<RNGState *>(device_malloc(Bytes())),
+                                        [](RNGState *ptr) { device_free(ptr); });
+    }
+
 #if defined(XORWOW)
     if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Using randStateXORWOW\n");
 #elif defined(RG32k3a)
@@ -48,23 +63,33 @@ namespace quda {
 #endif
 
     if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
-      printfQuda("Allocated array of random numbers with size: %.2f MB\n",
-                 size * sizeof(RNGState) / (float)(1048576));
+      printfQuda("Allocated array of random numbers with size: %.2f MB\n", Bytes() / (float)(1048576));
 
     RNGInit(*this, meta, seed);
   }
 
+  size_t RNG::Bytes() const
+  {
+    return size * (location == QUDA_CPU_FIELD_LOCATION ? sizeof(HostRNGState) : sizeof(RNGState));
+  }
+
   /*! @brief Backup CURAND array states initialization */
   void RNG::backup()
   {
-    backup_state = (RNGState *)safe_malloc(size * sizeof(RNGState));
-    qudaMemcpy(backup_state, state.get(), size * sizeof(RNGState), qudaMemcpyDeviceToHost);
+    backup_state = safe_malloc(Bytes());
+    if (location == QUDA_CPU_FIELD_LOCATION)
+      memcpy(backup_state, host_state.get(), Bytes());
+    else
+      qudaMemcpy(backup_state, state.get(), Bytes(), qudaMemcpyDeviceToHost);
   }
 
   /*! @brief Restore CURAND array states initialization */
   void RNG::restore()
   {
-    qudaMemcpy(state.get(), backup_state, size * sizeof(RNGState), qudaMemcpyHostToDevice);
+    if (location == QUDA_CPU_FIELD_LOCATION)
+      memcpy(host_state.get(), backup_state, Bytes());
+    else
+      qudaMemcpy(state.get(), backup_state, Bytes(), qudaMemcpyHostToDevice);
     host_free(backup_state);
   }
 
@@ -1,5 +1,6 @@
 #include <color_spinor_field.h>
 #include <random_quda.h>
+#include <random_counter.h>
 #include <tunable_nd.h>
 #include <kernels/spinor_noise.cuh>
 #include <instantiate.h>
@@ -7,55 +8,64 @@
 
 namespace quda {
 
-  template <typename real, int Ns, int Nc>
+  template <typename real, int Ns, int Nc, typename Gen>
   class SpinorNoise : TunableKernel2D {
     ColorSpinorField &v;
-    RNG &rng;
+    Gen &rng;
     QudaNoiseType type;
+    static constexpr bool counter = std::is_same_v<Gen, CounterRNG>;
     unsigned int minThreads() const { return v.VolumeCB(); }
 
+    template <QudaNoiseType noise> void launch(TuneParam &tp, const qudaStream_t &stream)
+    {
+      if constexpr (counter) {
+        constexpr bool enable_host = true;
+        TunableKernel2D::launch<NoiseSpinor, enable_host>(tp, stream,
+                                                          SpinorNoiseArg<real, Ns, Nc, noise, CounterRNGState>(v, rng));
+      } else {
+        TunableKernel2D::launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, noise>(v, rng.State()));
+      }
+    }
+
   public:
-    SpinorNoise(ColorSpinorField &v, RNG &rng, QudaNoiseType type) :
+    SpinorNoise(ColorSpinorField &v, Gen &rng, QudaNoiseType type) :
       TunableKernel2D(v, v.SiteSubset()),
       v(v),
       rng(rng),
       type(type)
     {
       strcat(aux, type == QUDA_NOISE_GAUSS ? ",gauss" : ",uniform");
+      if (counter) strcat(aux, ",counter");
       apply(device::get_default_stream());
     }
 
     void apply(const qudaStream_t &stream) {
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       switch (type) {
-      case QUDA_NOISE_GAUSS:
-        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, QUDA_NOISE_GAUSS>(v, rng.State()));
-        break;
-      case QUDA_NOISE_UNIFORM:
-        launch<NoiseSpinor>(tp, stream, SpinorNoiseArg<real, Ns, Nc, QUDA_NOISE_UNIFORM>(v, rng.State()));
-        break;
+      case QUDA_NOISE_GAUSS: launch<QUDA_NOISE_GAUSS>(tp, stream); break;
+      case QUDA_NOISE_UNIFORM: launch<QUDA_NOISE_UNIFORM>(tp, stream); break;
       default: errorQuda("Noise type %d not implemented", type);
       }
     }
 
     long long bytes() const { return v.Bytes(); }
-    void preTune() { rng.backup(); }
-    void postTune(){ rng.restore(); }
+    void preTune() { if constexpr (!counter) rng.backup(); }
+    void postTune() { if constexpr (!counter) rng.restore(); }
   };
 
-  template <typename real, int Ns, int Nc, int...N>
-  void spinorNoise(ColorSpinorField &src, RNG& randstates, QudaNoiseType type, IntList<Nc, N...>)
+  template <typename real, int Ns, int Nc, int...N, typename Gen>
+  void spinorNoise(ColorSpinorField &src, Gen &randstates, QudaNoiseType type, IntList<Nc, N...>)
   {
     if (src.Ncolor() == Nc) {
-      SpinorNoise<real, Ns, Nc>(src, randstates, type);
+      SpinorNoise<real, Ns, Nc, Gen>(src, randstates, type);
     } else {
       if constexpr (sizeof...(N) > 0) spinorNoise<real, Ns>(src, randstates, type, IntList<N...>());
       else errorQuda("nColor = %d not implemented", src.Ncolor());
     }
   }
 
-  template <typename real>
-  void spinorNoise(ColorSpinorField &src, RNG& randstates, QudaNoiseType type)
+  template <typename real, typename Gen>
+  void spinorNoise(ColorSpinorField &src, Gen &randstates, QudaNoiseType type)
   {
     checkNative(src);
     if (!is_enabled_spin(src.Nspin()))
@@ -72,9 +82,12 @@ namespace quda {
     }
   }
 
-  void spinorNoise(ColorSpinorField &src_, RNG &randstates, QudaNoiseType type)
+  template <typename Gen> void spinor_noise(ColorSpinorField &src_, Gen &randstates, QudaNoiseType type)
   {
-    // if src is a CPU field then create GPU field
+    // if src is a CPU field then create GPU field, unless the
+    // counter-based generator is used, in which case the noise is
+    // generated on the host in native order
+    constexpr bool counter = std::is_same_v<Gen, CounterRNG>;
     ColorSpinorField src;
     ColorSpinorParam param(src_);
     bool copy_back = false;
@@ -82,7 +95,7 @@ namespace quda {
       QudaPrecision prec = std::max(src_.Precision(), QUDA_SINGLE_PRECISION);
       param.setPrecision(prec, prec, true); // change to native field order
       param.create = QUDA_NULL_FIELD_CREATE;
-      param.location = QUDA_CUDA_FIELD_LOCATION;
+      if (!counter) param.location = QUDA_CUDA_FIELD_LOCATION;
       src = ColorSpinorField(param);
       copy_back = true;
     } else {
@@ -90,18 +103,31 @@ namespace quda {
     }
 
     switch (src.Precision()) {
-    case QUDA_DOUBLE_PRECISION: spinorNoise<double>(src, randstates, type); break;
-    case QUDA_SINGLE_PRECISION: spinorNoise<float>(src, randstates, type); break;
+    case QUDA_DOUBLE_PRECISION: spinorNoise<double, Gen>(src, randstates, type); break;
+    case QUDA_SINGLE_PRECISION: spinorNoise<float, Gen>(src, randstates, type); break;
     default: errorQuda("Precision %d not implemented", src.Precision());
     }
 
     if (copy_back) src_ = src; // copy back if needed
   }
 
-  void spinorNoise(ColorSpinorField &src, unsigned long long seed, QudaNoiseType type)
+  void spinorNoise(ColorSpinorField &src, RNG &randstates, QudaNoiseType type) { spinor_noise(src, randstates, type); }
+
+  void spinorNoise(ColorSpinorField &src, CounterRNG &rng, QudaNoiseType type)
+  {
+    spinor_noise(src, rng, type);
+    rng.advance();
+  }
+
+  void spinorNoise(ColorSpinorField &src, unsigned long long seed, QudaNoiseType type, bool counter)
   {
-    RNG randstates(src, seed);
-    spinorNoise(src, randstates, type);
+    if (counter) {
+      CounterRNG rng(seed);
+      spinorNoise(src, rng, type);
+    } else {
+      RNG randstates(src, seed);
+      spinorNoise(src, randstates, type);
+    }
   }
 
 } // namespace quda
@@ -21,7 +21,7 @@ namespace quda
 
   template <typename Arg> class StaggeredQSmear : public Dslash<staggered_qsmear, Arg>
   {
-    using Dslash = Dslash<staggered_qsmear, Arg>;
+    using Dslash = quda::Dslash<staggered_qsmear, Arg>;
     using Dslash::arg;
     using Dslash::halo;
     using Dslash::in;
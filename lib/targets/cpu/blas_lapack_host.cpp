@@ -0,0 +1,34 @@
+#include <blas_lapack.h>
+
+namespace quda
+{
+
+  namespace blas_lapack
+  {
+
+    // The CPU target has no vendor library, so the native interface
+    // is served by the generic host implementation.
+
+    namespace native
+    {
+
+      void init() { generic::init(); }
+
+      void destroy() { generic::destroy(); }
+
+      long long BatchInvertMatrix(void *Ainv, void *A, const int n, const uint64_t batch, QudaPrecision prec,
+                                  QudaFieldLocation location)
+      {
+        return generic::BatchInvertMatrix(Ainv, A, n, batch, prec, location);
+      }
+
+      long long stridedBatchGEMM(void *A, void *B, void *C, QudaBLASParam blas_param, QudaFieldLocation location)
+      {
+        return generic::stridedBatchGEMM(A, B, C, blas_param, location);
+      }
+
+    } // namespace native
+
+  } // namespace blas_lapack
+
+} // namespace quda
@@ -0,0 +1,118 @@
+#include <limits>
+#include <omp.h>
+#include <util_quda.h>
+#include <quda_internal.h>
+#include <target_device.h>
+#include <shared_memory_helper.h>
+
+static const int Nstream = 9;
+
+namespace quda
+{
+
+  namespace device
+  {
+
+    static bool initialized = false;
+
+    static int device_id = -1;
+
+    void init(int dev)
+    {
+      if (initialized) return;
+      initialized = true;
+      printfQuda("*** CPU BACKEND ***\n");
+      printfQuda("OpenMP version = %d\n", _OPENMP);
+      if (getVerbosity() >= QUDA_SUMMARIZE) {
+        printfQuda("Using host %d with %d OpenMP threads\n", dev, omp_get_max_threads());
+      }
+
+      device_id = dev;
+    }
+
+    void init_thread()
+    {
+      if (device_id == -1) errorQuda("No CPU device has been initialized for this process");
+    }
+
+    void init_monitor() { }
+
+    // not implemented on CPU at present
+    state_t get_state() { return {}; }
+
+    int get_device_count()
+    {
+      // every process owns its own "device", so report an unbounded
+      // count to ensure all ranks on a node are assigned distinct ids
+      return std::numeric_limits<int>::max();
+    }
+
+    void get_visible_devices_string(char device_list_string[128]) { device_list_string[0] = '\0'; }
+
+    void print_device_properties()
+    {
+      printfQuda("%d - name:                    host (OpenMP)\n", device_id);
+      printfQuda("%d - maxThreads:              %d\n", device_id, omp_get_max_threads());
+      printfQuda("%d - sharedMemPerThread:      %lu\n", device_id, max_shared_memory_size());
+    }
+
+    void create_context() { }
+
+    void destroy() { }
+
+    qudaStream_t get_stream(unsigned int i)
+    {
+      if (i >= Nstream) errorQuda("Invalid stream index %u", i);
+      qudaStream_t stream;
+      stream.idx = i;
+      return stream;
+    }
+
+    qudaStream_t get_default_stream()
+    {
+      qudaStream_t stream;
+      stream.idx = Nstream - 1;
+      return stream;
+    }
+
+    unsigned int get_default_stream_idx() { return Nstream - 1; }
+
+    bool managed_memory_supported()
+    {
+      // all memory is host memory, so managed memory is trivially supported
+      return true;
+    }
+
+    bool shared_memory_atomic_supported() { return true; }
+
+    size_t max_default_shared_memory() { return max_shared_memory_size(); }
+
+    size_t max_dynamic_shared_memory() { return max_shared_memory_size(); }
+
+    // The host kernels iterate over the full thread space of a launch
+    // regardless of the launch geometry, so the block limits below only
+    // have to admit the geometries the tuning classes generate.
+    unsigned int max_threads_per_block() { return 1024; }
+
+    unsigned int max_threads_per_processor() { return 1024; }
+
+    unsigned int max_threads_per_block_dim(int i) { return i < 2 ? 1024 : 64; }
+
+    unsigned int max_grid_size(int) { return std::numeric_limits<int>::max(); }
+
+    unsigned int processor_count() { return omp_get_max_threads(); }
+
+    unsigned int max_blocks_per_processor() { return 1; }
+
+    namespace profile
+    {
+
+      void start() { }
+
+      void stop() { }
+
+    } // namespace profile
+
+  } // namespace device
+
+} // namespace quda
@@ -0,0 +1,206 @@
+#include <chrono>
+#include <cstring>
+#include <tune_quda.h>
+#include <quda_internal.h>
+#include <timer.h>
+#include <device.h>
+#include <target_device.h>
+
+// if this macro is defined then we profile the host API calls
+//#define API_PROFILE
+
+#ifdef API_PROFILE
+#define PROFILE(f, idx)                                                                                                \
+  apiTimer.TPSTART(idx);                                                                                               \
+  f;                                                                                                                   \
+  apiTimer.TPSTOP(idx);
+#else
+#define PROFILE(f, idx) f;
+#endif
+
+/**
+   @file quda_api.cpp
+
+   Host implementation of the QUDA runtime API.  On the CPU target
+   "device" memory is host memory and every stream is an in-order
+   queue that is drained at the point of issue: kernels already use
+   all OpenMP threads within each launch, so there is no concurrency
+   to be gained by deferring work to a stream worker.  As a
+   consequence every asynchronous call completes before returning,
+   events are simple timestamps and all synchronization is a no-op.
+ */
+
+namespace quda
+{
+
+  /* This is checked in the tuner */
+  static qudaError_t last_error = QUDA_SUCCESS;
+
+  /* This is only ever printed */
+  static std::string last_error_str {"CPU_SUCCESS"};
+
+  /* For the tuner to operat correctly we need to clear the last error */
+  qudaError_t qudaGetLastError()
+  {
+    auto rtn = last_error;
+    last_error = QUDA_SUCCESS; // Clear the error prior to returning
+    return rtn;
+  }
+
+  std::string qudaGetLastErrorString()
+  {
+    auto rtn = last_error_str;
+    last_error_str = "CPU_SUCCESS"; // Clear the error prior to returning.
+    return rtn;
+  }
+
+  using event_t = std::chrono::steady_clock::time_point;
+
+  static TimeProfile apiTimer("CPU API calls");
+
+  qudaError_t qudaLaunchKernel(const void *func, const TuneParam &, const qudaStream_t &, const void *arg)
+  {
+    // kernel entry points on the CPU target are type-erased host functions
+    auto kernel = reinterpret_cast<void (*)(const void *)>(const_cast<void *>(func));
+    PROFILE(kernel(arg), QUDA_PROFILE_LAUNCH_KERNEL);
+    return QUDA_SUCCESS;
+  }
+
+  void qudaMemcpy_(void *dst, const void *src, size_t count, qudaMemcpyKind, const char *, const char *, const char *)
+  {
+    if (count == 0) return;
+    memcpy(dst, src, count);
+  }
+
+  void qudaMemcpy_(const quda_ptr &dst, const quda_ptr &src, size_t count, qudaMemcpyKind, const char *, const char *,
+                   const char *)
+  {
+    if (count == 0) return;
+    memcpy(dst.data(), src.data(), count);
+  }
+
+  void qudaMemcpyAsync_(void *dst, const void *src, size_t count, qudaMemcpyKind kind, const qudaStream_t &,
+                        const char *, const char *, const char *)
+  {
+    if (count == 0) return;
+#ifdef API_PROFILE
+    QudaProfileType type = QUDA_PROFILE_MEMCPY_DEFAULT_ASYNC;
+    switch (kind) {
+    case qudaMemcpyDeviceToHost: type = QUDA_PROFILE_MEMCPY_D2H_ASYNC; break;
+    case qudaMemcpyHostToDevice: type = QUDA_PROFILE_MEMCPY_H2D_ASYNC; break;
+    case qudaMemcpyDeviceToDevice: type = QUDA_PROFILE_MEMCPY_D2D_ASYNC; break;
+    default: type = QUDA_PROFILE_MEMCPY_DEFAULT_ASYNC;
+    }
+#else
+    (void)kind;
+#endif
+    PROFILE(memcpy(dst, src, count), type);
+  }
+
+  void qudaMemcpyP2PAsync_(void *dst, const void *src, size_t count, const qudaStream_t &, const char *, const char *,
+                           const char *)
+  {
+    if (count == 0) return;
+    memcpy(dst, src, count);
+  }
+
+  void qudaMemset_(void *ptr, int value, size_t count, const char *, const char *, const char *)
+  {
+    if (count == 0) return;
+    memset(ptr, value, count);
+  }
+
+  void qudaMemset_(quda_ptr &ptr, int value, size_t count, const char *, const char *, const char *)
+  {
+    if (count == 0) return;
+    memset(ptr.data(), value, count);
+  }
+
+  void qudaMemsetAsync_(void *ptr, int value, size_t count, const qudaStream_t &, const char *, const char *,
+                        const char *)
+  {
+    if (count == 0) return;
+    memset(ptr, value, count);
+  }
+
+  void qudaMemsetAsync_(quda_ptr &ptr, int value, size_t count, const qudaStream_t &, const char *, const char *,
+                        const char *)
+  {
+    if (count == 0) return;
+    memset(ptr.data(), value, count);
+  }
+
+  void qudaMemset2DAsync_(quda_ptr &ptr, size_t offset, size_t pitch, int value, size_t width, size_t height,
+                          const qudaStream_t &, const char *, const char *, const char *)
+  {
+    for (auto i = 0u; i < height; i++) memset(static_cast<char *>(ptr.data()) + offset + i * pitch, value, width);
+  }
+
+  void qudaMemPrefetchAsync_(void *, size_t, QudaFieldLocation, const qudaStream_t &, const char *, const char *,
+                             const char *)
+  {
+    // No prefetch
+  }
+
+  bool qudaEventQuery_(qudaEvent_t &, const char *, const char *, const char *)
+  {
+    // all work has completed by the time it is issued
+    return true;
+  }
+
+  void qudaEventRecord_(qudaEvent_t &quda_event, qudaStream_t, const char *, const char *, const char *)
+  {
+    PROFILE(*static_cast<event_t *>(quda_event.event) = std::chrono::steady_clock::now(), QUDA_PROFILE_EVENT_RECORD);
+  }
+
+  void qudaStreamWaitEvent_(qudaStream_t, qudaEvent_t, unsigned int, const char *, const char *, const char *)
+  {
+    // streams are drained at the point of issue so there is nothing to wait for
+  }
+
+  qudaEvent_t qudaEventCreate_(const char *, const char *, const char *)
+  {
+    qudaEvent_t quda_event;
+    quda_event.event = new event_t(std::chrono::steady_clock::now());
+    return quda_event;
+  }
+
+  qudaEvent_t qudaChronoEventCreate_(const char *func, const char *file, const char *line)
+  {
+    return qudaEventCreate_(func, file, line);
+  }
+
+  float qudaEventElapsedTime_(const qudaEvent_t &quda_start, const qudaEvent_t &quda_end, const char *, const char *,
+                              const char *)
+  {
+    const auto &start = *static_cast<const event_t *>(quda_start.event);
+    const auto &end = *static_cast<const event_t *>(quda_end.event);
+    return std::chrono::duration<float>(end - start).count();
+  }
+
+  void qudaEventDestroy_(qudaEvent_t &event, const char *, const char *, const char *)
+  {
+    delete static_cast<event_t *>(event.event);
+    event.event = nullptr;
+  }
+
+  void qudaEventSynchronize_(const qudaEvent_t &, const char *, const char *, const char *) { }
+
+  void qudaStreamSynchronize_(const qudaStream_t &, const char *, const char *, const char *) { }
+
+  void qudaDeviceSynchronize_(const char *, const char *, const char *) { }
+
+  void *qudaGetSymbolAddress_(const char *symbol, const char *, const char *, const char *)
+  {
+    // symbols live in host memory so the address is the symbol itself
+    return const_cast<char *>(symbol);
+  }
+
+  void printAPIProfile()
+  {
+#ifdef API_PROFILE
+    apiTimer.Print();
+#endif
+  }
+
+} // namespace quda
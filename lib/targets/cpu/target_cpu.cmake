@@ -0,0 +1,52 @@
+# ######################################################################################################################
+# CPU specific part of CMakeLists
+#
+# The CPU target builds the whole library with the host C++ compiler.  "Device" memory is host memory, streams are
+# in-order queues and kernels are executed with the OpenMP host loops, so QUDA_OPENMP is required.
+
+set(QUDA_TARGET_CPU ON)
+
+if(NOT QUDA_OPENMP)
+  message(FATAL_ERROR "QUDA_TARGET_TYPE=CPU requires QUDA_OPENMP=ON")
+endif()
+
+# raw kernels and block kernels with more than one thread per block rely on cooperation between the threads of a
+# block, which the OpenMP host loops do not provide; the multigrid transfer operators are built on these
+if(QUDA_MULTIGRID)
+  message(FATAL_ERROR "QUDA_MULTIGRID is not supported with QUDA_TARGET_TYPE=CPU")
+endif()
+
+# ######################################################################################################################
+# GPU specific QUDA options that do not apply to the CPU target
+set(QUDA_HETEROGENEOUS_ATOMIC OFF)
+set(QUDA_LARGE_KERNEL_ARG OFF)
+mark_as_advanced(QUDA_HETEROGENEOUS_ATOMIC)
+mark_as_advanced(QUDA_LARGE_KERNEL_ARG)
+
+# QUDA_HASH for tunecache
+set(HASH cpu_arch=${CPU_ARCH},target=cpu,cxx_version=${CMAKE_CXX_COMPILER_VERSION})
+set(GITVERSION "${PROJECT_VERSION}-${GITVERSION}-cpu")
+
+# ######################################################################################################################
+# CPU specific compile options
+
+target_include_directories(quda PRIVATE ${CMAKE_SOURCE_DIR}/include/targets/cpu)
+target_include_directories(quda PUBLIC $<BUILD_INTERFACE:${CMAKE_BINARY_DIR}/include/targets/cpu>
+                                       $<INSTALL_INTERFACE:include/targets/cpu>)
+
+target_compile_options(
+  quda
+  PRIVATE -Wall
+          -Wextra
+          -Wno-unknown-pragmas
+          $<$<CONFIG:STRICT>:-Werror>
+          $<$<CONFIG:SANITIZE>:-fsanitize=address
+          -fsanitize=undefined>)
+
+# the kernel sources are compiled as C++: the explicit -x is needed since the host compiler does not recognize the .cu
+# extension
+set(QUDA_CPU_CU_OPTIONS "-xc++")
+
+set_source_files_properties(${QUDA_CU_OBJS} PROPERTIES LANGUAGE CXX COMPILE_OPTIONS "${QUDA_CPU_CU_OPTIONS}")
+
+add_subdirectory(targets/cpu)
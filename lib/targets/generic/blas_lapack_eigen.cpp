@@ -26,17 +26,11 @@ namespace quda
       template <typename EigenMatrix, typename Float>
       void invertEigen(std::complex<Float> *A_eig, std::complex<Float> *Ainv_eig, int n, uint64_t batch)
       {
-        EigenMatrix res = EigenMatrix::Zero(n, n);
-        EigenMatrix inv = EigenMatrix::Zero(n, n);
-        for (int j = 0; j < n; j++) {
-          for (int k = 0; k < n; k++) { res(k, j) = A_eig[batch * n * n + j * n + k]; }
-        }
-
-        inv = res.inverse();
+        // operate directly on the column-major batch element, no intermediate copies
+        const Map<EigenMatrix> res(A_eig + batch * n * n, n, n);
+        Map<EigenMatrix> inv(Ainv_eig + batch * n * n, n, n);
 
-        for (int j = 0; j < n; j++) {
-          for (int k = 0; k < n; k++) { Ainv_eig[batch * n * n + j * n + k] = inv(k, j); }
-        }
+        inv = res.partialPivLu().inverse();
 
         // Check result:
 #ifdef _DEBUG
@@ -70,7 +64,7 @@ namespace quda
           std::complex<float> *Ainv_eig = (std::complex<float> *)Ainv_h;
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
           for (uint64_t i = 0; i < batch; i++) { invertEigen<MatrixXcf, float>(A_eig, Ainv_eig, n, i); }
           flops += batch * FLOPS_CGETRF(n, n);
@@ -79,7 +73,7 @@ namespace quda
           std::complex<double> *Ainv_eig = (std::complex<double> *)Ainv_h;
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel for schedule(static)
 #endif
           for (uint64_t i = 0; i < batch; i++) { invertEigen<MatrixXcd, double>(A_eig, Ainv_eig, n, i); }
           flops += batch * FLOPS_ZGETRF(n, n);
@@ -95,16 +89,16 @@ namespace quda
         if (getVerbosity() >= QUDA_VERBOSE) {
           int threads = 1;
 #ifdef _OPENMP
-          threads = omp_get_num_threads();
+          threads = omp_get_max_threads();
 #endif
           printfQuda("CPU: Batched matrix inversion completed in %f seconds using %d threads with GFLOPS = %f\n", timeh,
                      threads, 1e-9 * flops / timeh);
         }
 
         if (location == QUDA_CUDA_FIELD_LOCATION) {
+          qudaMemcpy((void *)Ainv, Ainv_h, size, qudaMemcpyHostToDevice);
           pool_pinned_free(Ainv_h);
           pool_pinned_free(A_h);
-          qudaMemcpy((void *)Ainv, Ainv_h, size, qudaMemcpyHostToDevice);
         }
 
         return flops;
@@ -112,90 +106,91 @@ namespace quda
 
       // Srided Batched GEMM helpers
       //--------------------------------------------------------------------------
-      template <typename EigenMat, typename T>
-      void fillArray(EigenMat &EigenArr, T *arr, int rows, int cols, int ld, int offset, bool fill_eigen)
+      // Row-major view of a batch element with leading dimension ld
+      template <typename T> using RowMatrix = Matrix<T, Dynamic, Dynamic, RowMajor>;
+      template <typename T> using RowMap = Map<RowMatrix<T>, Unaligned, OuterStride<>>;
+      template <typename T> using ConstRowMap = Map<const RowMatrix<T>, Unaligned, OuterStride<>>;
+
+      template <typename T, typename MatA, typename MatB>
+      void gemm_kernel(RowMap<T> &C, const MatA &A, const MatB &B, T alpha, T beta)
       {
-        int counter = offset;
-        for (int i = 0; i < rows; i++) {
-          for (int j = 0; j < cols; j++) {
-            if (fill_eigen)
-              EigenArr(i, j) = arr[counter];
-            else
-              arr[counter] = EigenArr(i, j);
-            counter++;
-          }
-          counter += (ld - cols);
+        C *= beta;
+        C.noalias() += alpha * A * B;
+      }
+
+      template <typename T, typename MatA>
+      void gemm_op_b(RowMap<T> &C, const MatA &A, const ConstRowMap<T> &B, QudaBLASOperation trans_b, T alpha, T beta)
+      {
+        switch (trans_b) {
+        case QUDA_BLAS_OP_N: gemm_kernel(C, A, B, alpha, beta); break;
+        case QUDA_BLAS_OP_T: gemm_kernel(C, A, B.transpose(), alpha, beta); break;
+        case QUDA_BLAS_OP_C: gemm_kernel(C, A, B.adjoint(), alpha, beta); break;
+        default: errorQuda("Unknown blas op type %d", trans_b);
+        }
+      }
+
+      template <typename T>
+      void gemm_op_a(RowMap<T> &C, const ConstRowMap<T> &A, const ConstRowMap<T> &B, QudaBLASOperation trans_a,
+                     QudaBLASOperation trans_b, T alpha, T beta)
+      {
+        switch (trans_a) {
+        case QUDA_BLAS_OP_N: gemm_op_b(C, A, B, trans_b, alpha, beta); break;
+        case QUDA_BLAS_OP_T: gemm_op_b(C, A.transpose(), B, trans_b, alpha, beta); break;
+        case QUDA_BLAS_OP_C: gemm_op_b(C, A.adjoint(), B, trans_b, alpha, beta); break;
+        default: errorQuda("Unknown blas op type %d", trans_a);
         }
       }
 
-      template <typename EigenMat, typename T>
-      void GEMM(void *A_h, void *B_h, void *C_h, T alpha, T beta, int max_stride, QudaBLASParam &blas_param)
+      template <typename T>
+      void GEMM(void *A_h, void *B_h, void *C_h, T alpha, T beta, int max_stride, const QudaBLASParam &blas_param)
       {
         // Problem parameters
-        int m = blas_param.m;
-        int n = blas_param.n;
-        int k = blas_param.k;
-        int lda = blas_param.lda;
-        int ldb = blas_param.ldb;
-        int ldc = blas_param.ldc;
+        const int m = blas_param.m;
+        const int n = blas_param.n;
+        const int k = blas_param.k;
+        const int lda = blas_param.lda;
+        const int ldb = blas_param.ldb;
+        const int ldc = blas_param.ldc;
 
         // If the user did not set any stride values, we default them to 1
         // as batch size 0 is an option.
-        int a_stride = blas_param.a_stride == 0 ? 1 : blas_param.a_stride;
-        int b_stride = blas_param.b_stride == 0 ? 1 : blas_param.b_stride;
-        int c_stride = blas_param.c_stride == 0 ? 1 : blas_param.c_stride;
-        int a_offset = blas_param.a_offset;
-        int b_offset = blas_param.b_offset;
-        int c_offset = blas_param.c_offset;
-        int batches = blas_param.batch_count;
+        const uint64_t a_stride = blas_param.a_stride == 0 ? 1 : blas_param.a_stride;
+        const uint64_t b_stride = blas_param.b_stride == 0 ? 1 : blas_param.b_stride;
+        const uint64_t c_stride = blas_param.c_stride == 0 ? 1 : blas_param.c_stride;
+        const uint64_t a_offset = blas_param.a_offset;
+        const uint64_t b_offset = blas_param.b_offset;
+        const uint64_t c_offset = blas_param.c_offset;
+
+        // The stored shape of A and B depends on the operation applied to them
+        const int a_rows = blas_param.trans_a == QUDA_BLAS_OP_N ? m : k;
+        const int a_cols = blas_param.trans_a == QUDA_BLAS_OP_N ? k : m;
+        const int b_rows = blas_param.trans_b == QUDA_BLAS_OP_N ? k : n;
+        const int b_cols = blas_param.trans_b == QUDA_BLAS_OP_N ? n : k;
 
         // Number of data between batches
-        unsigned int A_batch_size = blas_param.lda * blas_param.k;
-        if (blas_param.trans_a != QUDA_BLAS_OP_N) A_batch_size = blas_param.lda * blas_param.m;
-        unsigned int B_batch_size = blas_param.ldb * blas_param.n;
-        if (blas_param.trans_b != QUDA_BLAS_OP_N) B_batch_size = blas_param.ldb * blas_param.k;
-        unsigned int C_batch_size = blas_param.ldc * blas_param.n;
-
-        T *A_ptr = (T *)(&A_h)[0];
-        T *B_ptr = (T *)(&B_h)[0];
-        T *C_ptr = (T *)(&C_h)[0];
-
-        // Eigen objects to store data
-        EigenMat Amat = EigenMat::Zero(m, k);
-        EigenMat Bmat = EigenMat::Zero(k, n);
-        EigenMat Cmat = EigenMat::Zero(m, n);
-
-        for (int batch = 0; batch < batches; batch += max_stride) {
-
-          // Populate Eigen objects
-          fillArray<EigenMat, T>(Amat, A_ptr, m, k, lda, a_offset, true);
-          fillArray<EigenMat, T>(Bmat, B_ptr, k, n, ldb, b_offset, true);
-          fillArray<EigenMat, T>(Cmat, C_ptr, m, n, ldc, c_offset, true);
-
-          // Apply op(A) and op(B)
-          switch (blas_param.trans_a) {
-          case QUDA_BLAS_OP_T: Amat.transposeInPlace(); break;
-          case QUDA_BLAS_OP_C: Amat.adjointInPlace(); break;
-          case QUDA_BLAS_OP_N: break;
-          default: errorQuda("Unknown blas op type %d", blas_param.trans_a);
-          }
+        const uint64_t A_batch_size = static_cast<uint64_t>(lda) * a_rows;
+        const uint64_t B_batch_size = static_cast<uint64_t>(ldb) * b_rows;
+        const uint64_t C_batch_size = static_cast<uint64_t>(ldc) * m;
 
-          switch (blas_param.trans_b) {
-          case QUDA_BLAS_OP_T: Bmat.transposeInPlace(); break;
-          case QUDA_BLAS_OP_C: Bmat.adjointInPlace(); break;
-          case QUDA_BLAS_OP_N: break;
-          default: errorQuda("Unknown blas op type %d", blas_param.trans_b);
-          }
+        const T *A_ptr = static_cast<const T *>(A_h);
+        const T *B_ptr = static_cast<const T *>(B_h);
+        T *C_ptr = static_cast<T *>(C_h);
 
-          // Perform GEMM using Eigen
-          Cmat = alpha * Amat * Bmat + beta * Cmat;
+        // Every GEMM in the batch is independent, so we parallelize
+        // over the batch index.  Inside an OpenMP parallel region
+        // Eigen falls back to its serial kernels, so the threads are
+        // not oversubscribed.
+        const int64_t n_gemm = (blas_param.batch_count + max_stride - 1) / max_stride;
 
-          // Write back to the C array
-          fillArray<EigenMat, T>(Cmat, C_ptr, m, n, ldc, c_offset, false);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (n_gemm > 1)
+#endif
+        for (int64_t batch = 0; batch < n_gemm; batch++) {
+          const ConstRowMap<T> A(A_ptr + a_offset + batch * A_batch_size * a_stride, a_rows, a_cols, OuterStride<>(lda));
+          const ConstRowMap<T> B(B_ptr + b_offset + batch * B_batch_size * b_stride, b_rows, b_cols, OuterStride<>(ldb));
+          RowMap<T> C(C_ptr + c_offset + batch * C_batch_size * c_stride, m, n, OuterStride<>(ldc));
 
-          a_offset += A_batch_size * a_stride;
-          b_offset += B_batch_size * b_stride;
-          c_offset += C_batch_size * c_stride;
+          gemm_op_a(C, A, B, blas_param.trans_a, blas_param.trans_b, alpha, beta);
         }
       }
       //---------------------------------------------------
@@ -306,11 +301,12 @@ namespace quda
         }
 
         // Number of data between batches
-        unsigned int A_batch_size = blas_param.lda * blas_param.k;
-        if (blas_param.trans_a != QUDA_BLAS_OP_N) A_batch_size = blas_param.lda * blas_param.m;
-        unsigned int B_batch_size = blas_param.ldb * blas_param.n;
-        if (blas_param.trans_b != QUDA_BLAS_OP_N) B_batch_size = blas_param.ldb * blas_param.k;
-        unsigned int C_batch_size = blas_param.ldc * blas_param.n;
+        // (row-major, so each batch element spans rows * ld)
+        uint64_t A_batch_size = static_cast<uint64_t>(blas_param.lda) * blas_param.m;
+        if (blas_param.trans_a != QUDA_BLAS_OP_N) A_batch_size = static_cast<uint64_t>(blas_param.lda) * blas_param.k;
+        uint64_t B_batch_size = static_cast<uint64_t>(blas_param.ldb) * blas_param.k;
+        if (blas_param.trans_b != QUDA_BLAS_OP_N) B_batch_size = static_cast<uint64_t>(blas_param.ldb) * blas_param.n;
+        uint64_t C_batch_size = static_cast<uint64_t>(blas_param.ldc) * blas_param.m;
 
         // Data size of the entire array
         size_t sizeAarr = A_batch_size * data_size * batch;
@@ -333,7 +329,7 @@ namespace quda
           typedef std::complex<double> Z;
           const Z alpha = blas_param.alpha;
           const Z beta = blas_param.beta;
-          GEMM<MatrixXcd, Z>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<Z>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_CGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else if (blas_param.data_type == QUDA_BLAS_DATATYPE_C) {
@@ -341,7 +337,7 @@ namespace quda
           typedef std::complex<float> C;
           const C alpha = blas_param.alpha;
           const C beta = blas_param.beta;
-          GEMM<MatrixXcf, C>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<C>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_CGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else if (blas_param.data_type == QUDA_BLAS_DATATYPE_D) {
@@ -349,7 +345,7 @@ namespace quda
           typedef double D;
           const D alpha = (D)(static_cast<std::complex<double>>(blas_param.alpha).real());
           const D beta = (D)(static_cast<std::complex<double>>(blas_param.beta).real());
-          GEMM<MatrixXd, D>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<D>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_SGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else if (blas_param.data_type == QUDA_BLAS_DATATYPE_S) {
@@ -357,7 +353,7 @@ namespace quda
           typedef float S;
           const S alpha = (S)(static_cast<std::complex<float>>(blas_param.alpha).real());
           const S beta = (S)(static_cast<std::complex<float>>(blas_param.beta).real());
-          GEMM<MatrixXf, S>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
+          GEMM<S>(A_h, B_h, C_h, alpha, beta, max_stride, blas_param);
           flops += batch * FLOPS_SGEMM(blas_param.m, blas_param.n, blas_param.k);
 
         } else {
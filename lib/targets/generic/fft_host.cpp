@@ -0,0 +1,180 @@
+#include <cmath>
+#include <FFT_Plans_host.h>
+
+namespace quda
+{
+
+  namespace
+  {
+
+    /**
+       @brief Return the prime factors of n in increasing order
+    */
+    std::vector<int> factorize(int n)
+    {
+      std::vector<int> factor;
+      for (int p = 2; p * p <= n; p++)
+        while (n % p == 0) {
+          factor.push_back(p);
+          n /= p;
+        }
+      if (n > 1) factor.push_back(n);
+      return factor;
+    }
+
+    /**
+       @brief Return exp(sign * 2 pi i j / N) from the table of forward twiddle factors
+    */
+    template <typename T> inline std::complex<T> twiddle(const std::complex<double> *w, int j, int sign)
+    {
+      return std::complex<T>(w[j].real(), sign < 0 ? w[j].imag() : -w[j].imag());
+    }
+
+    /**
+       @brief Recursive step of the Stockham autosort FFT of length N.
+       At each step the sequence of length n with stride s is split by
+       its smallest prime factor p into p subsequences of length n/p,
+       alternating between the buffers x and y so that the result is
+       left in natural order without a bit-reversal pass.
+       @param[in] n Length of the subsequences at this step
+       @param[in] s Stride of the subsequences at this step
+       @param[in] eo Whether the result is to be left in y
+       @param[in,out] x Input buffer of length N
+       @param[in,out] y Work buffer of length N
+       @param[in] factor Remaining prime factors of n
+       @param[in] w Table of forward twiddle factors of length N
+       @param[in] N Length of the transform
+       @param[in] sign Sign of the exponent
+    */
+    template <typename T>
+    void stockham(int n, int s, bool eo, std::complex<T> *x, std::complex<T> *y, const int *factor,
+                  const std::complex<double> *w, int N, int sign)
+    {
+      if (n == 1) {
+        if (eo)
+          for (int q = 0; q < s; q++) y[q] = x[q];
+        return;
+      }
+
+      const int p = factor[0];
+      const int m = n / p;
+      const int wn = N / n; // stride in the twiddle table for exp(-2 pi i / n)
+      const int wp = N / p; // stride in the twiddle table for exp(-2 pi i / p)
+
+      if (p == 2) {
+        for (int k = 0; k < m; k++) {
+          auto wk = twiddle<T>(w, k * wn, sign);
+          for (int q = 0; q < s; q++) {
+            auto a = x[q + s * k];
+            auto b = x[q + s * (k + m)];
+            y[q + s * 2 * k] = a + b;
+            y[q + s * (2 * k + 1)] = (a - b) * wk;
+          }
+        }
+      } else {
+        for (int k = 0; k < m; k++) {
+          for (int u = 0; u < p; u++) {
+            auto wk = twiddle<T>(w, k * u * wn, sign);
+            for (int q = 0; q < s; q++) {
+              std::complex<T> sum = 0;
+              for (int r = 0; r < p; r++) sum += x[q + s * (k + r * m)] * twiddle<T>(w, ((r * u) % p) * wp, sign);
+              y[q + s * (p * k + u)] = sum * wk;
+            }
+          }
+        }
+      }
+
+      stockham(m, p * s, !eo, y, x, factor + 1, w, N, sign);
+    }
+
+    template <typename T> void apply(FFTHostPlanHandle &plan, std::complex<T> *in, std::complex<T> *out, int direction)
+    {
+      if (plan.batch == 0) errorQuda("FFT plan has not been set");
+      if (direction != -1 && direction != 1) errorQuda("Invalid FFT direction %d", direction);
+
+      size_t length = 1;
+      for (auto n : plan.n) length *= n;
+      const size_t size = length * plan.batch;
+
+      if (in != out) {
+#pragma omp parallel for
+        for (size_t i = 0; i < size; i++) out[i] = in[i];
+      }
+
+      size_t inner = length;
+      for (auto d = 0u; d < plan.n.size(); d++) {
+        const int n = plan.n[d];
+        inner /= n;
+        if (n == 1) continue;
+        const size_t lines = size / n;
+        const int *factor = plan.factor[d].data();
+        const std::complex<double> *w = plan.twiddle[d].data();
+
+#pragma omp parallel
+        {
+          std::vector<std::complex<T>> x(n), y(n);
+#pragma omp for
+          for (size_t line = 0; line < lines; line++) {
+            // lines are contiguous in the inner dimensions and strided in this dimension
+            const size_t base = (line / inner) * n * inner + line % inner;
+            for (int j = 0; j < n; j++) x[j] = out[base + j * inner];
+            stockham(n, 1, false, x.data(), y.data(), factor, w, n, direction);
+            for (int j = 0; j < n; j++) out[base + j * inner] = x[j];
+          }
+        }
+      }
+    }
+
+    void set_plan(FFTHostPlanHandle &plan, const std::vector<int> &n, QudaPrecision precision, int batch)
+    {
+      if (batch < 1) errorQuda("Invalid FFT batch size %d", batch);
+      plan.n = n;
+      plan.factor.clear();
+      plan.twiddle.clear();
+      for (auto N : n) {
+        plan.factor.push_back(factorize(N));
+        std::vector<std::complex<double>> w(N);
+        for (int j = 0; j < N; j++) w[j] = std::polar(1.0, -2.0 * M_PI * j / N);
+        plan.twiddle.push_back(w);
+      }
+      plan.batch = batch;
+      plan.precision = precision;
+    }
+
+  } // namespace
+
+  void ApplyFFT(FFTHostPlanHandle &plan, float2 *data_in, float2 *data_out, int direction)
+  {
+    if (plan.precision == QUDA_DOUBLE_PRECISION) errorQuda("Single-precision FFT applied with a double-precision plan");
+    apply(plan, reinterpret_cast<std::complex<float> *>(data_in), reinterpret_cast<std::complex<float> *>(data_out),
+          direction);
+  }
+
+  void ApplyFFT(FFTHostPlanHandle &plan, double2 *data_in, double2 *data_out, int direction)
+  {
+    if (plan.precision != QUDA_DOUBLE_PRECISION) errorQuda("Double-precision FFT applied with a single-precision plan");
+    apply(plan, reinterpret_cast<std::complex<double> *>(data_in), reinterpret_cast<std::complex<double> *>(data_out),
+          direction);
+  }
+
+  void SetPlanFFTMany(FFTHostPlanHandle &plan, int4 size, int dim, QudaPrecision precision, int batch)
+  {
+    switch (dim) {
+    case 1: set_plan(plan, {size.w}, precision, size.x * size.y * size.z * batch); break;
+    case 3: set_plan(plan, {size.x, size.y, size.z}, precision, size.w * batch); break;
+    default: errorQuda("Unsupported FFT dimension %d", dim);
+    }
+  }
+
+  void SetPlanFFT2DMany(FFTHostPlanHandle &plan, int4 size, int dim, QudaPrecision precision, int batch)
+  {
+    switch (dim) {
+    case 0: set_plan(plan, {size.w, size.z}, precision, size.x * size.y * batch); break; // outer-most dimension is first
+    case 1: set_plan(plan, {size.y, size.x}, precision, size.z * size.w * batch); break; // outer-most dimension is first
+    default: errorQuda("Unsupported FFT dimension %d", dim);
+    }
+  }
+
+  void FFTDestroyPlan(FFTHostPlanHandle &plan) { plan = FFTHostPlanHandle(); }
+
+} // namespace quda
@@ -6,10 +6,13 @@
 #include <complex>
 
 #include <inttypes.h>
+#include <vector>
 
 #include <test.h>
 #include <blas_reference.h>
 #include <misc.h>
+#include <timer.h>
+#include <blas_lapack.h>
 
 // In a typical application, quda.h is the only QUDA header required.
 #include <quda.h>
@@ -33,6 +36,13 @@ std::array<double, 2> blas_gemm_beta_re_im = {M_LN2, M_LN10};
 
 int blas_lu_inv_mat_size = 128;
 
+// Parameters swept when running in benchmark mode
+bool blas_benchmark = false;
+std::vector<int> blas_benchmark_batches = {1, 16, 64, 256};
+std::vector<int> blas_benchmark_sizes = {16, 32, 64, 128};
+std::vector<int> blas_benchmark_ld_pads = {0, 16};
+std::vector<int> blas_benchmark_strides = {1, 2};
+
 namespace quda
 {
   extern void setTransferGPU(bool);
@@ -317,6 +327,166 @@ double lu_inv_test(test_t test_param)
   return deviation;
 }
 
+/**
+   @brief Size in bytes of a single element of the given BLAS data type
+*/
+size_t blas_data_type_size(QudaBLASDataType data_type)
+{
+  switch (data_type) {
+  case QUDA_BLAS_DATATYPE_S: return sizeof(float);
+  case QUDA_BLAS_DATATYPE_D: return sizeof(double);
+  case QUDA_BLAS_DATATYPE_C: return 2 * sizeof(float);
+  case QUDA_BLAS_DATATYPE_Z: return 2 * sizeof(double);
+  default: errorQuda("Unrecognised data type %d\n", data_type);
+  }
+  return 0;
+}
+
+/**
+   @brief Time niter calls of the batched GEMM on the host generic
+   backend for a square problem of the given size, batch count,
+   leading-dimension padding and stride, verify a single call against
+   the threaded Eigen reference and print GFLOP/s and bandwidth.
+*/
+void gemm_benchmark(QudaBLASDataType data_type, int size, int batch, int ld_pad, int stride)
+{
+  QudaBLASParam blas_param = newQudaBLASParam();
+  blas_data_type = data_type;
+  blas_test_type = QUDA_BLAS_GEMM;
+  setBLASParam(blas_param);
+  blas_param.m = blas_param.n = blas_param.k = size;
+  blas_param.lda = blas_param.ldb = blas_param.ldc = size + ld_pad;
+  blas_param.a_offset = blas_param.b_offset = blas_param.c_offset = 0;
+  blas_param.a_stride = blas_param.b_stride = blas_param.c_stride = stride;
+  blas_param.batch_count = batch;
+
+  // square problem, so every array has the same footprint regardless of order and op
+  const uint64_t array_size = static_cast<uint64_t>(size) * blas_param.lda;
+  const size_t data_in_size = sizeof(double);
+  const size_t data_out_size
+    = (data_type == QUDA_BLAS_DATATYPE_S || data_type == QUDA_BLAS_DATATYPE_C) ? sizeof(float) : sizeof(double);
+  const size_t element_size = blas_data_type_size(data_type);
+
+  void *refA = pinned_malloc(batch * array_size * 2 * data_in_size);
+  void *refB = pinned_malloc(batch * array_size * 2 * data_in_size);
+  void *refC = pinned_malloc(batch * array_size * 2 * data_in_size);
+  prepare_ref_array(refA, batch, array_size, data_in_size, data_type);
+  prepare_ref_array(refB, batch, array_size, data_in_size, data_type);
+  prepare_ref_array(refC, batch, array_size, data_in_size, data_type);
+
+  void *arrayA = pinned_malloc(batch * array_size * element_size);
+  void *arrayB = pinned_malloc(batch * array_size * element_size);
+  void *arrayC = pinned_malloc(batch * array_size * element_size);
+  void *arrayCcopy = pinned_malloc(batch * array_size * element_size);
+  copy_array(arrayA, refA, batch, array_size, data_out_size, data_type);
+  copy_array(arrayB, refB, batch, array_size, data_out_size, data_type);
+  copy_array(arrayC, refC, batch, array_size, data_out_size, data_type);
+  copy_array(arrayCcopy, refC, batch, array_size, data_out_size, data_type);
+
+  // verify a single call before timing, since the timed calls accumulate into C
+  double deviation = 0.0;
+  blasGEMMQuda(arrayA, arrayB, arrayC, QUDA_BOOLEAN_FALSE, &blas_param);
+  if (verify_results)
+    deviation = blasGEMMQudaVerify(arrayA, arrayB, arrayC, arrayCcopy, array_size, array_size, array_size, &blas_param);
+
+  quda::host_timer_t host_timer;
+  for (int i = 0; i < niter; i++) {
+    memcpy(arrayC, arrayCcopy, batch * array_size * element_size);
+    host_timer.start();
+    blasGEMMQuda(arrayA, arrayB, arrayC, QUDA_BOOLEAN_FALSE, &blas_param);
+    host_timer.stop();
+  }
+
+  const int n_gemm = (batch + stride - 1) / stride;
+  const bool is_complex = (data_type == QUDA_BLAS_DATATYPE_C || data_type == QUDA_BLAS_DATATYPE_Z);
+  const double flops = static_cast<double>(n_gemm)
+    * (is_complex ? FLOPS_CGEMM(1.0 * size, 1.0 * size, 1.0 * size) : FLOPS_SGEMM(1.0 * size, 1.0 * size, 1.0 * size));
+  // read A, B and C, write C
+  const double bytes = 4.0 * n_gemm * size * size * element_size;
+  const double time = host_timer.time / niter;
+
+  printfQuda("GEMM %s size = %4d batch = %4d ld = %4d stride = %d: %e s, %8.2f GFLOP/s, %8.2f GB/s, deviation = %e\n",
+             get_blas_data_type_str(data_type), size, batch, blas_param.lda, stride, time, 1e-9 * flops / time,
+             1e-9 * bytes / time, deviation);
+
+  host_free(refA);
+  host_free(refB);
+  host_free(refC);
+  host_free(arrayA);
+  host_free(arrayB);
+  host_free(arrayC);
+  host_free(arrayCcopy);
+}
+
+/**
+   @brief Time niter calls of the batched LU inversion on the host
+   generic backend, verify against the threaded Eigen reference and
+   print GFLOP/s and bandwidth.
+*/
+void lu_inv_benchmark(QudaBLASDataType data_type, int size, int batch)
+{
+  QudaBLASParam blas_param = newQudaBLASParam();
+  blas_data_type = data_type;
+  blas_test_type = QUDA_BLAS_LU_INV;
+  setBLASParam(blas_param);
+  blas_param.inv_mat_size = size;
+  blas_param.batch_count = batch;
+
+  const uint64_t array_size = static_cast<uint64_t>(size) * size;
+  const size_t data_in_size = sizeof(double);
+  const size_t data_out_size = data_type == QUDA_BLAS_DATATYPE_C ? sizeof(float) : sizeof(double);
+  const size_t element_size = blas_data_type_size(data_type);
+
+  void *ref_array = pinned_malloc(batch * array_size * 2 * data_in_size);
+  prepare_ref_array(ref_array, batch, array_size, data_in_size, data_type);
+  void *array = pinned_malloc(batch * array_size * element_size);
+  void *array_inv = pinned_malloc(batch * array_size * element_size);
+  copy_array(array, ref_array, batch, array_size, data_out_size, data_type);
+
+  quda::host_timer_t host_timer;
+  for (int i = 0; i < niter; i++) {
+    host_timer.start();
+    blasLUInvQuda(array_inv, array, QUDA_BOOLEAN_FALSE, &blas_param);
+    host_timer.stop();
+  }
+
+  double deviation = 0.0;
+  if (verify_results) deviation = blasLUInvQudaVerify(ref_array, array_inv, array_size, &blas_param);
+
+  const double flops = batch * (FLOPS_ZGETRF(size, size) + FLOPS_ZGETRI(size));
+  // read A, write A^{-1}
+  const double bytes = 2.0 * batch * array_size * element_size;
+  const double time = host_timer.time / niter;
+
+  printfQuda("LU-inv %s size = %4d batch = %4d: %e s, %8.2f GFLOP/s, %8.2f GB/s, deviation = %e\n",
+             get_blas_data_type_str(data_type), size, batch, time, 1e-9 * flops / time, 1e-9 * bytes / time, deviation);
+
+  host_free(ref_array);
+  host_free(array);
+  host_free(array_inv);
+}
+
+/**
+   @brief Sweep the batched GEMM and LU inversion over data type,
+   matrix size, batch count, leading dimension and stride on the host
+   generic backend.
+*/
+void blas_benchmark_sweep()
+{
+  printfQuda("Benchmarking the host BLAS backend with %d iterations per problem\n", niter);
+  for (auto data_type : {QUDA_BLAS_DATATYPE_S, QUDA_BLAS_DATATYPE_D, QUDA_BLAS_DATATYPE_C, QUDA_BLAS_DATATYPE_Z}) {
+    for (auto size : blas_benchmark_sizes)
+      for (auto pad : blas_benchmark_ld_pads)
+        for (auto stride : blas_benchmark_strides)
+          for (auto batch : blas_benchmark_batches) gemm_benchmark(data_type, size, batch, pad, stride);
+  }
+
+  for (auto data_type : {QUDA_BLAS_DATATYPE_C, QUDA_BLAS_DATATYPE_Z}) {
+    for (auto size : blas_benchmark_sizes)
+      for (auto batch : blas_benchmark_batches) lu_inv_benchmark(data_type, size, batch);
+  }
+}
+
 struct blas_interface_test : quda_test {
 
   void add_command_line_group(std::shared_ptr<QUDAApp> app) const override
@@ -396,6 +566,22 @@ struct blas_interface_test : quda_test {
 
     opgroup->add_option("--blas-lu-inv-mat-size", blas_lu_inv_mat_size,
                         "Set the size of the square matrix to invert via LU (default 128)");
+
+    opgroup->add_option("--blas-benchmark", blas_benchmark,
+                        "Sweep the host BLAS backend over data type, size, batch, leading dims and strides, "
+                        "reporting GFLOP/s and bandwidth (default false)");
+
+    opgroup->add_option("--blas-benchmark-batches", blas_benchmark_batches,
+                        "Set the batch counts swept in benchmark mode (default 1 16 64 256)");
+
+    opgroup->add_option("--blas-benchmark-sizes", blas_benchmark_sizes,
+                        "Set the square matrix sizes swept in benchmark mode (default 16 32 64 128)");
+
+    opgroup->add_option("--blas-benchmark-ld-pads", blas_benchmark_ld_pads,
+                        "Set the leading dimension paddings swept in benchmark mode (default 0 16)");
+
+    opgroup->add_option("--blas-benchmark-strides", blas_benchmark_strides,
+                        "Set the batch strides swept in benchmark mode (default 1 2)");
   }
 
   blas_interface_test(int argc, char **argv) : quda_test("BLAS Interface Test", argc, argv) { }
@@ -410,6 +596,8 @@ int main(int argc, char **argv)
   if (enable_testing) {
     result = test.execute();
     if (result) warningQuda("Google tests for QUDA BLAS failed.");
+  } else if (blas_benchmark) {
+    blas_benchmark_sweep();
   } else {
     // Perform the BLAS op specified by the command line
     switch (blas_test_type) {
@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+#include <comm_quda.h>
+#include <test.h>
+
+/*
+   This test checks the topology-aware rank mapping computed by
+   comm_optimize_topology.  The optimizer is a pure function of the
+   process grid, the lattice and the gathered hostnames, so we feed
+   it synthetic hostnames and check the mapping it returns, without
+   requiring more than a single rank.
+ */
+
+using namespace quda;
+
+/**
+   @brief Build a gathered hostname buffer from a per-rank list of names
+*/
+static std::vector<char> hostnames(const std::vector<std::string> &names)
+{
+  std::vector<char> buf(QUDA_MAX_HOSTNAME_STRING * names.size(), '\0');
+  for (auto r = 0u; r < names.size(); r++)
+    strncpy(&buf[QUDA_MAX_HOSTNAME_STRING * r], names[r].c_str(), QUDA_MAX_HOSTNAME_STRING - 1);
+  return buf;
+}
+
+/**
+   @brief Set up an 8-rank process grid partitioned in T only, with a
+   4x4x4x16 lattice, so each rank has a 4x4x4x2 local volume
+*/
+static TopologyMap grid_map(std::array<int, 4> &dims)
+{
+  TopologyMap map;
+  dims = {1, 1, 1, 8};
+  int lattice[] = {4, 4, 4, 16};
+  for (int d = 0; d < 4; d++) map.lattice[d] = lattice[d];
+  map.site_bytes = 96;
+  return map;
+}
+
+// T face of the 4x4x4x2 local volume for a single parity
+constexpr size_t face_bytes = 4 * 4 * 4 / 2 * 96;
+
+TEST(CommTopologyTest, interleaved)
+{
+  std::array<int, 4> dims;
+  auto map = grid_map(dims);
+  auto host = hostnames({"a", "b", "a", "b", "a", "b", "a", "b"});
+  comm_optimize_topology(4, dims.data(), map, host.data(), 8);
+
+  // lexicographically every T neighbor is on the other node
+  EXPECT_EQ(map.inter_node_bytes_lex, 16 * face_bytes);
+
+  // each node should own a contiguous block of four ranks in T,
+  // leaving two node boundaries crossed in both directions
+  EXPECT_EQ(map.inter_node_bytes, 4 * face_bytes);
+  int node_dims[] = {1, 1, 1, 4};
+  for (int d = 0; d < 4; d++) EXPECT_EQ(map.node_dims[d], node_dims[d]);
+
+  // the mapping must be a permutation of the ranks
+  auto ranks = map.ranks;
+  std::sort(ranks.begin(), ranks.end());
+  for (int r = 0; r < 8; r++) EXPECT_EQ(ranks[r], r);
+
+  // and each block of four process grid coordinates lies on one node
+  for (int t = 0; t < 8; t++) EXPECT_EQ(map.ranks[t] % 2, map.ranks[t - t % 4] % 2);
+
+  // the rank lookup should agree with the table
+  for (int t = 0; t < 8; t++) {
+    int coords[] = {0, 0, 0, t};
+    EXPECT_EQ(comm_topology_rank_from_coords(coords, &map), map.ranks[t]);
+  }
+}
+
+TEST(CommTopologyTest, contiguous)
+{
+  std::array<int, 4> dims;
+  auto map = grid_map(dims);
+  auto host = hostnames({"a", "a", "a", "a", "b", "b", "b", "b"});
+  comm_optimize_topology(4, dims.data(), map, host.data(), 8);
+
+  // the default mapping is already optimal, so it is retained
+  EXPECT_EQ(map.inter_node_bytes, map.inter_node_bytes_lex);
+  EXPECT_EQ(map.inter_node_bytes, 4 * face_bytes);
+  for (int d = 0; d < 4; d++) EXPECT_EQ(map.node_dims[d], 0);
+  for (int r = 0; r < 8; r++) EXPECT_EQ(map.ranks[r], r);
+}
+
+TEST(CommTopologyTest, unbalanced)
+{
+  std::array<int, 4> dims;
+  auto map = grid_map(dims);
+  auto host = hostnames({"a", "b", "a", "b", "a", "b", "a", "a"});
+  comm_optimize_topology(4, dims.data(), map, host.data(), 8);
+
+  // nodes with differing numbers of ranks retain the default mapping
+  EXPECT_EQ(map.inter_node_bytes, map.inter_node_bytes_lex);
+  for (int d = 0; d < 4; d++) EXPECT_EQ(map.node_dims[d], 0);
+  for (int r = 0; r < 8; r++) EXPECT_EQ(map.ranks[r], r);
+}
+
+int main(int argc, char **argv)
+{
+  quda_test test("comm_topology_test", argc, argv);
+  test.init();
+  return test.execute();
+}
@@ -125,7 +125,8 @@ inline void fill_buffers(std::array<std::vector<Float>, N> &buffs, const std::ar
 template <typename Float, int nSpin, int src_colors, int n_mom>
 inline int launch_contract_test(const QudaContractType cType, const std::array<int, 4> &X, const int red_size,
                                 const std::array<int, 4> &source_position, const std::array<int, n_mom * 4> &mom,
-                                const std::array<QudaFFTSymmType, n_mom * 4> &fft_type)
+                                const std::array<QudaFFTSymmType, n_mom * 4> &fft_type, bool batched,
+                                QudaFieldLocation location)
 {
   ColorSpinorParam cs_param;
 
@@ -177,11 +178,64 @@ inline int launch_contract_test(const QudaContractType cType, const std::array<i
   }
   // Perform GPU contraction:
   void *d_result_ = static_cast<void *>(d_result.data());
+  int faults = 0;
 
-  contractFTQuda(spinorX.data(), spinorY.data(), &d_result_, cType, (void *)(&cs_param), src_colors, X.data(),
-                 source_position.data(), n_mom, mom.data(), fft_type.data());
+  if (batched) {
+    // contract all pairs of propagator vectors at once, and then sum
+    // the pairs of equal source color as contractFTQuda does
+    constexpr int nSpinSq = nSpin * nSpin;
+    std::vector<double> multi_result(n_mom * red_size * nprops * nprops * nSpinSq * 2);
+    contractFTMultiQuda(spinorX.data(), nprops, spinorY.data(), nprops, multi_result.data(), cType,
+                        (void *)(&cs_param), X.data(), source_position.data(), n_mom, mom.data(), fft_type.data(), 0,
+                        nullptr, location);
+
+    // project onto gamma structures: the identity and a general
+    // complex matrix, and check against the projected open matrices
+    constexpr int n_gamma = 2;
+    std::vector<double> gamma(n_gamma * nSpinSq * 2, 0.0);
+    for (int s = 0; s < nSpin; s++) gamma[2 * (s * nSpin + s)] = 1.0;
+    for (int s = 0; s < nSpinSq; s++) {
+      gamma[2 * (nSpinSq + s) + 0] = 1.0 + s;
+      gamma[2 * (nSpinSq + s) + 1] = 0.5 * (s % 3) - 0.5;
+    }
+    std::vector<double> gamma_result(n_mom * red_size * nprops * nprops * n_gamma * 2);
+    contractFTMultiQuda(spinorX.data(), nprops, spinorY.data(), nprops, gamma_result.data(), cType,
+                        (void *)(&cs_param), X.data(), source_position.data(), n_mom, mom.data(), fft_type.data(),
+                        n_gamma, gamma.data(), location);
+
+    int gamma_faults = 0;
+    for (int k = 0; k < n_mom * red_size * nprops * nprops; k++) {
+      for (int g = 0; g < n_gamma; g++) {
+        std::complex<double> ref = 0.0;
+        for (int s = 0; s < nSpinSq; s++)
+          ref += std::complex<double>(gamma[2 * (g * nSpinSq + s) + 0], gamma[2 * (g * nSpinSq + s) + 1])
+            * std::complex<double>(multi_result[2 * (k * nSpinSq + s) + 0], multi_result[2 * (k * nSpinSq + s) + 1]);
+        std::complex<double> proj(gamma_result[2 * (k * n_gamma + g) + 0], gamma_result[2 * (k * n_gamma + g) + 1]);
+        if (abs(proj - ref) > 1e-12 * std::max(1.0, abs(ref))) gamma_faults++;
+      }
+    }
+    printfQuda("Gamma projection comparison complete with %d/%d faults\n", gamma_faults,
+               n_mom * red_size * nprops * nprops * n_gamma);
+    faults += gamma_faults;
+
+    for (int m = 0; m < n_mom * red_size; m++) {
+      for (int s1 = 0; s1 < nSpin; s1++) {
+        for (int s2 = 0; s2 < nSpin; s2++) {
+          for (int c = 0; c < src_colors; c++) {
+            int i = s1 * src_colors + c;
+            int j = s2 * src_colors + c;
+            for (int s = 0; s < 2 * nSpinSq; s++)
+              d_result[m * 2 * nSpinSq + s] += multi_result[((m * nprops + i) * nprops + j) * 2 * nSpinSq + s];
+          }
+        }
+      }
+    }
+  } else {
+    contractFTQuda(spinorX.data(), spinorY.data(), &d_result_, cType, (void *)(&cs_param), src_colors, X.data(),
+                   source_position.data(), n_mom, mom.data(), fft_type.data());
+  }
   // Check results:
-  int faults = contractionFT_reference<Float>(spinorX.data(), spinorY.data(), d_result.data(), cType, src_colors,
+  faults += contractionFT_reference<Float>(spinorX.data(), spinorY.data(), d_result.data(), cType, src_colors,
                                               X.data(), source_position.data(), n_mom, mom.data(), fft_type.data());
 
   return faults;
@@ -190,14 +244,17 @@ inline int launch_contract_test(const QudaContractType cType, const std::array<i
 template <typename Float, int src_colors, int n_mom>
 int launch_contract_test(const QudaContractType cType, const std::array<int, 4> &X, const int nspin, const int red_size,
                          const std::array<int, 4> &source_position, const std::array<int, n_mom * 4> &mom,
-                         const std::array<QudaFFTSymmType, n_mom * 4> &fft_type)
+                         const std::array<QudaFFTSymmType, n_mom * 4> &fft_type, bool batched,
+                         QudaFieldLocation location)
 {
   int faults = 0;
 
   if (nspin == 1) {
-    faults = launch_contract_test<Float, 1, src_colors, n_mom>(cType, X, red_size, source_position, mom, fft_type);
-    //} else  if ( nspin == 4 ){ //TODO : must be enabled when spin=4 case will be re-activated
-    // faults = launch_contract_test<Float, 4, src_colors, n_mom>(cType, X, red_size, source_position, mom, fft_type );
+    faults = launch_contract_test<Float, 1, src_colors, n_mom>(cType, X, red_size, source_position, mom, fft_type,
+                                                               batched, location);
+  } else if (nspin == 4) {
+    faults = launch_contract_test<Float, 4, src_colors, n_mom>(cType, X, red_size, source_position, mom, fft_type,
+                                                               batched, location);
   } else {
     errorQuda("Unsupported spin.\n");
   }
@@ -207,7 +264,7 @@ int launch_contract_test(const QudaContractType cType, const std::array<int, 4>
 
 // Functions used for Google testing
 // Performs the CPU GPU comparison with the given parameters
-int contract(test_t param)
+int contract(test_t param, bool batched, QudaFieldLocation location)
 {
   if (xdim % 2) errorQuda("odd local x-dimension is not supported");
 
@@ -244,11 +301,19 @@ int contract(test_t param)
   int faults = 0;
 
   constexpr int src_colors = 1;
+  // the batched contraction is run with color-diluted sources, so that it contracts several pairs
+  constexpr int src_colors_batched = 3;
 
   if (test_prec == QUDA_SINGLE_PRECISION) {
-    faults = launch_contract_test<float, src_colors, n_mom>(cType, X, nSpin, red_size, source_position, mom, fft_type);
+    faults = batched ? launch_contract_test<float, src_colors_batched, n_mom>(cType, X, nSpin, red_size, source_position,
+                                                                              mom, fft_type, batched, location) :
+                       launch_contract_test<float, src_colors, n_mom>(cType, X, nSpin, red_size, source_position, mom,
+                                                                      fft_type, batched, location);
   } else if (test_prec == QUDA_DOUBLE_PRECISION) {
-    faults = launch_contract_test<double, src_colors, n_mom>(cType, X, nSpin, red_size, source_position, mom, fft_type);
+    faults = batched ? launch_contract_test<double, src_colors_batched, n_mom>(cType, X, nSpin, red_size, source_position,
+                                                                               mom, fft_type, batched, location) :
+                       launch_contract_test<double, src_colors, n_mom>(cType, X, nSpin, red_size, source_position, mom,
+                                                                       fft_type, batched, location);
   } else {
     errorQuda("Unsupported precision.\n");
   }
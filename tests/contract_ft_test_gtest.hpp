@@ -12,20 +12,22 @@ public:
   ContractFTTest() : param(GetParam()) { }
 };
 
-bool skip_test(test_t param)
+bool skip_test(test_t param, bool batched = false)
 {
   auto contract_type = ::testing::get<0>(param);
   auto prec = ::testing::get<1>(param);
 
-  // skip spin 4 cases
-  if (contract_type == QUDA_CONTRACT_TYPE_DR_FT_T or contract_type == QUDA_CONTRACT_TYPE_DR_FT_Z) return true;
+  // the spin 4 cases of contractFTQuda are not yet re-activated, so
+  // these are only checked through the batched contraction
+  if (!batched and (contract_type == QUDA_CONTRACT_TYPE_DR_FT_T or contract_type == QUDA_CONTRACT_TYPE_DR_FT_Z))
+    return true;
   if (prec < QUDA_SINGLE_PRECISION) return true; // outer precision >= sloppy precision
   if (!(QUDA_PRECISION & prec)) return true;     // precision not enabled so skip it
 
   return false;
 }
 
-int contract(test_t param);
+int contract(test_t param, bool batched = false, QudaFieldLocation location = QUDA_CUDA_FIELD_LOCATION);
 
 TEST_P(ContractFTTest, verify)
 {
@@ -35,6 +37,17 @@ TEST_P(ContractFTTest, verify)
   EXPECT_EQ(faults, 0) << "CPU and GPU implementations do not agree";
 }
 
+TEST_P(ContractFTTest, batched)
+{
+  if (skip_test(GetParam(), true)) GTEST_SKIP();
+
+  for (auto location : {QUDA_CUDA_FIELD_LOCATION, QUDA_CPU_FIELD_LOCATION}) {
+    auto faults = contract(GetParam(), true, location);
+    EXPECT_EQ(faults, 0) << "CPU and batched " << (location == QUDA_CUDA_FIELD_LOCATION ? "device" : "host")
+                         << " implementations do not agree";
+  }
+}
+
 std::string gettestname(::testing::TestParamInfo<test_t> param)
 {
   std::string str("contract_");
@@ -48,7 +61,7 @@ std::string gettestname(::testing::TestParamInfo<test_t> param)
 using ::testing::Combine;
 using ::testing::Values;
 
-auto contract_types = Values(QUDA_CONTRACT_TYPE_STAGGERED_FT_T); // FIXME : extend if needed
+auto contract_types = Values(QUDA_CONTRACT_TYPE_STAGGERED_FT_T, QUDA_CONTRACT_TYPE_DR_FT_T, QUDA_CONTRACT_TYPE_DR_FT_Z);
 
 auto precisions = Values(QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION);
 
@@ -59,7 +59,9 @@ void display_test_info(QudaEigParam &param)
     printfQuda(" - Operator: daggered (%s) , norm-op (%s), even-odd pc (%s)\n", param.use_dagger ? "true" : "false",
                param.use_norm_op ? "true" : "false", param.use_pc ? "true" : "false");
   }
-  if (param.use_poly_acc) {
+  if (param.use_poly_acc && param.poly_acc_auto) {
+    printfQuda(" - Chebyshev polynomial degree and minimum will be selected from a spectral density estimate\n");
+  } else if (param.use_poly_acc) {
     printfQuda(" - Chebyshev polynomial degree %d\n", param.poly_deg);
     printfQuda(" - Chebyshev polynomial minumum %e\n", param.a_min);
     if (param.a_max <= 0)
@@ -133,7 +135,7 @@ void init(int argc, char **argv)
   }
 }
 
-std::vector<double> eigensolve(test_t test_param)
+std::vector<double> eigensolve(test_t test_param, bool poly_acc_auto, std::vector<double> *evals_out)
 {
   // Collect testing parameters from gtest
   eig_inv_param.cuda_prec = ::testing::get<0>(test_param);
@@ -163,14 +165,17 @@ std::vector<double> eigensolve(test_t test_param)
 
   // For gtest testing, we prohibit the use of polynomial acceleration as
   // the fine tuning required can inhibit convergence of an otherwise
-  // perfectly good algorithm. We also have a default value of 4
-  // for the block size in Block TRLM, and 4 for the batched rotation.
+  // perfectly good algorithm, unless the test asks for the Chebyshev
+  // window to be selected from the spectral density estimate. We also
+  // have a default value of 4 for the block size in Block TRLM, and 4
+  // for the batched rotation.
   // The user may change these values via the command line:
   // --eig-block-size
   // --eig-batched-rotate
   if (enable_testing) {
-    eig_use_poly_acc = false;
-    eig_param.use_poly_acc = QUDA_BOOLEAN_FALSE;
+    eig_use_poly_acc = poly_acc_auto;
+    eig_param.use_poly_acc = poly_acc_auto ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+    eig_param.poly_acc_auto = poly_acc_auto ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
     eig_block_size != 4 ? eig_param.block_size = eig_block_size : eig_param.block_size = 4;
     eig_batched_rotate != 0 ? eig_param.batched_rotate = eig_batched_rotate : eig_param.batched_rotate = 4;
   }
@@ -221,6 +226,11 @@ std::vector<double> eigensolve(test_t test_param)
   host_timer.stop();
   printfQuda("Time for %s solution = %f\n", eig_param.arpack_check ? "ARPACK" : "QUDA", host_timer.last());
 
+  if (evals_out) {
+    evals_out->resize(eig_n_conv);
+    for (int i = 0; i < eig_n_conv; i++) (*evals_out)[i] = __real__ evals[i];
+  }
+
   std::vector<double> residua(eig_n_conv, 0.0);
   // Perform host side verification of eigenvector if requested.
   if (verify_results) {
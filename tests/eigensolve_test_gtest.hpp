@@ -58,7 +58,7 @@ public:
   }
 };
 
-std::vector<double> eigensolve(test_t test_param);
+std::vector<double> eigensolve(test_t test_param, bool poly_acc_auto = false, std::vector<double> *evals_out = nullptr);
 
 TEST_P(EigensolveTest, verify)
 {
@@ -73,10 +73,52 @@ TEST_P(EigensolveTest, verify)
   // The solution to avoid this is to use a Krylov space (eig-n-kr) about 3-4 times the
   // size of the search space (eig-n-ev), or use a well chosen Chebyshev polynomial,
   // or use a tighter than necessary tolerance.
-  if (eig_param.eig_type == QUDA_EIG_IR_ARNOLDI || eig_param.eig_type == QUDA_EIG_BLK_IR_ARNOLDI) tol *= 15;
+  auto eig_type = ::testing::get<1>(GetParam());
+  if (eig_type == QUDA_EIG_IR_ARNOLDI || eig_type == QUDA_EIG_BLK_IR_ARNOLDI || eig_type == QUDA_EIG_KRYLOV_SCHUR)
+    tol *= 15;
   for (auto rsd : eigensolve(GetParam())) EXPECT_LE(rsd, tol);
 }
 
+TEST_P(EigensolveTest, kpm)
+{
+  if (skip_test(GetParam())) GTEST_SKIP();
+  // the spectral density estimate is only used for the smallest eigenvalues of a hermitian operator
+  if (::testing::get<1>(GetParam()) != QUDA_EIG_TR_LANCZOS || ::testing::get<2>(GetParam()) != QUDA_BOOLEAN_TRUE
+      || ::testing::get<5>(GetParam()) != QUDA_SPECTRUM_SR_EIG)
+    GTEST_SKIP();
+
+  auto tol = ::testing::get<0>(GetParam()) == QUDA_SINGLE_PRECISION ? 1e-5 : 1e-12;
+  eig_param.tol = tol;
+
+  // the estimate overwrites the Chebyshev window, so restore it afterwards
+  const double a_min = eig_param.a_min;
+  const double a_max = eig_param.a_max;
+  const int poly_deg = eig_param.poly_deg;
+  eig_param.a_max = 0.0;
+
+  std::vector<double> evals;
+  for (auto rsd : eigensolve(GetParam(), true, &evals)) EXPECT_LE(rsd, tol);
+  if (eig_param.compute_svd == QUDA_BOOLEAN_TRUE)
+    for (auto &e : evals) e *= e;
+
+  // The Jackson-damped expansion resolves the density to within
+  // pi (upper - lower) / n_moments, with the normal operator spectrum in
+  // [0, a_max], so the estimated n_conv-th eigenvalue must lie within
+  // that resolution of the computed one
+  const double resolution = M_PI * eig_param.a_max / eig_param.kpm_n_moments;
+  EXPECT_GT(eig_param.kpm_eval_n_conv, 0.0);
+  EXPECT_NEAR(eig_param.kpm_eval_n_conv, *std::max_element(evals.begin(), evals.end()), resolution);
+
+  // the selected window must suppress the wanted part of the spectrum
+  EXPECT_GE(eig_param.a_min, eig_param.kpm_eval_n_conv);
+  EXPECT_LT(eig_param.a_min, eig_param.a_max);
+  EXPECT_GE(eig_param.poly_deg, 1);
+
+  eig_param.a_min = a_min;
+  eig_param.a_max = a_max;
+  eig_param.poly_deg = poly_deg;
+}
+
 std::string gettestname(::testing::TestParamInfo<test_t> param)
 {
   std::string name;
@@ -96,10 +138,11 @@ using ::testing::Combine;
 using ::testing::Values;
 
 // Can solve hermitian systems
-auto hermitian_solvers = Values(QUDA_EIG_TR_LANCZOS, QUDA_EIG_BLK_TR_LANCZOS, QUDA_EIG_IR_ARNOLDI);
+auto hermitian_solvers
+  = Values(QUDA_EIG_TR_LANCZOS, QUDA_EIG_BLK_TR_LANCZOS, QUDA_EIG_IR_ARNOLDI, QUDA_EIG_KRYLOV_SCHUR);
 
 // Can solve non-hermitian systems
-auto non_hermitian_solvers = Values(QUDA_EIG_IR_ARNOLDI);
+auto non_hermitian_solvers = Values(QUDA_EIG_IR_ARNOLDI, QUDA_EIG_KRYLOV_SCHUR);
 
 // Eigensolver spectrum types
 auto hermitian_spectrum = Values(QUDA_SPECTRUM_LR_EIG, QUDA_SPECTRUM_SR_EIG);
@@ -1,3 +1,4 @@
+#include <memory>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -199,6 +200,8 @@ struct GaugeAlgTest : public ::testing::TestWithParam<test_t> {
         break;
       case 1: run_ovr(); break;
       case 2: run_fft(); break;
+      case 3: run_ovr_host(); break;
+      case 4: run_fft_host(); break;
       default: errorQuda("Invalid test type %d", test_type);
       }
 
@@ -229,7 +232,7 @@ struct GaugeAlgTest : public ::testing::TestWithParam<test_t> {
   {
     if (execute) {
       gaugeFixingOVR(*U, gf_gauge_dir, gf_maxiter, gf_verbosity_interval, gf_ovr_relaxation_boost, gf_tolerance,
-                     gf_reunit_interval, gf_theta_condition);
+                     gf_reunit_interval, gf_theta_condition, gf_quality_interval);
       auto plaq_gf = plaquette(*U);
       printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
       printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
@@ -238,6 +241,74 @@ struct GaugeAlgTest : public ::testing::TestWithParam<test_t> {
       if (gauge_store) save_gauge();
     }
   }
+
+  virtual void run_ovr_host()
+  {
+    if (execute) {
+      auto host = copyGauge(QUDA_CPU_FIELD_LOCATION);
+      gaugeFixingOVR(*host, gf_gauge_dir, gf_maxiter, gf_verbosity_interval, gf_ovr_relaxation_boost, gf_tolerance,
+                     gf_reunit_interval, gf_theta_condition, gf_quality_interval, gf_ovr_tile);
+      U->copy(*host);
+      auto plaq_gf = plaquette(*U);
+      printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
+      printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
+      ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
+      // Save if output string is specified
+      if (gauge_store) save_gauge();
+    }
+  }
+
+  /**
+     @brief Return a copy of the gauge field at the given location
+  */
+  std::unique_ptr<GaugeField> copyGauge(QudaFieldLocation location)
+  {
+    GaugeFieldParam gParam(*U);
+    gParam.create = QUDA_NULL_FIELD_CREATE;
+    gParam.location = location;
+    gParam.mem_type = location == QUDA_CUDA_FIELD_LOCATION ? QUDA_MEMORY_DEVICE : QUDA_MEMORY_HOST;
+    auto u = std::make_unique<GaugeField>(gParam);
+    u->copy(*U);
+    return u;
+  }
+
+  /**
+     @brief Return the interior of a gauge field in double precision QDP order on the host
+  */
+  GaugeField interior(const GaugeField &u)
+  {
+    GaugeFieldParam gParam(param);
+    gParam.create = QUDA_NULL_FIELD_CREATE;
+    gParam.location = u.Location();
+    gParam.mem_type = u.Location() == QUDA_CUDA_FIELD_LOCATION ? QUDA_MEMORY_DEVICE : QUDA_MEMORY_HOST;
+    gParam.reconstruct = u.Reconstruct();
+    gParam.setPrecision(u.Precision(), true);
+    GaugeField v(gParam);
+    copyExtendedGauge(v, u, u.Location());
+
+    GaugeFieldParam qdpParam(param);
+    qdpParam.create = QUDA_NULL_FIELD_CREATE;
+    qdpParam.location = QUDA_CPU_FIELD_LOCATION;
+    qdpParam.setPrecision(QUDA_DOUBLE_PRECISION);
+    GaugeField qdp(qdpParam);
+    qdp.copy(v);
+    return qdp;
+  }
+
+  double maxDeviation(const GaugeField &a, const GaugeField &b)
+  {
+    auto u = interior(a);
+    auto v = interior(b);
+    double max_deviation = 0.0;
+    for (int d = 0; d < 4; d++) {
+      auto u_d = u.data<double *>(d);
+      auto v_d = v.data<double *>(d);
+      for (auto i = 0lu; i < V * gauge_site_size; i++)
+        max_deviation = std::max(max_deviation, std::abs(u_d[i] - v_d[i]));
+    }
+    comm_allreduce_max(max_deviation);
+    return max_deviation;
+  }
   virtual void run_fft()
   {
     if (execute) {
@@ -258,6 +329,28 @@ struct GaugeAlgTest : public ::testing::TestWithParam<test_t> {
     }
   }
 
+  virtual void run_fft_host()
+  {
+    if (execute) {
+      if (!comm_partitioned()) {
+        printfQuda("Landau gauge fixing with steepest descent method with FFTs on the host\n");
+        auto host = copyGauge(QUDA_CPU_FIELD_LOCATION);
+        gaugeFixingFFT(*host, gf_gauge_dir, gf_maxiter, gf_verbosity_interval, gf_fft_alpha, gf_fft_autotune,
+                       gf_tolerance, gf_theta_condition);
+        U->copy(*host);
+
+        auto plaq_gf = plaquette(*U);
+        printfQuda("Plaq:    %.16e, %.16e, %.16e\n", plaq.x, plaq.y, plaq.z);
+        printfQuda("Plaq GF: %.16e, %.16e, %.16e\n", plaq_gf.x, plaq_gf.y, plaq_gf.z);
+        ASSERT_TRUE(comparePlaquette(plaq, plaq_gf));
+        // Save if output string is specified
+        if (gauge_store) save_gauge();
+      } else {
+        errorQuda("Cannot perform FFT gauge fixing with MPI partitions.");
+      }
+    }
+  }
+
   virtual void save_gauge()
   {
     printfQuda("Saving the gauge field to file %s\n", gauge_outfile.c_str());
@@ -298,6 +391,73 @@ TEST_P(GaugeAlgTest, Generation)
   }
 }
 
+TEST_P(GaugeAlgTest, Generation_Host)
+{
+  if (execute && !comm_partitioned()) {
+    printfQuda("Heatbath on the host\n");
+    auto host = copyGauge(QUDA_CPU_FIELD_LOCATION);
+    RNG device_rng(*U, 4321);
+    RNG host_rng(*host, 4321, QUDA_CPU_FIELD_LOCATION);
+
+    // starting from the same configuration, the host and device
+    // ensembles must agree within statistical fluctuations
+    constexpr int n_steps = 2;
+    int *num_failures_h = static_cast<int *>(mapped_malloc(sizeof(int)));
+    int *num_failures_d = static_cast<int *>(get_mapped_device_pointer(num_failures_h));
+    int num_failures_host = 0;
+    *num_failures_h = 0;
+    for (int step = 0; step < n_steps; step++) {
+      Monte(*U, device_rng, heatbath_beta_value, heatbath_num_heatbath_per_step, heatbath_num_overrelax_per_step);
+      unitarizeLinks(*U, num_failures_d);
+      Monte(*host, host_rng, heatbath_beta_value, heatbath_num_heatbath_per_step, heatbath_num_overrelax_per_step);
+      unitarizeLinks(*host, &num_failures_host);
+    }
+    qudaDeviceSynchronize();
+    int num_failures_device = *num_failures_h;
+    host_free(num_failures_h);
+    ASSERT_EQ(num_failures_device, 0);
+    ASSERT_EQ(num_failures_host, 0);
+
+    auto plaq_device = plaquette(*U);
+    U->copy(*host);
+    auto plaq_host = plaquette(*U);
+    printfQuda("Plaq device: %.16e, %.16e, %.16e\n", plaq_device.x, plaq_device.y, plaq_device.z);
+    printfQuda("Plaq host:   %.16e, %.16e, %.16e\n", plaq_host.x, plaq_host.y, plaq_host.z);
+    ASSERT_NEAR(plaq_device.x, plaq_host.x, 1e-2);
+    ASSERT_NEAR(plaq_device.y, plaq_host.y, 1e-2);
+    ASSERT_NEAR(plaq_device.z, plaq_host.z, 1e-2);
+  }
+}
+
+TEST_P(GaugeAlgTest, Generation_Counter)
+{
+  if (execute) {
+    printfQuda("Gaussian gauge field from the counter-based generator on the host and device\n");
+    auto host = copyGauge(QUDA_CPU_FIELD_LOCATION);
+    auto second = copyGauge(QUDA_CUDA_FIELD_LOCATION);
+
+    // the host and device draw identical streams, so the fields only
+    // differ by the rounding of the exponentiation
+    CounterRNG device_rng(4321);
+    CounterRNG host_rng(4321);
+    gaugeGauss(*U, device_rng, 0.5);
+    gaugeGauss(*host, host_rng, 0.5);
+    double deviation = maxDeviation(*U, *host);
+    printfQuda("Host and device counter-based noise maximum deviation = %e\n", deviation);
+    ASSERT_LE(deviation, precision == QUDA_DOUBLE_PRECISION ? 1e-10 : 1e-4);
+
+    // each call consumes one value of the call counter
+    ASSERT_EQ(device_rng.Counter(), 1u);
+    gaugeGauss(*host, host_rng, 0.5);
+    CounterRNG restart_rng(4321, 1);
+    gaugeGauss(*second, restart_rng, 0.5);
+    deviation = maxDeviation(*second, *host);
+    printfQuda("Host and device restarted counter-based noise maximum deviation = %e\n", deviation);
+    ASSERT_LE(deviation, precision == QUDA_DOUBLE_PRECISION ? 1e-10 : 1e-4);
+    ASSERT_GT(maxDeviation(*U, *second), 0.0);
+  }
+}
+
 TEST_P(GaugeAlgTest, Landau_Overrelaxation)
 {
   if (execute) {
@@ -324,6 +484,33 @@ TEST_P(GaugeAlgTest, Coulomb_Overrelaxation)
   }
 }
 
+TEST_P(GaugeAlgTest, Landau_Overrelaxation_Host)
+{
+  if (execute) {
+    printfQuda("Landau gauge fixing with overrelaxation on the host\n");
+    auto host = copyGauge(QUDA_CPU_FIELD_LOCATION);
+    auto host_untiled = copyGauge(QUDA_CPU_FIELD_LOCATION);
+
+    // apply a fixed number of steps, with zero tolerance so there is no early exit
+    constexpr int n_steps = 10;
+    gaugeFixingOVR(*U, 4, n_steps, gf_verbosity_interval, gf_ovr_relaxation_boost, 0.0, gf_reunit_interval,
+                   gf_theta_condition, gf_quality_interval);
+    gaugeFixingOVR(*host, 4, n_steps, gf_verbosity_interval, gf_ovr_relaxation_boost, 0.0, gf_reunit_interval,
+                   gf_theta_condition, gf_quality_interval, gf_ovr_tile);
+    gaugeFixingOVR(*host_untiled, 4, n_steps, gf_verbosity_interval, gf_ovr_relaxation_boost, 0.0,
+                   gf_reunit_interval, gf_theta_condition, gf_quality_interval, 0);
+
+    // points of the same parity are independent, so the update order cannot change the result
+    double tile_deviation = maxDeviation(*host, *host_untiled);
+    printfQuda("Tiled and untiled host gauge fixing maximum deviation = %e\n", tile_deviation);
+    ASSERT_EQ(tile_deviation, 0.0);
+
+    double deviation = maxDeviation(*U, *host);
+    printfQuda("Host and device gauge fixing maximum deviation = %e\n", deviation);
+    ASSERT_LE(deviation, precision == QUDA_DOUBLE_PRECISION ? 1e-10 : 1e-4);
+  }
+}
+
 TEST_P(GaugeAlgTest, Landau_FFT)
 {
   if (execute) {
@@ -354,6 +541,25 @@ TEST_P(GaugeAlgTest, Coulomb_FFT)
   }
 }
 
+TEST_P(GaugeAlgTest, Landau_FFT_Host)
+{
+  if (execute) {
+    if (!comm_partitioned()) {
+      printfQuda("Landau gauge fixing with steepest descent method with FFTs on the host\n");
+      auto host = copyGauge(QUDA_CPU_FIELD_LOCATION);
+
+      // apply a fixed number of steps, with zero tolerance and no autotuning so both take identical steps
+      constexpr int n_steps = 10;
+      gaugeFixingFFT(*U, 4, n_steps, gf_verbosity_interval, gf_fft_alpha, 0, 0.0, gf_theta_condition);
+      gaugeFixingFFT(*host, 4, n_steps, gf_verbosity_interval, gf_fft_alpha, 0, 0.0, gf_theta_condition);
+
+      double deviation = maxDeviation(*U, *host);
+      printfQuda("Host and device FFT gauge fixing maximum deviation = %e\n", deviation);
+      ASSERT_LE(deviation, precision == QUDA_DOUBLE_PRECISION ? 1e-10 : 1e-4);
+    }
+  }
+}
+
 struct gauge_alg_test : quda_test {
 
   void display_info() const override
@@ -364,6 +570,8 @@ struct gauge_alg_test : quda_test {
     case 0: printfQuda("\n Google testing\n"); break;
     case 1: printfQuda("\nOVR gauge fix\n"); break;
     case 2: printfQuda("\nFFT gauge fix\n"); break;
+    case 3: printfQuda("\nOVR gauge fix on the host\n"); break;
+    case 4: printfQuda("\nFFT gauge fix on the host\n"); break;
     default: errorQuda("Undefined test type %d given", test_type);
     }
 
@@ -380,7 +588,7 @@ struct gauge_alg_test : quda_test {
     add_heatbath_option_group(app);
 
     test_type = 0;
-    CLI::TransformPairs<int> test_type_map {{"Google", 0}, {"OVR", 1}, {"FFT", 2}};
+    CLI::TransformPairs<int> test_type_map {{"Google", 0}, {"OVR", 1}, {"FFT", 2}, {"OVR_host", 3}, {"FFT_host", 4}};
     app->add_option("--test", test_type, "Test method")->transform(CLI::CheckedTransformer(test_type_map));
   }
 
@@ -0,0 +1,461 @@
+#include <memory>
+#include <vector>
+#include <gauge_field.h>
+#include <gauge_tools.h>
+#include <gauge_cache.h>
+#include <test.h>
+
+/*
+   This test checks the gauge field tools on a random SU(3) field:
+
+   - GaugeObservablesTest: the fused gauge observable kernel, which
+     computes the plaquette, field energy and topological charge (and
+     optionally the charge density) in a single pass, against the
+     unfused computation: plaquette(), followed by computeFmunu() and
+     computeQChargeDensity().  The fused kernel is run on both the
+     device and the host.
+
+   - GaugeFlowTest: the Wilson and Symanzik flow.  First, the host
+     execution of the flow kernels, including the embedded error
+     estimate of the adaptive integrator, is checked against the
+     device.  Second, the adaptive step-size flow is checked against
+     the fixed step-size flow at a given flow time.
+
+   - GaugeSmearTest: the multi-step gauge smearing, where each halo
+     exchange is followed by several smearing steps computed on a
+     widened extended region.  First, the host execution is checked
+     against the device.  Second, the result is checked against the
+     original smearing, which exchanges the halo every step.  Run with
+     --partition 15 to exercise the halo updates on a single process.
+
+   - GaugeCacheTest: the cache of derived gauge fields.  First, the
+     least-recently-used spilling and eviction is checked with a
+     budget of a single field each on the device and the host.
+     Second, repeating a smearing of the resident gauge field is
+     checked to be a cache hit that reproduces the original result.
+ */
+
+using namespace quda;
+
+/**
+   @brief Common fixture that constructs a random SU(3) host gauge
+   field in QDP order, with helpers for moving it to and from
+   extended native fields at either location.
+*/
+struct RandomGaugeTest {
+
+  QudaGaugeParam gauge_param;
+  void *gauge[4];
+
+  RandomGaugeTest()
+  {
+    gauge_param = newQudaGaugeParam();
+    setWilsonGaugeParam(gauge_param);
+    gauge_param.cpu_prec = QUDA_DOUBLE_PRECISION;
+    gauge_param.cuda_prec = QUDA_DOUBLE_PRECISION;
+    gauge_param.reconstruct = QUDA_RECONSTRUCT_NO;
+    gauge_param.t_boundary = QUDA_PERIODIC_T;
+    setDims(gauge_param.X);
+
+    for (int dir = 0; dir < 4; dir++) gauge[dir] = safe_malloc(V * gauge_site_size * sizeof(double));
+    constructQudaGaugeField(gauge, 1, gauge_param.cpu_prec, &gauge_param); // random SU(3) field
+  }
+
+  ~RandomGaugeTest()
+  {
+    for (int dir = 0; dir < 4; dir++) host_free(gauge[dir]);
+  }
+
+  /**
+     @brief Create a native gauge field at the given location from
+     the host gauge field
+  */
+  GaugeField nativeGauge(QudaFieldLocation location)
+  {
+    GaugeFieldParam param(gauge_param, gauge);
+    GaugeField cpu(param);
+
+    param.create = QUDA_NULL_FIELD_CREATE;
+    param.setPrecision(QUDA_DOUBLE_PRECISION, true);
+    param.location = location;
+    param.mem_type = location == QUDA_CUDA_FIELD_LOCATION ? QUDA_MEMORY_DEVICE : QUDA_MEMORY_HOST;
+    GaugeField u(param);
+    u.copy(cpu);
+    return u;
+  }
+
+  /**
+     @brief Create an extended native gauge field at the given
+     location from the host gauge field, with a halo of depth r in
+     partitioned dimensions
+  */
+  std::unique_ptr<GaugeField> extendedGauge(QudaFieldLocation location, int r = 2)
+  {
+    lat_dim_t R;
+    for (int d = 0; d < 4; d++) R[d] = r * comm_dim_partitioned(d);
+    auto u = nativeGauge(location);
+    return std::unique_ptr<GaugeField>(createExtendedGauge(u, R));
+  }
+
+  /**
+     @brief Return the interior of an extended field in QDP order on the host
+  */
+  GaugeField result(const GaugeField &u)
+  {
+    GaugeFieldParam param(gauge_param);
+    param.create = QUDA_NULL_FIELD_CREATE;
+    param.setPrecision(QUDA_DOUBLE_PRECISION, true);
+    param.location = u.Location();
+    param.mem_type = u.Location() == QUDA_CUDA_FIELD_LOCATION ? QUDA_MEMORY_DEVICE : QUDA_MEMORY_HOST;
+    GaugeField interior(param);
+    copyExtendedGauge(interior, u, u.Location());
+
+    GaugeFieldParam param_qdp(gauge_param);
+    param_qdp.create = QUDA_NULL_FIELD_CREATE;
+    GaugeField qdp(param_qdp);
+    qdp.copy(interior);
+    return qdp;
+  }
+
+  /**
+     @brief Return the maximum deviation between two QDP-ordered host fields
+  */
+  double maxDeviation(const GaugeField &a, const GaugeField &b)
+  {
+    double max_deviation = 0.0;
+    for (int d = 0; d < 4; d++) {
+      auto u = a.data<double *>(d);
+      auto v = b.data<double *>(d);
+      for (auto i = 0lu; i < V * gauge_site_size; i++) max_deviation = std::max(max_deviation, std::abs(u[i] - v[i]));
+    }
+    comm_allreduce_max(max_deviation);
+    return max_deviation;
+  }
+};
+
+struct GaugeObservablesTest : RandomGaugeTest, ::testing::TestWithParam<QudaFieldLocation> { };
+
+TEST_P(GaugeObservablesTest, verify)
+{
+  auto location = GetParam();
+  size_t size = V * sizeof(double);
+
+  // reference: unfused computation on the device
+  auto u_ref = extendedGauge(QUDA_CUDA_FIELD_LOCATION);
+  double3 plaq_ref = plaquette(*u_ref);
+
+  lat_dim_t x;
+  for (int i = 0; i < 4; i++) x[i] = u_ref->X()[i] - 2 * u_ref->R()[i];
+  GaugeFieldParam tensor_param(x, u_ref->Precision(), QUDA_RECONSTRUCT_NO, 0, QUDA_TENSOR_GEOMETRY);
+  tensor_param.location = QUDA_CUDA_FIELD_LOCATION;
+  tensor_param.siteSubset = QUDA_FULL_SITE_SUBSET;
+  tensor_param.order = QUDA_FLOAT2_GAUGE_ORDER;
+  tensor_param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+  GaugeField fmunu(tensor_param);
+  computeFmunu(fmunu, *u_ref);
+
+  double energy_ref[3];
+  double qcharge_ref;
+  std::vector<double> density_ref(V);
+  void *d_density = pool_device_malloc(size);
+  computeQChargeDensity(energy_ref, qcharge_ref, d_density, fmunu);
+  qudaMemcpy(density_ref.data(), d_density, size, qudaMemcpyDeviceToHost);
+
+  // fused computation at the requested location
+  auto u = location == QUDA_CUDA_FIELD_LOCATION ? std::move(u_ref) : extendedGauge(location);
+  double plaq[3];
+  double energy[3];
+  double qcharge;
+  std::vector<double> density(V);
+  void *density_ptr = location == QUDA_CUDA_FIELD_LOCATION ? d_density : density.data();
+  if (location == QUDA_CUDA_FIELD_LOCATION) qudaMemset(d_density, 0, size);
+  gaugeObservablesFused(*u, plaq, energy, qcharge, density_ptr);
+  if (location == QUDA_CUDA_FIELD_LOCATION) qudaMemcpy(density.data(), d_density, size, qudaMemcpyDeviceToHost);
+  pool_device_free(d_density);
+
+  // the charge alone, without the density
+  double energy_nodensity[3];
+  double qcharge_nodensity;
+  gaugeObservablesFused(*u, plaq, energy_nodensity, qcharge_nodensity);
+
+  printfQuda("Plaquette %.16e %.16e, energy %.16e %.16e, charge %.16e %.16e (fused, unfused)\n", plaq[0], plaq_ref.x,
+             energy[0], energy_ref[0], qcharge, qcharge_ref);
+
+  constexpr double tol = 1e-12;
+  EXPECT_NEAR(plaq[0], plaq_ref.x, tol);
+  EXPECT_NEAR(plaq[1], plaq_ref.y, tol);
+  EXPECT_NEAR(plaq[2], plaq_ref.z, tol);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_NEAR(energy[i], energy_ref[i], tol * std::abs(energy_ref[0]));
+    EXPECT_NEAR(energy_nodensity[i], energy_ref[i], tol * std::abs(energy_ref[0]));
+  }
+  EXPECT_NEAR(qcharge, qcharge_ref, tol);
+  EXPECT_NEAR(qcharge_nodensity, qcharge_ref, tol);
+
+  double max_deviation = 0.0;
+  for (auto i = 0lu; i < V; i++) max_deviation = std::max(max_deviation, std::abs(density[i] - density_ref[i]));
+  comm_allreduce_max(max_deviation);
+  printfQuda("Charge density maximum deviation = %e\n", max_deviation);
+  EXPECT_LE(max_deviation, tol);
+}
+
+INSTANTIATE_TEST_SUITE_P(GaugeObservables, GaugeObservablesTest,
+                         ::testing::Values(QUDA_CUDA_FIELD_LOCATION, QUDA_CPU_FIELD_LOCATION),
+                         [](testing::TestParamInfo<QudaFieldLocation> param) {
+                           return param.param == QUDA_CUDA_FIELD_LOCATION ? "device" : "host";
+                         });
+
+constexpr double flow_epsilon = 0.01;
+constexpr int n_flow_steps = 100;
+
+struct GaugeFlowTest : RandomGaugeTest, ::testing::TestWithParam<QudaGaugeSmearType> {
+
+  /**
+     @brief Apply a number of flow steps to the gauge field at a
+     given location, returning the flowed field in QDP order on the
+     host together with the error estimate of the final step
+  */
+  std::pair<GaugeField, double> flow(QudaFieldLocation location, int n)
+  {
+    auto in = extendedGauge(location);
+    GaugeFieldParam param_ex(*in);
+    GaugeField out(param_ex);
+    auto u = nativeGauge(location);
+    GaugeFieldParam param(u);
+    GaugeField temp(param);
+    GaugeField embedded(param);
+
+    double err = 0.0;
+    for (int i = 0; i < n; i++) {
+      err = WFlowStep(out, temp, embedded, *in, flow_epsilon, GetParam());
+      std::swap(*in, out);
+    }
+
+    return {result(*in), err};
+  }
+};
+
+TEST_P(GaugeFlowTest, host)
+{
+  constexpr int n = 3;
+  auto [device, device_err] = flow(QUDA_CUDA_FIELD_LOCATION, n);
+  auto [host, host_err] = flow(QUDA_CPU_FIELD_LOCATION, n);
+
+  double max_deviation = maxDeviation(device, host);
+
+  printfQuda("Host and device flow maximum deviation = %e, error estimate %e (device) %e (host)\n", max_deviation,
+             device_err, host_err);
+  EXPECT_LE(max_deviation, 1e-12);
+  EXPECT_NEAR(device_err, host_err, 1e-12);
+}
+
+TEST_P(GaugeFlowTest, adaptive)
+{
+  loadGaugeQuda(gauge, &gauge_param);
+
+  QudaGaugeObservableParam obs_param[2];
+  QudaGaugeObservableParam obs_param_adaptive[2];
+  for (int i = 0; i < 2; i++) {
+    obs_param[i] = newQudaGaugeObservableParam();
+    obs_param[i].compute_plaquette = QUDA_BOOLEAN_TRUE;
+    obs_param[i].compute_qcharge = QUDA_BOOLEAN_TRUE;
+    obs_param_adaptive[i] = obs_param[i];
+  }
+
+  QudaGaugeSmearParam smear_param = newQudaGaugeSmearParam();
+  smear_param.smear_type = GetParam();
+  smear_param.n_steps = n_flow_steps;
+  smear_param.meas_interval = n_flow_steps;
+  smear_param.epsilon = flow_epsilon;
+  performWFlowQuda(&smear_param, obs_param);
+
+  // flow to the same time adaptively, starting from a larger step
+  double t = n_flow_steps * flow_epsilon;
+  smear_param.epsilon = 0.1;
+  smear_param.tol = 1e-6;
+  smear_param.n_meas_t = 1;
+  smear_param.meas_t = &t;
+  performWFlowQuda(&smear_param, obs_param_adaptive);
+
+  printfQuda("Energy at t = %g: fixed step %.16e, adaptive %.16e\n", t, obs_param[1].energy[0],
+             obs_param_adaptive[1].energy[0]);
+  EXPECT_NEAR(obs_param[1].plaquette[0], obs_param_adaptive[1].plaquette[0], 1e-5);
+  EXPECT_NEAR(obs_param[1].energy[0], obs_param_adaptive[1].energy[0], 1e-4 * std::abs(obs_param[1].energy[0]));
+
+  freeGaugeQuda();
+}
+
+INSTANTIATE_TEST_SUITE_P(GaugeFlow, GaugeFlowTest,
+                         ::testing::Values(QUDA_GAUGE_SMEAR_WILSON_FLOW, QUDA_GAUGE_SMEAR_SYMANZIK_FLOW));
+
+constexpr int n_smear_steps = 4;
+constexpr int steps_per_exchange = 2;
+
+struct GaugeSmearTest : RandomGaugeTest, ::testing::TestWithParam<QudaGaugeSmearType> {
+
+  QudaGaugeSmearParam smear_param;
+  int dir_ignore;
+
+  GaugeSmearTest()
+  {
+    smear_param = newQudaGaugeSmearParam();
+    smear_param.smear_type = GetParam();
+    smear_param.alpha = 0.6;
+    smear_param.rho = smear_param.smear_type == QUDA_GAUGE_SMEAR_OVRIMP_STOUT ? 0.08 : 0.1;
+    smear_param.epsilon = -0.25;
+    smear_param.alpha1 = 0.75;
+    smear_param.alpha2 = 0.6;
+    smear_param.alpha3 = 0.3;
+    dir_ignore = (smear_param.smear_type == QUDA_GAUGE_SMEAR_APE || smear_param.smear_type == QUDA_GAUGE_SMEAR_STOUT) ?
+      3 :
+      -1;
+  }
+
+  /**
+     @brief Apply the multi-step smearing at a given location
+  */
+  GaugeField smear(QudaFieldLocation location)
+  {
+    auto u = extendedGauge(location, steps_per_exchange * gaugeSmearRadius(smear_param.smear_type, dir_ignore));
+    GaugeFieldParam param(*u);
+    GaugeField tmp(param);
+    gaugeSmear(*u, tmp, smear_param, n_smear_steps, dir_ignore);
+    return result(*u);
+  }
+
+  /**
+     @brief Apply the original smearing, which exchanges the halo every step
+  */
+  GaugeField smearReference()
+  {
+    auto u = extendedGauge(QUDA_CUDA_FIELD_LOCATION, 2);
+    GaugeFieldParam param(*u);
+    GaugeField tmp(param);
+    for (int i = 0; i < n_smear_steps; i++) {
+      switch (smear_param.smear_type) {
+      case QUDA_GAUGE_SMEAR_APE: APEStep(*u, tmp, smear_param.alpha, dir_ignore); break;
+      case QUDA_GAUGE_SMEAR_STOUT: STOUTStep(*u, tmp, smear_param.rho, dir_ignore); break;
+      case QUDA_GAUGE_SMEAR_OVRIMP_STOUT:
+        OvrImpSTOUTStep(*u, tmp, smear_param.rho, smear_param.epsilon, dir_ignore);
+        break;
+      case QUDA_GAUGE_SMEAR_HYP:
+        HYPStep(*u, tmp, smear_param.alpha1, smear_param.alpha2, smear_param.alpha3, dir_ignore);
+        break;
+      default: errorQuda("Unexpected gauge smear type %d", smear_param.smear_type);
+      }
+    }
+    return result(*u);
+  }
+};
+
+TEST_P(GaugeSmearTest, host)
+{
+  auto device = smear(QUDA_CUDA_FIELD_LOCATION);
+  auto host = smear(QUDA_CPU_FIELD_LOCATION);
+
+  double max_deviation = maxDeviation(device, host);
+  printfQuda("Host and device smearing maximum deviation = %e\n", max_deviation);
+  EXPECT_LE(max_deviation, 1e-12);
+}
+
+TEST_P(GaugeSmearTest, reference)
+{
+  auto u = smear(QUDA_CUDA_FIELD_LOCATION);
+  auto ref = smearReference();
+
+  double max_deviation = maxDeviation(u, ref);
+  printfQuda("Multi-step and reference smearing maximum deviation = %e\n", max_deviation);
+  EXPECT_LE(max_deviation, 1e-12);
+}
+
+INSTANTIATE_TEST_SUITE_P(GaugeSmear, GaugeSmearTest,
+                         ::testing::Values(QUDA_GAUGE_SMEAR_APE, QUDA_GAUGE_SMEAR_STOUT,
+                                           QUDA_GAUGE_SMEAR_OVRIMP_STOUT, QUDA_GAUGE_SMEAR_HYP));
+
+struct GaugeCacheTest : RandomGaugeTest, ::testing::Test {
+  ~GaugeCacheTest() { gauge_cache::set_budget(0, 0); }
+};
+
+TEST_F(GaugeCacheTest, lru)
+{
+  GaugeFieldParam param(gauge_param, gauge);
+  GaugeField cpu(param);
+
+  param.create = QUDA_NULL_FIELD_CREATE;
+  param.setPrecision(QUDA_DOUBLE_PRECISION, true);
+  param.location = QUDA_CUDA_FIELD_LOCATION;
+  param.mem_type = QUDA_MEMORY_DEVICE;
+  GaugeField u(param);
+  u.copy(cpu);
+  uint64_t checksum = gauge_cache::checksum(u);
+  EXPECT_EQ(checksum, cpu.checksum());
+
+  gauge_cache::set_budget(u.Bytes(), u.Bytes());
+  auto stats = gauge_cache::get_stats();
+
+  // the third insert spills the second entry to the host, evicting the first
+  std::vector<gauge_cache::Key> keys = {{"a", checksum, 0}, {"b", checksum, 0}, {"c", checksum, 0}};
+  for (auto &key : keys) gauge_cache::insert(key, {&u});
+  EXPECT_EQ(gauge_cache::get_stats().spills - stats.spills, 2lu);
+  EXPECT_EQ(gauge_cache::get_stats().evictions - stats.evictions, 1lu);
+
+  GaugeField v(param);
+  EXPECT_FALSE(gauge_cache::lookup(keys[0], {&v}));
+  for (int i = 1; i < 3; i++) {
+    qudaMemset(v.data(), 0, v.Bytes());
+    EXPECT_TRUE(gauge_cache::lookup(keys[i], {&v}));
+    EXPECT_EQ(gauge_cache::checksum(v), checksum);
+  }
+}
+
+TEST_F(GaugeCacheTest, smear)
+{
+  loadGaugeQuda(gauge, &gauge_param);
+  gauge_cache::set_budget(size_t(1) << 30, size_t(1) << 30);
+
+  QudaGaugeObservableParam obs_param[2][2];
+  for (int j = 0; j < 2; j++) {
+    for (int i = 0; i < 2; i++) {
+      obs_param[j][i] = newQudaGaugeObservableParam();
+      obs_param[j][i].compute_plaquette = QUDA_BOOLEAN_TRUE;
+      obs_param[j][i].compute_qcharge = QUDA_BOOLEAN_TRUE;
+    }
+  }
+
+  QudaGaugeSmearParam smear_param = newQudaGaugeSmearParam();
+  smear_param.smear_type = QUDA_GAUGE_SMEAR_STOUT;
+  smear_param.n_steps = 10;
+  smear_param.meas_interval = 10;
+  smear_param.rho = 0.1;
+
+  auto stats = gauge_cache::get_stats();
+  performGaugeSmearQuda(&smear_param, obs_param[0]);
+  EXPECT_EQ(gauge_cache::get_stats().hits, stats.hits);
+  performGaugeSmearQuda(&smear_param, obs_param[1]);
+  EXPECT_EQ(gauge_cache::get_stats().hits, stats.hits + 1);
+
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) EXPECT_EQ(obs_param[0][i].plaquette[j], obs_param[1][i].plaquette[j]);
+    EXPECT_EQ(obs_param[0][i].qcharge, obs_param[1][i].qcharge);
+  }
+
+  // the smeared field itself must match that of the original smearing
+  QudaGaugeObservableParam obs = newQudaGaugeObservableParam();
+  obs.compute_qcharge = QUDA_BOOLEAN_TRUE;
+  gaugeObservablesQuda(&obs);
+  EXPECT_EQ(obs.qcharge, obs_param[0][1].qcharge);
+
+  // a different smearing is a miss
+  smear_param.rho = 0.05;
+  performGaugeSmearQuda(&smear_param, obs_param[1]);
+  EXPECT_EQ(gauge_cache::get_stats().hits, stats.hits + 1);
+
+  freeGaugeQuda();
+}
+
+int main(int argc, char **argv)
+{
+  quda_test test("gauge_tools_test", argc, argv);
+  test.init();
+  return test.execute();
+}
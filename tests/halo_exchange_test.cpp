@@ -0,0 +1,105 @@
+#include <comm_quda.h>
+#include <halo_exchange.h>
+#include <timer.h>
+#include <test.h>
+
+/*
+   This test checks the halo exchange planner for both the
+   point-to-point and neighborhood collective backends, and
+   benchmarks the latency of each (over --niter exchanges) for small
+   halos, such as those found on coarse grids, where the per-message
+   overhead dominates.  Each exchange is a bidirectional exchange in
+   all four dimensions for a set of fields.
+ */
+
+using namespace quda;
+
+constexpr int n_field = 4;
+
+struct HaloExchangeTest : ::testing::TestWithParam<::testing::tuple<halo::Backend, int>> {
+
+  std::vector<std::vector<double>> send;
+  std::vector<std::vector<double>> recv;
+  std::vector<int> dim;
+  std::vector<int> dir;
+  size_t length;
+
+  HaloExchangeTest() : length(::testing::get<1>(GetParam()))
+  {
+    for (int f = 0; f < n_field; f++) {
+      for (int d = 0; d < 4; d++) {
+        for (int s = 0; s < 2; s++) {
+          send.emplace_back(length);
+          recv.emplace_back(length);
+          dim.push_back(d);
+          dir.push_back(s);
+        }
+      }
+    }
+  }
+
+  /**
+     @brief Execute an exchange of all segments
+  */
+  void exchange()
+  {
+    halo::Exchange halo;
+    for (auto i = 0u; i < send.size(); i++)
+      halo.add(dim[i], dir[i], send[i].data(), recv[i].data(), length * sizeof(double));
+    halo.execute();
+  }
+};
+
+TEST_P(HaloExchangeTest, verify)
+{
+  halo::set_backend(::testing::get<0>(GetParam()));
+
+  // label each element with the sending rank, segment and offset
+  for (auto i = 0u; i < send.size(); i++) {
+    for (auto j = 0u; j < length; j++) send[i][j] = (comm_rank() * send.size() + i) * length + j;
+  }
+
+  exchange();
+
+  for (auto i = 0u; i < recv.size(); i++) {
+    int src = comm_dim_partitioned(dim[i]) ? comm_neighbor_rank(1 - dir[i], dim[i]) : comm_rank();
+    for (auto j = 0u; j < length; j++) {
+      ASSERT_EQ(recv[i][j], static_cast<double>((src * send.size() + i) * length + j))
+        << "Segment " << i << " (dim = " << dim[i] << ", dir = " << dir[i] << ") element " << j;
+    }
+  }
+}
+
+TEST_P(HaloExchangeTest, benchmark)
+{
+  halo::set_backend(::testing::get<0>(GetParam()));
+
+  // create the plan before timing
+  exchange();
+
+  comm_barrier();
+  host_timer_t timer;
+  timer.start();
+  for (int i = 0; i < niter; i++) exchange();
+  comm_barrier();
+  timer.stop();
+
+  double latency = 1e6 * timer.last() / niter;
+  RecordProperty("latency_us", std::to_string(latency));
+  printfQuda("%s backend, %lu bytes per segment: %e us per exchange\n",
+             ::testing::get<0>(GetParam()) == halo::Backend::NEIGHBOR ? "Neighbor collective" : "Point-to-point",
+             length * sizeof(double), latency);
+}
+
+using ::testing::Combine;
+using ::testing::Values;
+
+INSTANTIATE_TEST_SUITE_P(HaloExchange, HaloExchangeTest,
+                         Combine(Values(halo::Backend::P2P, halo::Backend::NEIGHBOR), Values(8, 128, 2048)));
+
+int main(int argc, char **argv)
+{
+  quda_test test("halo_exchange_test", argc, argv);
+  test.init();
+  return test.execute();
+}
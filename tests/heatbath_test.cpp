@@ -9,6 +9,7 @@
 #include <host_utils.h>
 #include <command_line_params.h>
 #include <gauge_tools.h>
+#include <timer.h>
 #include "misc.h"
 
 #include <pgauge_monte.h>
@@ -53,6 +54,65 @@ void display_test_info()
              dimPartitioned(3));
 }
 
+/**
+   @brief Benchmark the heatbath on the device and on the host,
+   starting from the same configuration, and compare the resulting
+   plaquettes
+   @param[in] gaugeEx The extended device gauge field to start from
+   @param[in] beta The inverse coupling
+   @param[in] nhb Number of heatbath hits per step
+   @param[in] nover Number of overrelaxation hits per step
+*/
+void heatbath_benchmark(quda::GaugeField &gaugeEx, double beta, int nhb, int nover)
+{
+  using namespace quda;
+  if (comm_partitioned()) {
+    printfQuda("Host heatbath benchmark not supported with partitioned communication\n");
+    return;
+  }
+
+  GaugeFieldParam param(gaugeEx);
+  param.create = QUDA_NULL_FIELD_CREATE;
+  GaugeField device(param);
+  device.copy(gaugeEx);
+
+  GaugeFieldParam host_param(param);
+  host_param.location = QUDA_CPU_FIELD_LOCATION;
+  host_param.mem_type = QUDA_MEMORY_HOST;
+  GaugeField host(host_param);
+  host.copy(gaugeEx);
+
+  RNG device_rng(device, 4321);
+  RNG host_rng(host, 4321, QUDA_CPU_FIELD_LOCATION);
+
+  auto run = [&](GaugeField &u, RNG &rng) {
+    host_timer_t timer;
+    timer.start();
+    for (int step = 0; step < heatbath_benchmark_steps; step++) Monte(u, rng, beta, nhb, nover);
+    qudaDeviceSynchronize();
+    timer.stop();
+    return timer.last();
+  };
+
+  printfQuda("Benchmarking %d heatbath steps of %d heatbath and %d overrelaxation hits\n", heatbath_benchmark_steps,
+             nhb, nover);
+  double device_time = run(device, device_rng);
+  double host_time = run(host, host_rng);
+
+  // measure the host result on the device
+  GaugeField host_result(param);
+  host_result.copy(host);
+  double3 plaq[2] = {plaquette(device), plaquette(host_result)};
+
+  double sweeps = static_cast<double>(heatbath_benchmark_steps) * (nhb + nover);
+  double updates = 4.0 * V * sweeps; // link updates on this rank
+  double time[2] = {device_time, host_time};
+  const char *name[2] = {"Device", "Host"};
+  for (int i = 0; i < 2; i++)
+    printfQuda("%-6s: %.3f s, %.2f sweeps/s, %.3e link updates/s, plaquette = %.8e\n", name[i], time[i],
+               sweeps / time[i], updates / time[i], plaq[i].x);
+}
+
 void heatbath_test(int argc, char **argv)
 {
   // *** QUDA parameters begin here.
@@ -217,6 +277,8 @@ void heatbath_test(int argc, char **argv)
       printfQuda("No output file specified.\n");
     }
 
+    if (heatbath_benchmark_steps > 0) heatbath_benchmark(gaugeEx, beta_value, nhbsteps, novrsteps);
+
     // Release all temporary memory used for data exchange between GPUs in multi-GPU mode
     PGaugeExchangeFree();
   }
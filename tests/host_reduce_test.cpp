@@ -0,0 +1,105 @@
+#include <cstring>
+#include <omp.h>
+#include <blas_quda.h>
+#include <color_spinor_field.h>
+#include <test.h>
+
+/*
+   This test checks that the host reductions are bitwise reproducible
+   regardless of the number of OpenMP threads.  We compute a set of
+   single and multi reductions on host fields with one thread, and
+   then check the results are bitwise identical when using 7 and 64
+   threads.
+ */
+
+using namespace quda;
+
+constexpr int n_src = 4;
+
+struct HostReduceTest : ::testing::TestWithParam<int> {
+
+  ColorSpinorField x;
+  ColorSpinorField y;
+  std::vector<ColorSpinorField> xm;
+  std::vector<ColorSpinorField> ym;
+
+  HostReduceTest()
+  {
+    ColorSpinorParam param;
+    param.nColor = 3;
+    param.nSpin = 4;
+    param.nDim = 4;
+    param.siteSubset = QUDA_FULL_SITE_SUBSET;
+    param.x[0] = xdim;
+    param.x[1] = ydim;
+    param.x[2] = zdim;
+    param.x[3] = tdim;
+    param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+    param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+    param.setPrecision(QUDA_DOUBLE_PRECISION);
+    param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+    param.create = QUDA_ZERO_FIELD_CREATE;
+    param.pc_type = QUDA_4D_PC;
+    param.location = QUDA_CPU_FIELD_LOCATION;
+
+    x = ColorSpinorField(param);
+    y = ColorSpinorField(param);
+    resize(xm, n_src, param);
+    resize(ym, n_src, param);
+
+    x.Source(QUDA_RANDOM_SOURCE, 0, 0, 0);
+    y.Source(QUDA_RANDOM_SOURCE, 0, 0, 0);
+    for (auto &v : xm) v.Source(QUDA_RANDOM_SOURCE, 0, 0, 0);
+    for (auto &v : ym) v.Source(QUDA_RANDOM_SOURCE, 0, 0, 0);
+  }
+
+  /**
+     @brief Compute the set of reductions with the given number of
+     OpenMP threads, returning the results as a flat array of doubles
+  */
+  std::vector<double> reduce(int n_threads)
+  {
+    int n_threads_save = omp_get_max_threads();
+    omp_set_num_threads(n_threads);
+
+    std::vector<double> result;
+    result.push_back(blas::norm2(x));
+
+    auto dot = blas::cDotProduct(x, y);
+    result.push_back(dot.real());
+    result.push_back(dot.imag());
+
+    for (auto n : blas::norm2(xm)) result.push_back(n);
+
+    std::vector<Complex> block_dot(n_src * n_src);
+    blas::block::cDotProduct(block_dot, xm, ym);
+    for (auto &d : block_dot) {
+      result.push_back(d.real());
+      result.push_back(d.imag());
+    }
+
+    omp_set_num_threads(n_threads_save);
+    return result;
+  }
+};
+
+TEST_P(HostReduceTest, verify)
+{
+  auto reference = reduce(1);
+  auto result = reduce(GetParam());
+
+  ASSERT_EQ(reference.size(), result.size());
+  for (auto i = 0u; i < result.size(); i++) {
+    EXPECT_EQ(memcmp(&reference[i], &result[i], sizeof(double)), 0)
+      << "Reduction " << i << " differs with " << GetParam() << " threads: " << reference[i] << " vs " << result[i];
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(HostReduce, HostReduceTest, ::testing::Values(1, 7, 64));
+
+int main(int argc, char **argv)
+{
+  quda_test test("host_reduce_test", argc, argv);
+  test.init();
+  return test.execute();
+}
@@ -15,21 +15,24 @@
 
 template <typename T> using complex = std::complex<T>;
 
-void fillEigenArray(MatrixXcd &EigenArr, complex<double> *arr, int rows, int cols, int ld, int offset)
+// Row-major views of the reference data with a leading dimension
+using RowMatrixXcd = Matrix<complex<double>, Dynamic, Dynamic, RowMajor>;
+using ConstRowMapXcd = Map<const RowMatrixXcd, Unaligned, OuterStride<>>;
+
+template <typename Mat> MatrixXcd apply_op(const Mat &M, QudaBLASOperation op)
 {
-  int counter = offset;
-  for (int i = 0; i < rows; i++) {
-    for (int j = 0; j < cols; j++) {
-      EigenArr(i, j) = arr[counter];
-      counter++;
-    }
-    counter += (ld - cols);
+  switch (op) {
+  case QUDA_BLAS_OP_N: return M;
+  case QUDA_BLAS_OP_T: return M.transpose();
+  case QUDA_BLAS_OP_C: return M.adjoint();
+  default: errorQuda("Unknown blas op type %d", op);
   }
+  return M;
 }
 
 void prepare_ref_array(void *array, int batches, uint64_t array_size, size_t data_size, QudaBLASDataType data_type)
 {
-  memset(array, 0, batches * array_size * data_size);
+  memset(array, 0, 2 * batches * array_size * data_size);
   // Populate the real part with rands
   for (uint64_t i = 0; i < 2 * array_size * batches; i += 2) { ((double *)array)[i] = rand() / (double)RAND_MAX; }
   // Populate the imaginary part with rands if needed
@@ -142,26 +145,27 @@ double blasGEMMEigenVerify(void *A_data, void *B_data, void *C_data_copy, void *
     std::swap(blas_param->a_offset, blas_param->b_offset);
     std::swap(blas_param->a_stride, blas_param->b_stride);
     std::swap(A_data, B_data);
+    std::swap(refA_size, refB_size);
   }
 
   // Problem parameters
-  int m = blas_param->m;
-  int n = blas_param->n;
-  int k = blas_param->k;
+  const int m = blas_param->m;
+  const int n = blas_param->n;
+  const int k = blas_param->k;
 
-  int lda = blas_param->lda;
-  int ldb = blas_param->ldb;
-  int ldc = blas_param->ldc;
+  const int lda = blas_param->lda;
+  const int ldb = blas_param->ldb;
+  const int ldc = blas_param->ldc;
 
-  int a_stride = blas_param->a_stride;
-  int b_stride = blas_param->b_stride;
-  int c_stride = blas_param->c_stride;
+  const uint64_t a_stride = blas_param->a_stride;
+  const uint64_t b_stride = blas_param->b_stride;
+  const uint64_t c_stride = blas_param->c_stride;
 
-  int a_offset = blas_param->a_offset;
-  int b_offset = blas_param->b_offset;
-  int c_offset = blas_param->c_offset;
+  const uint64_t a_offset = blas_param->a_offset;
+  const uint64_t b_offset = blas_param->b_offset;
+  const uint64_t c_offset = blas_param->c_offset;
 
-  int batches = blas_param->batch_count;
+  const int batches = blas_param->batch_count;
 
   complex<double> alpha = blas_param->alpha;
   complex<double> beta = blas_param->beta;
@@ -170,72 +174,58 @@ double blasGEMMEigenVerify(void *A_data, void *B_data, void *C_data_copy, void *
     beta.imag(0.0);
   }
 
-  // Eigen objects to store data
-  MatrixXcd A = MatrixXd::Zero(m, k);
-  MatrixXcd B = MatrixXd::Zero(k, n);
-  MatrixXcd C_eigen = MatrixXd::Zero(m, n);
-  MatrixXcd C_dev = MatrixXd::Zero(m, n);
-  MatrixXcd C_resid = MatrixXd::Zero(m, n);
+  // The stored shape of A and B depends on the operation applied to them
+  const int a_rows = blas_param->trans_a == QUDA_BLAS_OP_N ? m : k;
+  const int a_cols = blas_param->trans_a == QUDA_BLAS_OP_N ? k : m;
+  const int b_rows = blas_param->trans_b == QUDA_BLAS_OP_N ? k : n;
+  const int b_cols = blas_param->trans_b == QUDA_BLAS_OP_N ? n : k;
 
   // Pointers to data
-  complex<double> *A_ptr = (complex<double> *)(&A_data)[0];
-  complex<double> *B_ptr = (complex<double> *)(&B_data)[0];
-  complex<double> *C_ptr = (complex<double> *)(&C_data)[0];
-  complex<double> *Ccopy_ptr = (complex<double> *)(&C_data_copy)[0];
+  const complex<double> *A_ptr = static_cast<const complex<double> *>(A_data);
+  const complex<double> *B_ptr = static_cast<const complex<double> *>(B_data);
+  const complex<double> *C_ptr = static_cast<const complex<double> *>(C_data);
+  const complex<double> *Ccopy_ptr = static_cast<const complex<double> *>(C_data_copy);
 
   // Get maximum stride length to deduce the number of batches in the
   // computation
-  int max_stride = std::max(std::max(a_stride, b_stride), c_stride);
+  int max_stride = std::max(std::max(blas_param->a_stride, blas_param->b_stride), blas_param->c_stride);
 
   // If the user gives strides of 0 for all arrays, we are essentially performing
   // a GEMM on the first matrices in the array N_{batch} times.
   // Give them what they ask for, YMMV...
   // If the strides have not been set, we are just using strides of 1.
   if (max_stride <= 0) max_stride = 1;
+  const int n_gemm = (batches + max_stride - 1) / max_stride;
 
-  printfQuda("Computing Eigen matrix operation a * A_{%lu,%lu} * B_{%lu,%lu} + b * C_{%lu,%lu} = C_{%lu,%lu}\n",
-             A.rows(), A.cols(), B.rows(), B.cols(), C_eigen.rows(), C_eigen.cols(), C_eigen.rows(), C_eigen.cols());
+  printfQuda("Computing Eigen matrix operation a * A_{%d,%d} * B_{%d,%d} + b * C_{%d,%d} = C_{%d,%d}\n", m, k, k, n, m,
+             n, m, n);
 
+  // Each batch is verified independently directly on the reference
+  // arrays, so the reference is threaded over the batch index
   double max_relative_deviation = 0.0;
-  for (int batch = 0; batch < batches; batch += max_stride) {
-
-    // Populate Eigen objects
-    fillEigenArray(A, A_ptr, m, k, lda, a_offset);
-    fillEigenArray(B, B_ptr, k, n, ldb, b_offset);
-    fillEigenArray(C_eigen, Ccopy_ptr, m, n, ldc, c_offset);
-    fillEigenArray(C_dev, C_ptr, m, n, ldc, c_offset);
-
-    // Apply op(A) and op(B)
-    switch (blas_param->trans_a) {
-    case QUDA_BLAS_OP_T: A.transposeInPlace(); break;
-    case QUDA_BLAS_OP_C: A.adjointInPlace(); break;
-    case QUDA_BLAS_OP_N: break;
-    default: errorQuda("Unknown blas op type %d", blas_param->trans_a);
-    }
-
-    switch (blas_param->trans_b) {
-    case QUDA_BLAS_OP_T: B.transposeInPlace(); break;
-    case QUDA_BLAS_OP_C: B.adjointInPlace(); break;
-    case QUDA_BLAS_OP_N: break;
-    default: errorQuda("Unknown blas op type %d", blas_param->trans_b);
-    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(max : max_relative_deviation)
+#endif
+  for (int batch = 0; batch < n_gemm; batch++) {
+    const ConstRowMapXcd A(A_ptr + a_offset + batch * refA_size * a_stride, a_rows, a_cols, OuterStride<>(lda));
+    const ConstRowMapXcd B(B_ptr + b_offset + batch * refB_size * b_stride, b_rows, b_cols, OuterStride<>(ldb));
+    const ConstRowMapXcd C_ref(Ccopy_ptr + c_offset + batch * refC_size * c_stride, m, n, OuterStride<>(ldc));
+    const ConstRowMapXcd C_dev(C_ptr + c_offset + batch * refC_size * c_stride, m, n, OuterStride<>(ldc));
 
     // Perform GEMM using Eigen
-    C_eigen = alpha * A * B + beta * C_eigen;
+    MatrixXcd C_eigen = beta * C_ref;
+    C_eigen.noalias() += alpha * apply_op(A, blas_param->trans_a) * apply_op(B, blas_param->trans_b);
 
     // Check Eigen result against blas
-    C_resid = C_dev - C_eigen;
-    double deviation = C_resid.norm();
+    double deviation = (C_dev - C_eigen).norm();
     double relative_deviation = deviation / C_eigen.norm();
     max_relative_deviation = std::max(max_relative_deviation, relative_deviation);
 
-    printfQuda("batch %d: (C_host - C_dev) Frobenius norm = %e. Relative deviation = %e\n", batch, deviation,
-               relative_deviation);
-
-    a_offset += refA_size * a_stride;
-    b_offset += refB_size * b_stride;
-    c_offset += refC_size * c_stride;
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("batch %d: (C_host - C_dev) Frobenius norm = %e. Relative deviation = %e\n", batch * max_stride,
+                 deviation, relative_deviation);
   }
+  printfQuda("Max relative deviation over %d GEMMs = %e\n", n_gemm, max_relative_deviation);
 
   // Restore the blas parameters to their original values
   if (blas_param->data_order == QUDA_BLAS_DATAORDER_COL) {
@@ -334,43 +324,36 @@ double blasLUInvEigenVerify(void *ref_array, void *dev_inv_array, uint64_t array
   // Parse parameters for Eigen
   //-------------------------------------------------------------------------
   // Problem parameters
-  int offset = 0;
-  int batches = blas_param->batch_count;
-  int mat_rank = blas_param->inv_mat_size;
-
-  // Eigen objects to store data
-  MatrixXcd ref = MatrixXd::Zero(mat_rank, mat_rank);
-  MatrixXcd ref_inv = MatrixXd::Zero(mat_rank, mat_rank);
-  MatrixXcd dev_inv = MatrixXd::Zero(mat_rank, mat_rank);
-  MatrixXcd inv_resid = MatrixXd::Zero(mat_rank, mat_rank);
+  const int batches = blas_param->batch_count;
+  const int mat_rank = blas_param->inv_mat_size;
 
   // Pointers to data
-  complex<double> *ref_ptr = (complex<double> *)(&ref_array)[0];
-  complex<double> *dev_inv_ptr = (complex<double> *)(&dev_inv_array)[0];
+  const complex<double> *ref_ptr = static_cast<const complex<double> *>(ref_array);
+  const complex<double> *dev_inv_ptr = static_cast<const complex<double> *>(dev_inv_array);
 
-  printfQuda("Computing Eigen matrix operation ref_inv{%lu,%lu} = ref{%lu,%lu}^(-1)\n", ref.rows(), ref.cols(),
-             ref_inv.rows(), ref_inv.cols());
+  printfQuda("Computing Eigen matrix operation ref_inv{%d,%d} = ref{%d,%d}^(-1)\n", mat_rank, mat_rank, mat_rank,
+             mat_rank);
 
   double max_relative_deviation = 0.0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(max : max_relative_deviation)
+#endif
   for (int batch = 0; batch < batches; batch++) {
-
-    // Populate Eigen objects
-    fillEigenArray(ref, ref_ptr, mat_rank, mat_rank, mat_rank, offset);
-    fillEigenArray(dev_inv, dev_inv_ptr, mat_rank, mat_rank, mat_rank, offset);
+    const Map<const MatrixXcd> ref(ref_ptr + batch * array_size, mat_rank, mat_rank);
+    const Map<const MatrixXcd> dev_inv(dev_inv_ptr + batch * array_size, mat_rank, mat_rank);
 
     // Check Eigen result against blas
-    ref_inv = ref.inverse();
-    inv_resid = dev_inv - ref_inv;
+    MatrixXcd ref_inv = ref.partialPivLu().inverse();
 
-    double deviation = inv_resid.norm();
+    double deviation = (dev_inv - ref_inv).norm();
     double relative_deviation = deviation / ref_inv.norm();
     max_relative_deviation = std::max(max_relative_deviation, relative_deviation);
 
-    printfQuda("batch %d: (ref_inv - dev_inv) Frobenius norm = %e. Relative deviation = %e\n", batch, deviation,
-               relative_deviation);
-
-    offset += array_size;
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("batch %d: (ref_inv - dev_inv) Frobenius norm = %e. Relative deviation = %e\n", batch, deviation,
+                 relative_deviation);
   }
+  printfQuda("Max relative deviation over %d inversions = %e\n", batches, max_relative_deviation);
 
   return max_relative_deviation;
 }
@@ -182,6 +182,7 @@ int contractionFT_reference(void **spinorX, void **spinorY, const double *const
   auto epsilon = std::numeric_limits<Float>::epsilon();
   auto fact = epsilon;
   fact *= sqrt((double)nSpin * 6 * V * comm_size() * 2 / reduction_slices); // account for repeated roundoff in float ops
+  fact *= sqrt((double)nSpin * nSpin * src_colors); // account for the accumulation over source spins and colors
   fact *= 10; // account for variation in phase computation
   std::vector<double> tolerance(ntol);
   std::generate(tolerance.begin(), tolerance.end(), [step = 1e-6 * fact]() mutable { return step *= 10; });
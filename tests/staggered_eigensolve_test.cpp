@@ -51,7 +51,9 @@ void display_test_info(QudaEigParam &param)
     printfQuda(" - Operator: daggered (%s) , norm-op (%s), even-odd pc (%s)\n", param.use_dagger ? "true" : "false",
                param.use_norm_op ? "true" : "false", param.use_pc ? "true" : "false");
   }
-  if (param.use_poly_acc) {
+  if (param.use_poly_acc && param.poly_acc_auto) {
+    printfQuda(" - Chebyshev polynomial degree and minimum will be selected from a spectral density estimate\n");
+  } else if (param.use_poly_acc) {
     printfQuda(" - Chebyshev polynomial degree %d\n", param.poly_deg);
     printfQuda(" - Chebyshev polynomial minumum %e\n", param.a_min);
     if (param.a_max <= 0)
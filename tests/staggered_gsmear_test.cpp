@@ -52,6 +52,24 @@ TEST_F(StaggeredGSmearTest, verify)
   ASSERT_LE(deviation, tol) << "reference and QUDA implementations do not agree";
 }
 
+TEST_F(StaggeredGSmearTest, batched)
+{
+  if (gtest_type != gsmear_test_type::GaussianSmear) GTEST_SKIP();
+
+  double deviation = gsmear_test_wrapper.run_batched_test(Nsrc > 1 ? Nsrc : 4);
+  double tol = getTolerance(gsmear_test_wrapper.inv_param.cuda_prec);
+  ASSERT_LE(deviation, tol) << "batched and one-at-a-time smearing do not agree";
+}
+
+TEST_F(StaggeredGSmearTest, batched_wuppertal)
+{
+  if (gtest_type != gsmear_test_type::GaussianSmear || !is_enabled_laplace()) GTEST_SKIP();
+
+  double deviation = gsmear_test_wrapper.run_batched_wuppertal_test();
+  double tol = getTolerance(gsmear_test_wrapper.inv_param.cuda_prec);
+  ASSERT_LE(deviation, tol) << "batched and one-at-a-time Wuppertal smearing do not agree";
+}
+
 
 int main(int argc, char **argv)
 {
@@ -393,6 +393,107 @@ struct StaggeredGSmearTestWrapper { //
     }
   }
 
+  /**
+     @brief Smear a set of sources both one at a time and with a
+     single batched call, with the two-link field kept resident, and
+     report the speedup of the batched call
+     @param[in] n_src The number of sources
+     @return The maximum relative deviation between the two
+  */
+  double run_batched_test(int n_src)
+  {
+    ColorSpinorParam cs_param;
+    constructStaggeredTestSpinorParam(&cs_param, &inv_param, &gauge_param);
+    std::vector<ColorSpinorField> single(n_src, cs_param), batch(n_src, cs_param), warmup(n_src, cs_param);
+    std::vector<void *> batch_ptr(n_src), warmup_ptr(n_src);
+    for (int i = 0; i < n_src; i++) {
+      single[i].Source(QUDA_RANDOM_SOURCE);
+      batch[i] = single[i];
+      warmup[i] = single[i];
+      batch_ptr[i] = batch[i].data();
+      warmup_ptr[i] = warmup[i].data();
+    }
+
+    QudaQuarkSmearParam qsm_param;
+    qsm_param.inv_param = &inv_param;
+    double omega = 2.0;
+    qsm_param.n_steps = smear_n_steps;
+    qsm_param.width = -1.0 * omega * omega / (4 * smear_n_steps);
+    qsm_param.t0 = smear_t0;
+
+    // compute the two-link field and tune both variants
+    qsm_param.compute_2link = smear_compute_two_link;
+    qsm_param.delete_2link = false;
+    performTwoLinkGaussianSmearNStep(warmup_ptr[0], &qsm_param);
+    qsm_param.compute_2link = false;
+    performTwoLinkGaussianSmearNStepMultiSrc(warmup_ptr.data(), n_src, &qsm_param);
+
+    host_timer_t single_timer;
+    single_timer.start();
+    for (int i = 0; i < n_src; i++) performTwoLinkGaussianSmearNStep(single[i].data(), &qsm_param);
+    single_timer.stop();
+
+    host_timer_t batch_timer;
+    batch_timer.start();
+    qsm_param.delete_2link = smear_delete_two_link;
+    performTwoLinkGaussianSmearNStepMultiSrc(batch_ptr.data(), n_src, &qsm_param);
+    batch_timer.stop();
+
+    printfQuda("Smearing %d sources: %e s one at a time, %e s batched, speedup %.2fx\n", n_src, single_timer.last(),
+               batch_timer.last(), single_timer.last() / batch_timer.last());
+    ::testing::Test::RecordProperty("Batched_speedup", std::to_string(single_timer.last() / batch_timer.last()));
+
+    double deviation = 0.0;
+    for (int i = 0; i < n_src; i++) {
+      double norm = blas::norm2(single[i]);
+      deviation = std::max(deviation, sqrt(blas::xmyNorm(single[i], batch[i]) / norm));
+    }
+    return deviation;
+  }
+
+  /**
+     @brief Apply Wuppertal smearing to a set of sources both one at a
+     time and with a single batched call.  The number of sources spans
+     a full tile plus a partial remainder tile, and both an even and an
+     odd number of steps are applied, so that the batched call starts a
+     tile with its buffers both in and out of their original order.
+     @return The maximum relative deviation between the two
+  */
+  double run_batched_wuppertal_test()
+  {
+    const int tile = get_max_multi_rhs();
+    const int n_src = tile + std::max(tile / 2, 1);
+
+    ColorSpinorParam cs_param;
+    constructStaggeredTestSpinorParam(&cs_param, &inv_param, &gauge_param);
+    std::vector<ColorSpinorField> in(n_src, cs_param), single(n_src, cs_param), batch(n_src, cs_param);
+    std::vector<void *> in_ptr(n_src), batch_ptr(n_src);
+    for (int i = 0; i < n_src; i++) {
+      in[i].Source(QUDA_RANDOM_SOURCE);
+      in_ptr[i] = in[i].data();
+      batch_ptr[i] = batch[i].data();
+    }
+
+    // the Wuppertal interface takes the spinor layout from the dslash
+    // type, so ensure it matches the single-spin host fields
+    inv_param.dslash_type = QUDA_STAGGERED_DSLASH;
+
+    const double alpha = 0.5;
+    double deviation = 0.0;
+    for (unsigned int n_steps : {2u, 3u}) {
+      for (int i = 0; i < n_src; i++) performWuppertalnStep(single[i].data(), in[i].data(), &inv_param, n_steps, alpha);
+      performWuppertalnStepMultiSrc(batch_ptr.data(), in_ptr.data(), n_src, &inv_param, n_steps, alpha);
+
+      for (int i = 0; i < n_src; i++) {
+        double norm = blas::norm2(single[i]);
+        deviation = std::max(deviation, sqrt(blas::xmyNorm(single[i], batch[i]) / norm));
+      }
+      printfQuda("Wuppertal smearing %d sources in tiles of %d with %u steps: maximum deviation %e\n", n_src, tile,
+                 n_steps, deviation);
+    }
+    return deviation;
+  }
+
   double verify()
   {
     double deviation = 0.0;
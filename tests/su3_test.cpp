@@ -42,11 +42,16 @@ void display_test_info()
     printfQuda(" - alpha3 %f\n", gauge_smear_alpha3);
     break;
   case QUDA_GAUGE_SMEAR_WILSON_FLOW:
-  case QUDA_GAUGE_SMEAR_SYMANZIK_FLOW: printfQuda(" - epsilon %f\n", gauge_smear_epsilon); break;
+  case QUDA_GAUGE_SMEAR_SYMANZIK_FLOW:
+    printfQuda(" - epsilon %f\n", gauge_smear_epsilon);
+    if (gauge_smear_tol > 0.0) printfQuda(" - adaptive step size tolerance %e\n", gauge_smear_tol);
+    break;
   default: errorQuda("Undefined test type %d given", test_type);
   }
   printfQuda(" - smearing steps %d\n", gauge_smear_steps);
   printfQuda(" - smearing ignore direction %d\n", gauge_smear_dir_ignore);
+  if (gauge_smear_steps_per_exchange > 0)
+    printfQuda(" - smearing steps per halo exchange %d\n", gauge_smear_steps_per_exchange);
   printfQuda(" - Measurement interval %d\n", measurement_interval);
 
   printfQuda("Grid partition info:     X  Y  Z  T\n");
@@ -214,10 +219,12 @@ int main(int argc, char **argv)
   smear_param.alpha = gauge_smear_alpha;
   smear_param.rho = gauge_smear_rho;
   smear_param.epsilon = gauge_smear_epsilon;
+  smear_param.tol = gauge_smear_tol;
   smear_param.alpha1 = gauge_smear_alpha1;
   smear_param.alpha2 = gauge_smear_alpha2;
   smear_param.alpha3 = gauge_smear_alpha3;
   smear_param.dir_ignore = gauge_smear_dir_ignore;
+  smear_param.steps_per_exchange = gauge_smear_steps_per_exchange;
 
   host_timer.start(); // start the timer
   switch (smear_param.smear_type) {
@@ -232,6 +232,9 @@ bool eig_use_poly_acc = true;
 int eig_poly_deg = 100;
 double eig_amin = 0.1;
 double eig_amax = 0.0; // If zero is passed to the solver, an estimate will be computed
+bool eig_poly_acc_auto = false;
+int eig_kpm_n_moments = 64;
+int eig_kpm_n_vec = 4;
 bool eig_use_normop = true;
 bool eig_use_dagger = false;
 bool eig_use_pc = false;
@@ -285,6 +288,7 @@ int heatbath_num_steps = 10;
 int heatbath_num_heatbath_per_step = 5;
 int heatbath_num_overrelax_per_step = 5;
 bool heatbath_coldstart = false;
+int heatbath_benchmark_steps = 0;
 // GF Options
 int gf_gauge_dir = 4;
 int gf_maxiter = 10000;
@@ -295,6 +299,8 @@ int gf_reunit_interval = 10;
 double gf_tolerance = 1e-6;
 bool gf_theta_condition = false;
 bool gf_fft_autotune = false;
+int gf_quality_interval = 1;
+int gf_ovr_tile = 4;
 
 int eofa_pm = 1;
 double eofa_shift = -1.2345;
@@ -307,12 +313,14 @@ bool gauge_smear = false;
 QudaGaugeSmearType gauge_smear_type = QUDA_GAUGE_SMEAR_STOUT;
 double gauge_smear_rho = 0.1;
 double gauge_smear_epsilon = 0.1;
+double gauge_smear_tol = 0.0;
 double gauge_smear_alpha = 0.6;
 double gauge_smear_alpha1 = 0.75;
 double gauge_smear_alpha2 = 0.6;
 double gauge_smear_alpha3 = 0.3;
 int gauge_smear_steps = 5;
 int gauge_smear_dir_ignore = -1;
+int gauge_smear_steps_per_exchange = 0;
 int measurement_interval = 5;
 bool su_project = true;
 
@@ -418,7 +426,8 @@ namespace
                                                  {"blktrlm", QUDA_EIG_BLK_TR_LANCZOS},
                                                  {"trlm-3d", QUDA_EIG_TR_LANCZOS_3D},
                                                  {"iram", QUDA_EIG_IR_ARNOLDI},
-                                                 {"blkiram", QUDA_EIG_BLK_IR_ARNOLDI}};
+                                                 {"blkiram", QUDA_EIG_BLK_IR_ARNOLDI},
+                                                 {"krylov-schur", QUDA_EIG_KRYLOV_SCHUR}};
 
   CLI::TransformPairs<QudaTransferType> transfer_type_map {
     {"aggregate", QUDA_TRANSFER_AGGREGATE},
@@ -657,10 +666,11 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
   quda_app->add_option("--precon-schwarz-cycle", precon_schwarz_cycle,
                        "The number of Schwarz cycles to apply per smoother application (default=1)");
 
-  CLI::TransformPairs<int> rank_order_map {{"col", 0}, {"row", 1}};
+  CLI::TransformPairs<int> rank_order_map {{"col", 0}, {"row", 1}, {"topo", 2}};
   quda_app
     ->add_option("--rank-order", rank_order,
-                 "Set the [t][z][y][x] rank order as either column major (t fastest, default) or row major (x fastest)")
+                 "Set the [t][z][y][x] rank order as either column major (t fastest, default), row major (x fastest), "
+                 "or topology aware (chosen to minimize inter-node halo traffic)")
     ->transform(CLI::QUDACheckedTransformer(rank_order_map));
 
   quda_app->add_option("--recon", link_recon, "Link reconstruction type")
@@ -780,6 +790,14 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
 
   opgroup->add_option("--eig-amax", eig_amax, "The maximum in the polynomial acceleration")->check(CLI::PositiveNumber);
   opgroup->add_option("--eig-amin", eig_amin, "The minimum in the polynomial acceleration")->check(CLI::PositiveNumber);
+  opgroup->add_option("--eig-poly-acc-auto", eig_poly_acc_auto,
+                      "Select the polynomial acceleration minimum and degree from a spectral density estimate (default false)");
+  opgroup->add_option("--eig-kpm-moments", eig_kpm_n_moments,
+                      "Number of Chebyshev moments in the spectral density estimate (default 64)")
+    ->check(CLI::PositiveNumber);
+  opgroup->add_option("--eig-kpm-vectors", eig_kpm_n_vec,
+                      "Number of random vectors in the spectral density estimate (default 4)")
+    ->check(CLI::PositiveNumber);
 
   opgroup->add_option("--eig-ARPACK-logfile", eig_arpack_logfile, "The filename storing the log from arpack");
   opgroup->add_option("--eig-arpack-check", eig_arpack_check,
@@ -1147,6 +1165,10 @@ void add_su3_option_group(std::shared_ptr<QUDAApp> quda_app)
     "--su3-smear-epsilon", gauge_smear_epsilon,
     "epsilon coefficient for Over-Improved Stout smearing and step size for Wilson flow (default 0.1)");
 
+  opgroup->add_option("--su3-smear-tol", gauge_smear_tol,
+                      "Local error tolerance for adaptive step-size Wilson flow, with epsilon the initial step size "
+                      "(default 0, fixed step size)");
+
   opgroup->add_option("--su3-smear-alpha1", gauge_smear_alpha1, "alpha1 coefficient for HYP smearing (default 0.75)");
   opgroup->add_option("--su3-smear-alpha2", gauge_smear_alpha2, "alpha2 coefficient for HYP smearing (default 0.6)");
   opgroup->add_option("--su3-smear-alpha3", gauge_smear_alpha3, "alpha3 coefficient for HYP smearing (default 0.3)");
@@ -1155,6 +1177,9 @@ void add_su3_option_group(std::shared_ptr<QUDAApp> quda_app)
     "--su3-smear-dir-ignore", gauge_smear_dir_ignore,
     "Direction to be ignored by the smearing, negative value means decided by --su3-smear-type (default -1)");
 
+  opgroup->add_option("--su3-smear-steps-per-exchange", gauge_smear_steps_per_exchange,
+                      "Number of APE, Stout or HYP smearing steps per halo exchange (default 0, exchange every step)");
+
   opgroup->add_option("--su3-smear-steps", gauge_smear_steps, "The number of smearing steps to perform (default 10)");
 
   opgroup->add_option("--su3-measurement-interval", measurement_interval,
@@ -1199,6 +1224,8 @@ void add_heatbath_option_group(std::shared_ptr<QUDAApp> quda_app)
                       "Number of measurement steps in heatbath test (default 10)");
   opgroup->add_option("--heatbath-warmup-steps", heatbath_warmup_steps,
                       "Number of warmup steps in heatbath test (default 10)");
+  opgroup->add_option("--heatbath-benchmark-steps", heatbath_benchmark_steps,
+                      "Number of steps to benchmark the device and host heatbath with (default 0, no benchmark)");
   // DMH
   // opgroup->add_option("--heatbath-checkpoint", heatbath_checkpoint,
   //"Number of measurement steps in heatbath before checkpointing (default 5)");
@@ -1296,6 +1323,10 @@ void add_gaugefix_option_group(std::shared_ptr<QUDAApp> quda_app)
   opgroup->add_option(
     "--gf-fft-autotune", gf_fft_autotune,
     "In the FFT method, automatically adjust the alpha parameter if the quality begins to diverge (default false)");
+  opgroup->add_option("--gf-quality-interval", gf_quality_interval,
+                      "Compute the gauge fixing quality and check for convergence every N steps (default 1)");
+  opgroup->add_option("--gf-ovr-tile", gf_ovr_tile,
+                      "The extent of the 4-d tiles used by the overrelaxation method on the host (default 4)");
 }
 
 void add_comms_option_group(std::shared_ptr<QUDAApp> quda_app)
@@ -482,6 +482,9 @@ extern bool eig_use_poly_acc;
 extern int eig_poly_deg;
 extern double eig_amin;
 extern double eig_amax;
+extern bool eig_poly_acc_auto;
+extern int eig_kpm_n_moments;
+extern int eig_kpm_n_vec;
 extern bool eig_use_normop;
 extern bool eig_use_dagger;
 extern bool eig_use_pc;
@@ -535,6 +538,7 @@ extern int heatbath_num_steps;
 extern int heatbath_num_heatbath_per_step;
 extern int heatbath_num_overrelax_per_step;
 extern bool heatbath_coldstart;
+extern int heatbath_benchmark_steps;
 
 extern int gf_gauge_dir;
 extern int gf_maxiter;
@@ -545,6 +549,8 @@ extern int gf_reunit_interval;
 extern double gf_tolerance;
 extern bool gf_theta_condition;
 extern bool gf_fft_autotune;
+extern int gf_quality_interval;
+extern int gf_ovr_tile;
 
 extern int eofa_pm;
 extern double eofa_shift;
@@ -555,12 +561,14 @@ extern double eofa_mq3;
 // SU(3) smearing options
 extern double gauge_smear_rho;
 extern double gauge_smear_epsilon;
+extern double gauge_smear_tol;
 extern double gauge_smear_alpha;
 extern double gauge_smear_alpha1;
 extern double gauge_smear_alpha2;
 extern double gauge_smear_alpha3;
 extern int gauge_smear_steps;
 extern int gauge_smear_dir_ignore;
+extern int gauge_smear_steps_per_exchange;
 extern int measurement_interval;
 extern QudaGaugeSmearType gauge_smear_type;
 extern bool su_project;
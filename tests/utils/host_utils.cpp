@@ -397,11 +397,13 @@ void initComms(int, char **, int *const commDims)
   QMP_thread_level_t tl;
   QMP_init_msg_passing(&argc, &argv, QMP_THREAD_FUNNELED, &tl);
 
-  // make sure the QMP logical ordering matches QUDA's
+  // make sure the QMP logical ordering matches QUDA's; the
+  // topology-aware mapping is not a permutation of the dimensions, so
+  // it cannot be expressed as a QMP logical topology and none is declared
   if (rank_order == 0) {
     int map[] = {3, 2, 1, 0};
     QMP_declare_logical_topology_map(commDims, 4, map, 4);
-  } else {
+  } else if (rank_order == 1) {
     int map[] = {0, 1, 2, 3};
     QMP_declare_logical_topology_map(commDims, 4, map, 4);
   }
@@ -417,9 +419,14 @@ void initComms(int, char **, int *const commDims)
   }
 #endif
 
-  QudaCommsMap func = rank_order == 0 ? lex_rank_from_coords_t : lex_rank_from_coords_x;
-
-  initCommsGridQuda(4, commDims, func, NULL);
+  if (rank_order == 2) {
+    // the global lattice is needed to weight the halo traffic
+    int X[] = {xdim * commDims[0], ydim * commDims[1], zdim * commDims[2], tdim * commDims[3]};
+    initCommsGridTopologyQuda(4, commDims, X);
+  } else {
+    QudaCommsMap func = rank_order == 0 ? lex_rank_from_coords_t : lex_rank_from_coords_x;
+    initCommsGridQuda(4, commDims, func, NULL);
+  }
 
   for (int d = 0; d < 4; d++) {
     if (dim_partitioned[d]) { commDimPartitionedSet(d); }
@@ -427,8 +434,12 @@ void initComms(int, char **, int *const commDims)
 
   initRand();
 
-  printfQuda("Rank order is %s major (%s running fastest)\n", rank_order == 0 ? "column" : "row",
-             rank_order == 0 ? "t" : "x");
+  if (rank_order == 2) {
+    printfQuda("Rank order is topology aware\n");
+  } else {
+    printfQuda("Rank order is %s major (%s running fastest)\n", rank_order == 0 ? "column" : "row",
+               rank_order == 0 ? "t" : "x");
+  }
 }
 
 void finalizeComms()
@@ -449,6 +460,8 @@ void initRand()
   rank = QMP_get_node_number();
 #elif defined(MPI_COMMS)
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#elif defined(MOCK_COMMS)
+  rank = quda::comm_rank_global();
 #endif
 
   srand(17 * rank + 137);
@@ -224,6 +224,7 @@ const char *get_eig_type_str(QudaEigType type)
   case QUDA_EIG_TR_LANCZOS_3D: ret = "trlm_3d"; break;
   case QUDA_EIG_IR_ARNOLDI: ret = "iram"; break;
   case QUDA_EIG_BLK_IR_ARNOLDI: ret = "blkiram"; break;
+  case QUDA_EIG_KRYLOV_SCHUR: ret = "krylov_schur"; break;
   default: ret = "unknown eigensolver"; break;
   }
 
@@ -439,6 +440,20 @@ const char *get_blas_type_str(QudaBLASType type)
   return s;
 }
 
+const char *get_blas_data_type_str(QudaBLASDataType type)
+{
+  const char *s;
+
+  switch (type) {
+  case QUDA_BLAS_DATATYPE_S: s = "S"; break;
+  case QUDA_BLAS_DATATYPE_D: s = "D"; break;
+  case QUDA_BLAS_DATATYPE_C: s = "C"; break;
+  case QUDA_BLAS_DATATYPE_Z: s = "Z"; break;
+  default: fprintf(stderr, "Error: invalid BLAS data type\n"); exit(1);
+  }
+  return s;
+}
+
 const char *get_TwistFlavor_str(QudaTwistFlavorType type)
 {
   const char *ret;
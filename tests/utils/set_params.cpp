@@ -341,8 +341,10 @@ void setEigParam(QudaEigParam &eig_param)
 
   eig_param.ortho_block_size = eig_ortho_block_size;
   eig_param.compute_evals_batch_size = eig_evals_batch_size;
-  eig_param.block_size
-    = (eig_param.eig_type == QUDA_EIG_TR_LANCZOS || eig_param.eig_type == QUDA_EIG_IR_ARNOLDI) ? 1 : eig_block_size;
+  eig_param.block_size = (eig_param.eig_type == QUDA_EIG_TR_LANCZOS || eig_param.eig_type == QUDA_EIG_IR_ARNOLDI
+                          || eig_param.eig_type == QUDA_EIG_KRYLOV_SCHUR) ?
+    1 :
+    eig_block_size;
   eig_param.n_ev = eig_n_ev;
   eig_param.n_kr = eig_n_kr;
   eig_param.tol = eig_tol;
@@ -368,6 +370,9 @@ void setEigParam(QudaEigParam &eig_param)
   eig_param.poly_deg = eig_poly_deg;
   eig_param.a_min = eig_amin;
   eig_param.a_max = eig_amax;
+  eig_param.poly_acc_auto = eig_poly_acc_auto ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+  eig_param.kpm_n_moments = eig_kpm_n_moments;
+  eig_param.kpm_n_vec = eig_kpm_n_vec;
 
   eig_param.arpack_check = eig_arpack_check ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
   safe_strcpy(eig_param.arpack_logfile, eig_arpack_logfile, 512, "eig_arpack_logfile");
@@ -790,8 +795,8 @@ void setMultigridEigParam(QudaEigParam &mg_eig_param, int level)
   }
 
   mg_eig_param.ortho_block_size = mg_eig_ortho_block_size[level];
-  mg_eig_param.block_size
-    = (mg_eig_param.eig_type == QUDA_EIG_TR_LANCZOS || mg_eig_param.eig_type == QUDA_EIG_IR_ARNOLDI) ?
+  mg_eig_param.block_size = (mg_eig_param.eig_type == QUDA_EIG_TR_LANCZOS || mg_eig_param.eig_type == QUDA_EIG_IR_ARNOLDI
+                             || mg_eig_param.eig_type == QUDA_EIG_KRYLOV_SCHUR) ?
     1 :
     mg_eig_block_size[level];
   mg_eig_param.n_ev = mg_eig_n_ev[level];